@@ -0,0 +1,78 @@
+# ====================================================================================================================================
+# @file       add_eni_layout_header.cmake
+# @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+# @date       Sunday, 18th October 2026 12:21:24 pm
+# @modified   Sunday, 18th October 2026 1:31:57 pm
+# @project    ethercat-lib
+# @brief      Definition of the add_eni_layout_header() macro
+#
+#
+# @copyright Krzysztof Pierczyk © 2022
+# ====================================================================================================================================
+
+# =========================================================== Definitions ========================================================== #
+
+# ----------------------------------------------------------------------------------
+# @brief Generates C++ header describing layout of the Process Data Image of the
+#    given ENI file (see ethercat/layout.hpp) and makes it available to the target
+#
+# @param TARGET [NAME]
+#    target the header is generated for
+# @param ENI [PATH]
+#    path to the ENI file (relative paths are resolved against the current 
+#    source directory)
+# @param HEADER [NAME]
+#    name of the generated header (relative to the generated include directory)
+# @param NAMESPACE [NAME] (optional)
+#    namespace of the generated header (eni_layout by default)
+# ----------------------------------------------------------------------------------
+macro(add_eni_layout_header)
+
+    # -------------------------- Parse arguments -------------------------
+
+    # Single-value arguments
+    set(SINGLE_ARGUMENTS
+        TARGET
+        ENI
+        HEADER
+        NAMESPACE
+    )
+
+    # Set arg prefix
+    set(ARG_PREFIX "ARG")
+    # Parse arguments
+    cmake_parse_arguments(${ARG_PREFIX}
+        ""
+        "${SINGLE_ARGUMENTS}"
+        ""
+        ${ARGN}
+    )
+
+    # Set default namespace
+    if(NOT ARG_NAMESPACE)
+        set(ARG_NAMESPACE eni_layout)
+    endif()
+
+    # Resolve path to the ENI relative to the current source directory (the generator runs in the binary directory)
+    get_filename_component(ARG_ENI "${ARG_ENI}" ABSOLUTE BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+
+    # --------------------------- Define targets -------------------------
+
+    # Directory of generated headers
+    set(ENI_LAYOUT_INCLUDE_DIR ${CMAKE_CURRENT_BINARY_DIR}/${ARG_TARGET}_eni_layout/include)
+
+    # Generate header
+    add_custom_command(
+        OUTPUT ${ENI_LAYOUT_INCLUDE_DIR}/${ARG_HEADER}
+        COMMAND eni_codegen ${ARG_ENI} ${ENI_LAYOUT_INCLUDE_DIR}/${ARG_HEADER} ${ARG_NAMESPACE}
+        DEPENDS eni_codegen ${ARG_ENI}
+        COMMENT "Generating layout of the PDI from ${ARG_ENI}"
+        VERBATIM
+    )
+
+    # Attach header to the target
+    target_sources(${ARG_TARGET} PRIVATE ${ENI_LAYOUT_INCLUDE_DIR}/${ARG_HEADER})
+    target_include_directories(${ARG_TARGET} PRIVATE ${ENI_LAYOUT_INCLUDE_DIR})
+
+endmacro()
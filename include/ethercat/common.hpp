@@ -17,6 +17,7 @@
 /* =========================================================== Includes =========================================================== */
 
 #include "ethercat/config.hpp"
+#include "ethercat/common/pdi.hpp"
 #include "ethercat/common/synchronisation.hpp"
 #include "ethercat/common/translation.hpp"
 #include "ethercat/common/utilities.hpp"
@@ -0,0 +1,24 @@
+/* ============================================================================================================================ *//**
+ * @file       pdi.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 1:06:22 pm
+ * @modified   Sunday, 18th October 2026 1:14:13 pm
+ * @project    ethercat-lib
+ * @brief      Declarations of common tools for managing data mapped into the Process Data Image
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_PDI_H__
+#define __ETHERCAT_COMMON_PDI_H__
+
+/* =========================================================== Includes =========================================================== */
+
+#include "ethercat/common/pdi/entry_table.hpp"
+#include "ethercat/common/pdi/image_buffer.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
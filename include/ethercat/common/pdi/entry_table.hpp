@@ -0,0 +1,183 @@
+/* ============================================================================================================================ *//**
+ * @file       entry_table.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 1:06:22 pm
+ * @modified   Sunday, 18th October 2026 1:42:05 pm
+ * @project    ethercat-lib
+ * @brief      Definition of the flat (structure-of-arrays) table of PDO entries mapped into the Process Data Image
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_PDI_ENTRY_TABLE_H__
+#define __ETHERCAT_COMMON_PDI_ENTRY_TABLE_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+// Private includes
+#include "ethercat/config.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::common::pdi {
+
+/* ========================================================== EntryTable ========================================================== */
+
+/**
+ * @brief Flat table of PDO entries mapped into a single (input or output) Process Data Image
+ * @details Parameters of entries (offsets and sizes in the PDI, copy kernels, owning slaves and
+ *    offsets of entries' data) are stored in separate contiguous arrays and data of all entries
+ *    is stored in a single arena. Rows keep the order in which entries are added. The tables
+ *    used by the Master are built (see Master::prepare_pdos()) by adding entries sorted by their
+ *    offsets in the PDI, so that the bus I/O loop streams through contiguous memory and entries
+ *    covered by a cyclic command form a contiguous range of rows (located with a binary search
+ *    in Master::index_cyclic_commands(), which relies on this ordering).
+ *
+ * @note Arena is allocated when rows are added. A table is fully built before it is shared with
+ *    PDO entries and it is not resized afterwards, so that data of entries are never relocated.
+ *    When the bus is reconfigured (see Master::reload()), a new table is built and entries are
+ *    moved to it; the old table is released.
+ * @note All arrays of the table (including the arena) are allocated from the memory resource
+ *    given at construction
+ */
+class EntryTable {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Index of the row of the table
+    using Index = std::size_t;
+
+    /**
+     * @brief Kernel copying data of the entry between the PDI and the arena
+     */
+    enum class Kernel : uint8_t {
+        Bytes, /**< Entry is byte-aligned (data is copied with memcpy) */
+        Bits   /**< Entry is not byte-aligned (data is bit-shifted)    */
+    };
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /**
+     * @brief Constructs an empty table
+     * 
+     * @param resource 
+     *    memory resource that arrays of the table are allocated from
+     */
+    inline explicit EntryTable(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+    /// Disable copy-construction (entries refer to rows of the table)
+    EntryTable(const EntryTable &rtable) = delete;
+    /// Disable copy-asignment (entries refer to rows of the table)
+    EntryTable &operator=(const EntryTable &rtable) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Reserves memory for @p rows rows holding @p bytes bytes of data in total
+     */
+    inline void reserve(std::size_t rows, std::size_t bytes);
+
+    /**
+     * @brief Adds a new row to the table (data of the entry is zero-initialized)
+     *
+     * @param bitoffset
+     *    offset of the entry in the PDI in bits
+     * @param bitsize
+     *    size of the entry in bits
+     * @param owner
+     *    index of the slave owning the entry
+     * @returns
+     *    index of the added row
+     */
+    inline Index add(std::size_t bitoffset, std::size_t bitsize, std::size_t owner = 0);
+
+    /**
+     * @brief Adds copy of the @p index row of the @p table (including the current data of
+     *    the entry) to the table
+     *
+     * @param table
+     *    source table
+     * @param index
+     *    row of the @p table to be copied
+     * @param owner
+     *    index of the slave owning the entry
+     * @returns
+     *    index of the added row
+     */
+    inline Index add(const EntryTable &table, Index index, std::size_t owner);
+
+    /**
+     * @brief Copies data of the @p source row of the @p table into data of the @p index row
+     * @note Both rows are required to describe entries of the same size
+     */
+    inline void copy_data(Index index, const EntryTable &table, Index source);
+
+    /**
+     * @brief Updates data of the @p index entry from the Process Data Image @p pdi buffer
+     */
+    inline void read(Index index, config::types::Span<const uint8_t> pdi);
+
+    /**
+     * @brief Updates Process Data Image @p pdi buffer with data of the @p index entry
+     */
+    inline void write(Index index, config::types::Span<uint8_t> pdi) const;
+
+public: /* ---------------------------------------------------- Public getters ---------------------------------------------------- */
+
+    /// @returns number of rows of the table
+    inline std::size_t size() const;
+
+    /// @returns offset of the @p index entry in the PDI in bits
+    inline std::size_t get_bitoffset(Index index) const;
+    /// @returns size of the @p index entry in bits
+    inline std::size_t get_bitsize(Index index) const;
+    /// @returns index of the slave owning the @p index entry
+    inline std::size_t get_owner(Index index) const;
+    /// @returns kernel copying data of the @p index entry
+    inline Kernel get_kernel(Index index) const;
+
+    /// @returns data of the @p index entry
+    inline config::types::Span<uint8_t> get_data(Index index);
+    /// @returns data of the @p index entry
+    inline config::types::Span<const uint8_t> get_data(Index index) const;
+
+    /// @returns lock synchronising access to data of the @p index entry
+    inline config::types::QuickLock &get_lock(Index index) const;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Offsets of entries in the PDI (in bits)
+    std::pmr::vector<std::size_t> bitoffsets;
+    /// Sizes of entries (in bits)
+    std::pmr::vector<std::size_t> bitsizes;
+    /// Offsets of entries' data in the arena (with an additional past-the-end offset)
+    std::pmr::vector<std::size_t> data_offsets;
+    /// Indices of slaves owning entries
+    std::pmr::vector<std::size_t> owners;
+    /// Kernels copying data of entries
+    std::pmr::vector<Kernel> kernels;
+
+    /// Data of all entries
+    std::pmr::vector<uint8_t> arena;
+    /// Locks synchronising access to data of entries
+    mutable std::pmr::vector<config::types::QuickLock> locks;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::common::pdi
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/common/pdi/entry_table/entry_table.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,162 @@
+/* ============================================================================================================================ *//**
+ * @file       entry_table.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 1:06:22 pm
+ * @modified   Sunday, 18th October 2026 1:09:52 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of inline methods of the EntryTable class
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_PDI_ENTRY_TABLE_ENTRY_TABLE_H__
+#define __ETHERCAT_COMMON_PDI_ENTRY_TABLE_ENTRY_TABLE_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <cstring>
+// Private includes
+#include "ethercat/common/utilities/bit.hpp"
+#include "ethercat/common/pdi/entry_table.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::common::pdi {
+
+/* ========================================================= Public ctors ========================================================= */
+
+EntryTable::EntryTable(std::pmr::memory_resource *resource) :
+    bitoffsets{ resource },
+    bitsizes{ resource },
+    data_offsets(1, 0, resource),
+    owners{ resource },
+    kernels{ resource },
+    arena{ resource },
+    locks{ resource }
+{ }
+
+/* ======================================================== Public methods ======================================================== */
+
+void EntryTable::reserve(std::size_t rows, std::size_t bytes) {
+    bitoffsets.reserve(rows);
+    bitsizes.reserve(rows);
+    data_offsets.reserve(rows + 1);
+    owners.reserve(rows);
+    kernels.reserve(rows);
+    arena.reserve(bytes);
+    locks.reserve(rows);
+}
+
+
+EntryTable::Index EntryTable::add(std::size_t bitoffset, std::size_t bitsize, std::size_t owner) {
+
+    using namespace common::utilities::bit;
+
+    // Byte-aligned entries are copied as plain bytes
+    auto kernel = ((bitoffset % BITS_IN_BYTE == 0) and (bitsize % BITS_IN_BYTE == 0)) ?
+        Kernel::Bytes : Kernel::Bits;
+
+    bitoffsets.push_back(bitoffset);
+    bitsizes.push_back(bitsize);
+    owners.push_back(owner);
+    kernels.push_back(kernel);
+    locks.emplace_back();
+
+    // Allocate (zero-initialized) data of the entry
+    arena.resize(arena.size() + (bitsize + BITS_IN_BYTE - 1) / BITS_IN_BYTE, static_cast<uint8_t>(0));
+    data_offsets.push_back(arena.size());
+
+    return size() - 1;
+}
+
+
+EntryTable::Index EntryTable::add(const EntryTable &table, Index index, std::size_t owner) {
+
+    auto ret = add(table.bitoffsets[index], table.bitsizes[index], owner);
+    copy_data(ret, table, index);
+
+    return ret;
+}
+
+
+void EntryTable::copy_data(Index index, const EntryTable &table, Index source) {
+    auto data = table.get_data(source);
+    std::copy(data.begin(), data.end(), get_data(index).begin());
+}
+
+
+void EntryTable::read(Index index, config::types::Span<const uint8_t> pdi) {
+
+    using namespace common::utilities::bit;
+
+    std::scoped_lock guard{ locks[index] };
+
+    if(kernels[index] == Kernel::Bytes) {
+        std::memcpy(&arena[data_offsets[index]], pdi.data() + bitoffsets[index] / BITS_IN_BYTE, bitsizes[index] / BITS_IN_BYTE);
+    } else
+        copy_bits_from_bitshifted(pdi.data(), &arena[data_offsets[index]], bitsizes[index], bitoffsets[index]);
+}
+
+
+void EntryTable::write(Index index, config::types::Span<uint8_t> pdi) const {
+
+    using namespace common::utilities::bit;
+
+    std::scoped_lock guard{ locks[index] };
+
+    if(kernels[index] == Kernel::Bytes) {
+        std::memcpy(pdi.data() + bitoffsets[index] / BITS_IN_BYTE, &arena[data_offsets[index]], bitsizes[index] / BITS_IN_BYTE);
+    } else
+        copy_bits_to_bitshifted(&arena[data_offsets[index]], pdi.data(), bitsizes[index], bitoffsets[index]);
+}
+
+/* ======================================================== Public getters ======================================================== */
+
+std::size_t EntryTable::size() const {
+    return bitoffsets.size();
+}
+
+
+std::size_t EntryTable::get_bitoffset(Index index) const {
+    return bitoffsets[index];
+}
+
+
+std::size_t EntryTable::get_bitsize(Index index) const {
+    return bitsizes[index];
+}
+
+
+std::size_t EntryTable::get_owner(Index index) const {
+    return owners[index];
+}
+
+
+EntryTable::Kernel EntryTable::get_kernel(Index index) const {
+    return kernels[index];
+}
+
+
+config::types::Span<uint8_t> EntryTable::get_data(Index index) {
+    return config::types::Span<uint8_t>{ arena }.subspan(data_offsets[index], data_offsets[index + 1] - data_offsets[index]);
+}
+
+
+config::types::Span<const uint8_t> EntryTable::get_data(Index index) const {
+    return config::types::Span<const uint8_t>{ arena }.subspan(data_offsets[index], data_offsets[index + 1] - data_offsets[index]);
+}
+
+
+config::types::QuickLock &EntryTable::get_lock(Index index) const {
+    return locks[index];
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::common::pdi
+
+#endif
@@ -0,0 +1,139 @@
+/* ============================================================================================================================ *//**
+ * @file       image_buffer.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 1:14:13 pm
+ * @modified   Sunday, 18th October 2026 1:14:13 pm
+ * @project    ethercat-lib
+ * @brief      Definition of the page-backed buffer storing the Process Data Image
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_PDI_IMAGE_BUFFER_H__
+#define __ETHERCAT_COMMON_PDI_IMAGE_BUFFER_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstddef>
+#include <cstdint>
+// Private includes
+#include "ethercat/config.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::common::pdi {
+
+/* ========================================================= ImageBuffer ========================================================== */
+
+/**
+ * @brief Zero-initialized buffer storing the Process Data Image
+ * @details Buffer is placed in its own anonymous memory mapping, so that it is page-aligned (and
+ *    so aligned to the cache line) and never shares a page with other data. Pages of the mapping
+ *    are prefaulted when the buffer is allocated and - depending on the configuration (see
+ *    @ref config::pdi ) - locked in the memory and backed with huge pages, so that the bus I/O
+ *    never triggers a page fault.
+ */
+class ImageBuffer {
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Constructs an empty buffer
+    ImageBuffer() = default;
+
+    /**
+     * @brief Constructs zero-initialized buffer of the given @p size
+     *
+     * @throws std::system_error
+     *    if the buffer could not be allocated
+     */
+    explicit ImageBuffer(std::size_t size);
+
+    /// Disable copy-construction
+    ImageBuffer(const ImageBuffer &rbuffer) = delete;
+    /// Disable copy-asignment
+    ImageBuffer &operator=(const ImageBuffer &rbuffer) = delete;
+
+    /// Enable move-construction
+    ImageBuffer(ImageBuffer &&rbuffer) noexcept;
+    /// Enable move-asignment
+    ImageBuffer &operator=(ImageBuffer &&rbuffer) noexcept;
+
+    /// Releases the buffer
+    ~ImageBuffer();
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Replaces content of the buffer with @p size zero bytes (the buffer is reallocated)
+     *
+     * @throws std::system_error
+     *    if the buffer could not be allocated (the buffer is left empty)
+     */
+    void reset(std::size_t size);
+
+public: /* ---------------------------------------------------- Public getters ---------------------------------------------------- */
+
+    /// @returns pointer to data of the buffer
+    inline uint8_t *data();
+    /// @returns pointer to data of the buffer
+    inline const uint8_t *data() const;
+
+    /// @returns size of the buffer in bytes
+    inline std::size_t size() const;
+    /// @returns @c true if the buffer is empty
+    inline bool empty() const;
+
+    /// @returns iterator to the first byte of the buffer
+    inline uint8_t *begin();
+    /// @returns iterator to the first byte of the buffer
+    inline const uint8_t *begin() const;
+    /// @returns iterator past the last byte of the buffer
+    inline uint8_t *end();
+    /// @returns iterator past the last byte of the buffer
+    inline const uint8_t *end() const;
+
+    /// @returns reference to the @p index byte of the buffer
+    inline uint8_t &operator[](std::size_t index);
+    /// @returns reference to the @p index byte of the buffer
+    inline const uint8_t &operator[](std::size_t index) const;
+
+    /// @returns @c true if pages of the buffer are locked in the memory
+    inline bool is_locked() const;
+    /// @returns @c true if the buffer is backed with huge pages
+    inline bool is_huge() const;
+
+private: /* --------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /// Unmaps the buffer (if allocated) and resets it to the empty state
+    void release() noexcept;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Data of the buffer
+    uint8_t *buffer { nullptr };
+    /// Size of the buffer in bytes
+    std::size_t bytes { 0 };
+    /// Length of the mapping holding the buffer (whole number of pages)
+    std::size_t length { 0 };
+
+    /// @c true if pages of the buffer are locked in the memory
+    bool locked { false };
+    /// @c true if the buffer is backed with huge pages
+    bool huge { false };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::common::pdi
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/common/pdi/image_buffer/image_buffer.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,91 @@
+/* ============================================================================================================================ *//**
+ * @file       image_buffer.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 1:14:13 pm
+ * @modified   Sunday, 18th October 2026 1:14:13 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of inline methods of the ImageBuffer class
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_PDI_IMAGE_BUFFER_IMAGE_BUFFER_H__
+#define __ETHERCAT_COMMON_PDI_IMAGE_BUFFER_IMAGE_BUFFER_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Private includes
+#include "ethercat/common/pdi/image_buffer.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::common::pdi {
+
+/* ======================================================== Public getters ======================================================== */
+
+uint8_t *ImageBuffer::data() {
+    return buffer;
+}
+
+
+const uint8_t *ImageBuffer::data() const {
+    return buffer;
+}
+
+
+std::size_t ImageBuffer::size() const {
+    return bytes;
+}
+
+
+bool ImageBuffer::empty() const {
+    return (bytes == 0);
+}
+
+
+uint8_t *ImageBuffer::begin() {
+    return buffer;
+}
+
+
+const uint8_t *ImageBuffer::begin() const {
+    return buffer;
+}
+
+
+uint8_t *ImageBuffer::end() {
+    return buffer + bytes;
+}
+
+
+const uint8_t *ImageBuffer::end() const {
+    return buffer + bytes;
+}
+
+
+uint8_t &ImageBuffer::operator[](std::size_t index) {
+    return buffer[index];
+}
+
+
+const uint8_t &ImageBuffer::operator[](std::size_t index) const {
+    return buffer[index];
+}
+
+
+bool ImageBuffer::is_locked() const {
+    return locked;
+}
+
+
+bool ImageBuffer::is_huge() const {
+    return huge;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::common::pdi
+
+#endif
@@ -23,6 +23,7 @@
 #include "ethercat/common/utilities/traits.hpp"
 #include "ethercat/common/utilities/type_name.hpp"
 #include "ethercat/common/utilities/string.hpp"
+#include "ethercat/common/utilities/string_pool.hpp"
 
 /* ================================================================================================================================ */
 
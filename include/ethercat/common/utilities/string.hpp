@@ -16,6 +16,11 @@
 
 /* =========================================================== Includes =========================================================== */
 
+// Standard includes
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 // Private includes
 #include "ethercat/config.hpp"
 
@@ -36,6 +41,28 @@ enum class Color {
     Blue
 };
 
+/* ============================================================= Types ============================================================ */
+
+/**
+ * @brief Transparent hash of strings enabling lookups of std::string-keyed unordered 
+ *    containers with std::string_view keys (without constructing temporary strings)
+ */
+struct StringHash {
+
+    /// Enable heterogeneous lookup
+    using is_transparent = void;
+
+    /// @returns hash of the @p str
+    inline std::size_t operator()(std::string_view str) const;
+
+};
+
+/**
+ * @brief Hash map keyed with strings supporting lookups with std::string_view keys
+ */
+template<typename T>
+using StringMap = std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
 /* ========================================================= Declarations ========================================================= */
 
 /**
@@ -27,6 +27,12 @@
 
 namespace ethercat::common::utilities {
 
+/* ============================================================= Types ============================================================ */
+
+std::size_t StringHash::operator()(std::string_view str) const {
+    return std::hash<std::string_view>{}(str);
+}
+
 /* ========================================================== Definitions ========================================================= */
 
 std::string byte_to_str(uint8_t byte) {
@@ -0,0 +1,174 @@
+/* ============================================================================================================================ *//**
+ * @file       string_pool.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:59:08 pm
+ * @modified   Sunday, 18th October 2026 1:45:56 pm
+ * @project    ethercat-lib
+ * @brief      Definition of the pool of interned strings
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_UTILITIES_STRING_POOL_H__
+#define __ETHERCAT_COMMON_UTILITIES_STRING_POOL_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+// Private includes
+#include "ethercat/common/utilities/string.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::common::utilities {
+
+/* ============================================================ Symbol ============================================================ */
+
+/**
+ * @brief Handle of the string interned in the StringPool
+ * @details Symbols of the same pool are equal if and only if they refer to equal strings, so
+ *    comparing symbols costs a single pointer comparison. Default-constructed symbol refers
+ *    to the empty string that does not belong to any pool.
+ */
+class Symbol {
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Constructs symbol referring to the empty string
+    Symbol() = default;
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    /// @retval true if both symbols refer to the same interned string @retval false otherwise
+    constexpr bool operator==(const Symbol &rsymbol) const;
+    /// @retval true if symbols refer to different interned strings @retval false otherwise
+    constexpr bool operator!=(const Symbol &rsymbol) const;
+
+    /// @returns view of the interned string
+    inline operator std::string_view() const;
+
+public: /* ---------------------------------------------------- Public getters ---------------------------------------------------- */
+
+    /// @returns view of the interned string (valid as long as the pool is alive)
+    inline std::string_view str() const;
+
+private: /* ---------------------------------------------------- Private ctors ---------------------------------------------------- */
+
+    /// Constructs symbol referring to the interned @p str
+    constexpr explicit Symbol(const std::string *str);
+
+private: /* --------------------------------------------------- Private friends --------------------------------------------------- */
+
+    /// Make pool a friend to let it create symbols
+    friend class StringPool;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Empty string referred by default-constructed symbols
+    static inline const std::string Empty { };
+
+    /// Interned string
+    const std::string *string { &Empty };
+
+};
+
+/// Prints interned string of the @p symbol to the @p stream
+inline std::ostream &operator<<(std::ostream &stream, const Symbol &symbol);
+
+/* ========================================================== StringPool ========================================================== */
+
+/**
+ * @brief Pool of interned strings
+ * @details Pool stores a single copy of each interned string. Interned strings are never moved
+ *    nor released until the pool is destroyed, so symbols (and views of strings they refer to)
+ *    stay valid for the lifetime of the pool.
+ *
+ * @note Pool is thread-safe (lookups may be performed concurrently, interning is exclusive)
+ * @note Once all strings have been interned, the pool can be frozen (see freeze()). Lookups in
+ *    the frozen pool take no lock.
+ */
+class StringPool {
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Constructs an empty pool
+    StringPool() = default;
+
+    /// Disable copy-construction (symbols refer to strings owned by the pool)
+    StringPool(const StringPool &rpool) = delete;
+    /// Disable copy-asignment (symbols refer to strings owned by the pool)
+    StringPool &operator=(const StringPool &rpool) = delete;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @param str
+     *    string to be interned
+     * @returns
+     *    symbol of the interned @p str (the already existing one if @p str has been interned before)
+     *
+     * @throws std::logic_error
+     *    if the pool is frozen and @p str has not been interned before
+     */
+    inline Symbol intern(std::string_view str);
+
+    /**
+     * @param str
+     *    string to be found
+     *
+     * @retval symbol
+     *    of the @p str if it has been interned in the pool
+     * @retval empty
+     *    optional otherwise
+     */
+    inline std::optional<Symbol> find(std::string_view str) const;
+
+    /// @returns number of strings interned in the pool
+    inline std::size_t size() const;
+
+    /**
+     * @brief Freezes the pool, i.e. makes it read-only. Lookups in the frozen pool take no lock.
+     */
+    inline void freeze();
+
+    /**
+     * @brief Unfreezes the pool, so that new strings can be interned again
+     * @note Must not be called concurrently with lookups started while the pool was frozen
+     */
+    inline void thaw();
+
+    /// @returns @c true if the pool is frozen
+    inline bool is_frozen() const;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Lock synchronizing access to the pool (not taken by lookups in the frozen pool)
+    mutable std::shared_mutex lock;
+    /// @c true if the pool is frozen
+    std::atomic<bool> frozen { false };
+    /// Interned strings (node-based container keeps strings in place on rehashing)
+    std::unordered_set<std::string, StringHash, std::equal_to<>> strings;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::common::utilities
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/common/utilities/string_pool/string_pool.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,136 @@
+/* ============================================================================================================================ *//**
+ * @file       string_pool.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:59:08 pm
+ * @modified   Sunday, 18th October 2026 1:45:56 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of inline methods of the Symbol and StringPool classes
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_UTILITIES_STRING_POOL_STRING_POOL_H__
+#define __ETHERCAT_COMMON_UTILITIES_STRING_POOL_STRING_POOL_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <mutex>
+#include <stdexcept>
+// Private includes
+#include "ethercat/common/utilities/string_pool.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::common::utilities {
+
+/* ============================================================ Symbol ============================================================ */
+
+constexpr bool Symbol::operator==(const Symbol &rsymbol) const {
+    return (string == rsymbol.string);
+}
+
+
+constexpr bool Symbol::operator!=(const Symbol &rsymbol) const {
+    return (string != rsymbol.string);
+}
+
+
+Symbol::operator std::string_view() const {
+    return *string;
+}
+
+
+std::string_view Symbol::str() const {
+    return *string;
+}
+
+
+constexpr Symbol::Symbol(const std::string *str) :
+    string{ str }
+{ }
+
+
+std::ostream &operator<<(std::ostream &stream, const Symbol &symbol) {
+    return stream << symbol.str();
+}
+
+/* ========================================================== StringPool ========================================================== */
+
+Symbol StringPool::intern(std::string_view str) {
+
+    // Look for the already interned string
+    if(auto symbol = find(str); symbol.has_value())
+        return *symbol;
+
+    // Frozen pool is read-only
+    if(is_frozen())
+        throw std::logic_error{ "[ethercat::common::utilities::StringPool::intern] Cannot intern new string into the frozen pool" };
+
+    std::unique_lock guard{ lock };
+
+    // Pool might have been frozen (with the string interned) in the meantime
+    if(is_frozen()) {
+        if(auto it = strings.find(str); it != strings.end())
+            return Symbol{ &*it };
+        throw std::logic_error{ "[ethercat::common::utilities::StringPool::intern] Cannot intern new string into the frozen pool" };
+    }
+
+    // Intern the string (if it has not been interned concurrently in the meantime)
+    return Symbol{ &*strings.emplace(str).first };
+}
+
+
+std::optional<Symbol> StringPool::find(std::string_view str) const {
+
+    auto lookup = [this, str]() {
+        if(auto it = strings.find(str); it != strings.end())
+            return std::optional<Symbol>{ Symbol{ &*it } };
+        else
+            return std::optional<Symbol>{};
+    };
+
+    // Frozen pool is not modified, so it can be searched without locking
+    if(is_frozen())
+        return lookup();
+
+    std::shared_lock guard{ lock };
+    return lookup();
+}
+
+
+std::size_t StringPool::size() const {
+
+    // Frozen pool is not modified, so it can be inspected without locking
+    if(is_frozen())
+        return strings.size();
+
+    std::shared_lock guard{ lock };
+    return strings.size();
+}
+
+
+void StringPool::freeze() {
+    // Wait for pending interning to finish
+    std::unique_lock guard{ lock };
+    frozen.store(true, std::memory_order_release);
+}
+
+
+void StringPool::thaw() {
+    std::unique_lock guard{ lock };
+    frozen.store(false, std::memory_order_release);
+}
+
+
+bool StringPool::is_frozen() const {
+    return frozen.load(std::memory_order_acquire);
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::common::utilities
+
+#endif
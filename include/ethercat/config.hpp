@@ -17,7 +17,9 @@
 /* =========================================================== Includes =========================================================== */
 
 // Standard includes
+#include <chrono>
 #include <span>
+#include <string_view>
 // External includes
 #include <boost/beast/core/static_string.hpp>
 #include <boost/dynamic_bitset.hpp>
@@ -72,6 +74,173 @@ namespace types {
  */
 constexpr bool BitAlignedPdoSupport = true;
 
+/* ======================================================= SDO configuration ====================================================== */
+
+namespace sdo {
+
+    /**
+     * @brief Default size of the chunk [B] passed between the user code and the implementation 
+     *    at once by the streaming SDO interface (see Slave::SdoStream)
+     */
+    constexpr std::size_t DefaultStreamChunkSize = 4096;
+
+    /**
+     * @brief If @c true, library measures latency and outcome of all SDO accesses performed by
+     *    the Slave interface and collects them in per-object statistics (see Slave::SdoStatistics)
+     */
+    constexpr bool CollectStatistics = true;
+
+    /**
+     * @brief Number of (logarithmic) buckets of the SDO latency histograms (the last bucket collects
+     *    accesses longer than 2^(n-2) us)
+     */
+    constexpr std::size_t StatisticsHistogramBucketsNum = 24;
+
+}
+
+/* ======================================================= ENI configuration ====================================================== */
+
+namespace eni {
+
+    /**
+     * @brief If @c true, Master constructed from the path to the ENI file loads the file with
+     *    eni::configruation_from_file_cached(), i.e. keeps compiled (binary) image of the parsed 
+     *    ENI next to the file and reuses it at subsequent starts as long as the file's content
+     *    does not change
+     */
+    constexpr bool UseCompiledCache = true;
+
+    /**
+     * @brief Extension appended to the path of the ENI file to obtain default path to its
+     *    compiled cache
+     */
+    constexpr std::string_view CompiledCacheExtension = ".cache";
+
+    /**
+     * @brief If @c true, ENI files are parsed in place in their private memory mapping instead of
+     *    being read into the memory. As Linux may propagate later changes of the file to pages of
+     *    the mapping that have not been modified by the parser, files that are used with this option
+     *    enabled should be replaced atomically (e.g. renamed over) rather than rewritten in place
+     */
+    constexpr bool MapSourceFiles = true;
+
+}
+
+/* ===================================================== Master configuration ===================================================== */
+
+namespace master {
+
+    /**
+     * @brief Number of threads preparing PDOs of slaves in parallel when the Master is constructed
+     *    ( @c 0 stands for number of hardware threads, @c 1 disables parallel construction). Slave 
+     *    factory is always called serially, in order of slaves in the ENI
+     */
+    constexpr std::size_t ConstructionThreadsNum = 0;
+
+}
+
+/* ======================================================= PDI configuration ====================================================== */
+
+namespace pdi {
+
+    /**
+     * @brief Size [B] of the cache line that buffers of the Process Data Image (and their locks) are
+     *    aligned to, so that input and output images never share a line with each other nor with 
+     *    other data of the master
+     */
+    constexpr std::size_t CacheLineSize = 64;
+
+    /**
+     * @brief If @c true, buffers of the Process Data Image are locked in the memory (mlock) when 
+     *    they are allocated, so that they are never paged out
+     * 
+     * @note Locking requires the process to have sufficient RLIMIT_MEMLOCK limit (or CAP_IPC_LOCK
+     *    capability). If the buffer cannot be locked, it is used unlocked (see 
+     *    common::pdi::ImageBuffer::is_locked())
+     */
+    constexpr bool LockMemory = true;
+
+    /**
+     * @brief If @c true, buffers of the Process Data Image are backed with huge pages (MAP_HUGETLB).
+     *    If no huge page is available, regular pages are used (see common::pdi::ImageBuffer::is_huge())
+     */
+    constexpr bool UseHugePages = false;
+
+    /**
+     * @brief Size [B] of the huge page used when @ref UseHugePages is @c true (has to match the
+     *    default huge page size of the system)
+     */
+    constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+
+}
+
+/* ===================================================== Mailbox configuration ==================================================== */
+
+namespace mailbox {
+
+    /**
+     * @brief Minimal slack [us] that Master::write_bus() leaves free at the end of the bus cycle
+     *    when serving mailbox tasks scheduled with Master::schedule_mailbox_task()
+     */
+    constexpr std::chrono::microseconds SlackGuard { 50 };
+
+    /**
+     * @brief Initial estimate [us] of the execution time of the mailbox task that does not provide 
+     *    estimate on its own (refined at runtime with the measured execution times)
+     */
+    constexpr std::chrono::microseconds DefaultTaskEstimate { 200 };
+
+    /**
+     * @brief Number of cycles after which the mailbox task that did not fit into the cycle's slack
+     *    is executed regardless of the remaining slack (prevents starvation of tasks longer than 
+     *    the bus cycle); @c 0 disables forced execution
+     */
+    constexpr std::size_t MaxDeferredCycles = 100;
+
+}
+
+/* ================================================== Init commands configuration ================================================= */
+
+namespace init_cmds {
+
+    /**
+     * @brief If @c true, Master::set_state() and Slave::set_state() execute CoE init commands
+     *    described in the ENI (<Mailbox>.<CoE>.<InitCmds>) at the corresponding ESM transitions
+     *    before (or - for transitions originating from INIT/BOOT state - after) requesting state
+     *    change from the implementation
+     * 
+     * @note This option should stay disabled for implementations whose underlying master stack 
+     *    replays the ENI file on its own (e.g. CIFX-based masters loaded with the ENI file), as
+     *    init commands would be issued twice in such a case
+     */
+    constexpr bool ExecuteAtStateChange = false;
+
+    /**
+     * @brief If @c true, library will coalesce sequences of CoE init commands writing subsequent
+     *    subindices of a single object (followed by the write of the number of entries to the 
+     *    subindex 0, as it is done e.g. when configuring PDO mapping and assignment) into a single
+     *    Complete Access download
+     *
+     * @note Coalescing is applied only to sequences whose entries have equal, byte-aligned sizes
+     *    (as it is the case for PDO mapping/assignment objects) so that concatenated data forms a 
+     *    valid Complete Access image
+     * @note Even if enabled, coalescing is applied only to slaves whose ENI description already
+     *    contains Complete Access init commands (i.e. slaves that the configuration tool found
+     *    to support Complete Access). Other slaves execute their commands as described.
+     */
+    constexpr bool CoalesceCompleteAccess = false;
+
+    /**
+     * @brief Maximal number of threads executing init commands of slaves in parallel at
+     *    the state change of the Master (if @c 0 , number of hardware threads is used)
+     * @note Values other than @c 1 require SDO methods of the slave implementation to be
+     *    safe to call concurrently for distinct slaves (which many master stacks are not),
+     *    so that commands are executed sequentially by default.
+     */
+    constexpr std::size_t ExecutionThreadsNum = 1;
+
+}
+
 /* =================================================== Translation configuration ================================================== */
 
 namespace translation {
@@ -19,6 +19,7 @@
 
 #include "ethercat/descriptors/types.hpp"
 #include "ethercat/descriptors/object.hpp"
+#include "ethercat/descriptors/object_dictionary.hpp"
 
 /* ================================================================================================================================ */
 
@@ -0,0 +1,284 @@
+/* ============================================================================================================================ *//**
+ * @file       object_dictionary.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:39:17 am
+ * @modified   Sunday, 18th October 2026 11:39:17 am
+ * @project    ethercat-lib
+ * @brief      Definition of the ObjectDictionary class providing run-time description of the Objects Dictionary of the slave
+ *             device
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_DESCRIPTORS_OBJECT_DICTIONARY_H__
+#define __ETHERCAT_DESCRIPTORS_OBJECT_DICTIONARY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+// Private includes
+#include "ethercat/config.hpp"
+#include "ethercat/types.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::descriptors {
+
+/* ======================================================= ObjectDictionary ======================================================= */
+
+/**
+ * @brief Class providing run-time description of the Objects Dictionary of the slave device
+ * @details Unlike @ref Object , the ObjectDictionary is filled at runtime (e.g. with descriptions 
+ *    of objects uploaded from the device). Entries are stored in a flat vector sorted by
+ *    (index, subindex) pairs so that both objects and their entries are looked up with a binary 
+ *    search. Dictionary can be saved to/loaded from a compact binary file so that the description 
+ *    can be reused across application restarts without rescanning the device. Files are keyed
+ *    with the identity of the device ( @see make_file_name() ).
+ */
+class ObjectDictionary {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /**
+     * @brief Identity of the device type that the dictionary describes (as given in the 
+     *    <Info> section of the slave's ENI description)
+     */
+    struct Identity {
+
+        /// Vendor ID of the device
+        uint32_t vendor_id;
+        /// Product code of the device
+        uint32_t product_code;
+        /// Revision number of the device
+        uint32_t revision_no;
+
+        /// Compares identities
+        inline bool operator==(const Identity &ridentity) const = default;
+
+    };
+
+    /**
+     * @brief Description of the single entry (subindex) of the object
+     */
+    struct Entry {
+
+        /// Index of the object
+        uint16_t index;
+        /// Subindex of the entry
+        uint8_t subindex;
+        /// Name of the entry
+        std::string name;
+        /// Type of the entry
+        ::ethercat::types::Type type;
+        /// Bitoffset of the entry in the object's footprint (as seen with Complete Access)
+        std::size_t bitoffset { 0 };
+
+    };
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /**
+     * @brief Constructs an empty dictionary describing device of the given @p identity
+     * 
+     * @param identity 
+     *    identity of the device
+     */
+    inline ObjectDictionary(Identity identity);
+
+public: /* ---------------------------------------------------- Public getters ---------------------------------------------------- */
+
+    /**
+     * @returns 
+     *    identity of the device described by the dictionary
+     */
+    inline Identity get_identity() const;
+
+    /**
+     * @returns 
+     *    number of entries stored in the dictionary
+     */
+    inline std::size_t size() const;
+
+    /**
+     * @returns 
+     *    @retval @c true if dictionary contains no entries
+     *    @retval @c false otherwise
+     */
+    inline bool empty() const;
+
+    /**
+     * @returns 
+     *    all entries of the dictionary sorted by (index, subindex)
+     */
+    inline const std::vector<Entry> &get_entries() const;
+
+    /**
+     * @returns 
+     *    list of indices of objects described by the dictionary (in ascending order)
+     */
+    std::vector<uint16_t> list_objects() const;
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Adds an @p entry to the dictionary. If dictionary already contains entry with the 
+     *    same address, it is replaced
+     * 
+     * @param entry 
+     *    entry to be added
+     */
+    void add_entry(Entry entry);
+
+    /**
+     * @param index 
+     *    index of the object
+     * @returns 
+     *    @retval @c true if dictionary contains at least one entry of the object
+     *    @retval @c false otherwise
+     */
+    inline bool has_object(uint16_t index) const;
+
+    /**
+     * @param index 
+     *    index of the object
+     * @returns 
+     *    entries of the object with the given @p index (sorted by subindex; empty if
+     *    object is not described by the dictionary)
+     */
+    inline config::types::Span<const Entry> get_object(uint16_t index) const;
+
+    /**
+     * @param index 
+     *    index of the object
+     * @param subindex 
+     *    subindex of the entry
+     * @returns 
+     *    @retval @c true if dictionary contains the entry
+     *    @retval @c false otherwise
+     */
+    inline bool has_entry(uint16_t index, uint8_t subindex) const;
+
+    /**
+     * @param index 
+     *    index of the object
+     * @param subindex 
+     *    subindex of the entry
+     * @returns 
+     *    description of the entry
+     * 
+     * @throws std::out_of_range
+     *    if dictionary does not contain the entry
+     */
+    inline const Entry &get_entry(uint16_t index, uint8_t subindex) const;
+
+    /**
+     * @param name 
+     *    name of the entry
+     * @returns 
+     *    description of the first entry with the given @p name
+     * 
+     * @throws std::out_of_range
+     *    if dictionary does not contain the entry
+     */
+    inline const Entry &get_entry(std::string_view name) const;
+
+public: /* -------------------------------------------------- Public I/O methods -------------------------------------------------- */
+
+    /**
+     * @brief Writes binary image of the dictionary to the @p stream
+     * 
+     * @param stream 
+     *    target stream
+     * 
+     * @throws std::ios_base::failure
+     *    if writing to the @p stream fails
+     */
+    void save(std::ostream &stream) const;
+
+    /**
+     * @brief Writes binary image of the dictionary to the file at the given @p path
+     * 
+     * @param path 
+     *    path to the target file
+     * 
+     * @throws std::ios_base::failure
+     *    if file could not be written
+     */
+    void save(const std::filesystem::path &path) const;
+
+    /**
+     * @brief Reads dictionary from the binary image stored in the @p stream
+     * 
+     * @param stream 
+     *    source stream
+     * @returns 
+     *    loaded dictionary
+     * 
+     * @throws std::ios_base::failure
+     *    if reading from the @p stream fails
+     * @throws std::runtime_error
+     *    if binary image is invalid
+     */
+    static ObjectDictionary load(std::istream &stream);
+
+    /**
+     * @brief Reads dictionary from the binary image stored in the file at the given @p path
+     * 
+     * @param path 
+     *    path to the source file
+     * @returns 
+     *    loaded dictionary
+     * 
+     * @throws std::ios_base::failure
+     *    if file could not be read
+     * @throws std::runtime_error
+     *    if binary image is invalid
+     */
+    static ObjectDictionary load(const std::filesystem::path &path);
+
+    /**
+     * @param identity 
+     *    identity of the device
+     * @returns 
+     *    canonical name of the file storing dictionary of the device with the given @p identity
+     *    (<vendor_id>_<product_code>_<revision_no>.od with identifiers given as 8-digit hex numbers)
+     */
+    static std::string make_file_name(Identity identity);
+
+private: /* --------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /**
+     * @returns 
+     *    iterator to the first entry whose address is not less than (index, subindex)
+     */
+    inline std::vector<Entry>::const_iterator lower_bound(uint16_t index, uint8_t subindex) const;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Identity of the described device
+    Identity identity;
+
+    /// Entries of the dictionary (sorted by (index, subindex))
+    std::vector<Entry> entries;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::descriptors
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/descriptors/object_dictionary/object_dictionary.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,127 @@
+/* ============================================================================================================================ *//**
+ * @file       object_dictionary.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:39:17 am
+ * @modified   Sunday, 18th October 2026 11:39:17 am
+ * @project    ethercat-lib
+ * @brief      Definition of inline methods of the ObjectDictionary class
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_DESCRIPTORS_OBJECT_DICTIONARY_OBJECT_DICTIONARY_H__
+#define __ETHERCAT_DESCRIPTORS_OBJECT_DICTIONARY_OBJECT_DICTIONARY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <stdexcept>
+#include <sstream>
+#include <iomanip>
+// Private includes
+#include "ethercat/descriptors/object_dictionary.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::descriptors {
+
+/* ========================================================= Public ctors ========================================================= */
+
+ObjectDictionary::ObjectDictionary(Identity identity) :
+    identity{ identity }
+{ }
+
+/* ======================================================== Public getters ======================================================== */
+
+ObjectDictionary::Identity ObjectDictionary::get_identity() const {
+    return identity;
+}
+
+
+std::size_t ObjectDictionary::size() const {
+    return entries.size();
+}
+
+
+bool ObjectDictionary::empty() const {
+    return entries.empty();
+}
+
+
+const std::vector<ObjectDictionary::Entry> &ObjectDictionary::get_entries() const {
+    return entries;
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+bool ObjectDictionary::has_object(uint16_t index) const {
+    auto it = lower_bound(index, 0);
+    return (it != entries.end()) and (it->index == index);
+}
+
+
+config::types::Span<const ObjectDictionary::Entry> ObjectDictionary::get_object(uint16_t index) const {
+
+    // Find range of entries of the object
+    auto begin = lower_bound(index, 0);
+    auto end   = std::find_if(begin, entries.end(), [index](const Entry &entry) { return entry.index != index; });
+
+    return config::types::Span<const Entry>{ begin, end };
+}
+
+
+bool ObjectDictionary::has_entry(uint16_t index, uint8_t subindex) const {
+    auto it = lower_bound(index, subindex);
+    return (it != entries.end()) and (it->index == index) and (it->subindex == subindex);
+}
+
+
+const ObjectDictionary::Entry &ObjectDictionary::get_entry(uint16_t index, uint8_t subindex) const {
+
+    auto it = lower_bound(index, subindex);
+
+    // Check if entry has been found
+    if((it == entries.end()) or (it->index != index) or (it->subindex != subindex)) {
+        std::stringstream ss;
+        ss << "[ethercat::descriptors::ObjectDictionary::get_entry] Dictionary has no entry at "
+           << "0x" << std::hex << std::setw(4) << std::setfill('0') << index << ":"
+           << std::dec << static_cast<unsigned>(subindex);
+        throw std::out_of_range{ ss.str() };
+    }
+
+    return *it;
+}
+
+
+const ObjectDictionary::Entry &ObjectDictionary::get_entry(std::string_view name) const {
+
+    auto it = std::find_if(entries.begin(), entries.end(), [name](const Entry &entry) { return entry.name == name; });
+
+    // Check if entry has been found
+    if(it == entries.end()) {
+        std::stringstream ss;
+        ss << "[ethercat::descriptors::ObjectDictionary::get_entry] Dictionary has no entry named '" << name << "'";
+        throw std::out_of_range{ ss.str() };
+    }
+
+    return *it;
+}
+
+/* ======================================================== Private methods ======================================================= */
+
+std::vector<ObjectDictionary::Entry>::const_iterator ObjectDictionary::lower_bound(uint16_t index, uint8_t subindex) const {
+    return std::lower_bound(entries.begin(), entries.end(), std::pair{ index, subindex },
+        [](const Entry &entry, const std::pair<uint16_t, uint8_t> &address) {
+            return std::pair{ entry.index, entry.subindex } < address;
+        }
+    );
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::descriptors
+
+#endif
@@ -21,6 +21,7 @@
 #include "ethercat/eni/slave.hpp"
 #include "ethercat/eni/master.hpp"
 #include "ethercat/eni/configuration.hpp"
+#include "ethercat/eni/validation.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
 
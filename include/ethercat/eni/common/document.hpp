@@ -0,0 +1,499 @@
+/* ============================================================================================================================ *//**
+ * @file       document.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:51:46 am
+ * @modified   Sunday, 18th October 2026 1:40:45 pm
+ * @project    ethercat-lib
+ * @brief      Definition of the Document class providing arena-allocated representation of the parsed ENI (XML) file
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_COMMON_DOCUMENT_H__
+#define __ETHERCAT_COMMON_ENI_COMMON_DOCUMENT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+// Private includes
+#include "ethercat/eni/common/path.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni::details {
+
+/* =========================================================== Document =========================================================== */
+
+/**
+ * @brief Arena-allocated representation of the parsed ENI (XML) file used as a backend of the
+ *    Element class
+ * @details Document consists of a contiguous table of nodes linked with indices and of a single
+ *    text buffer that keys and values of nodes refer to with offsets (for parsed documents it is
+ *    the source text itself with entities decoded in place, followed by a small buffer of strings
+ *    created by the parser). In result parsing performs no per-node allocations, files are parsed
+ *    directly in their memory mapping (see parse_file()) and the document can be stored in a 
+ *    binary image (see save_image()) that is usable directly after being mapped into the memory
+ *    (see map_image()). The produced tree follows layout of the boost::property_tree 
+ *    representation of XML files that the library used to rely on:
+ *
+ *       - root node of the document has empty key and children representing top-level elements
+ *       - attributes of the element are stored as children of the "<xmlattr>" child being the
+ *         first child of the element
+ *       - text content of the element is stored as its value
+ *
+ *    In order to limit memory footprint, document does not store comments, processing
+ *    instructions and whitespace-only text segments.
+ *
+ *    Keys of nodes are interned, i.e. all nodes having equal keys refer to the same string of
+ *    the text. In result keys can be compared by their offsets (see find_symbol()).
+ *
+ * @note Document is not copyable nor movable as elements refer to its nodes. It is meant to be 
+ *    shared with std::shared_ptr
+ */
+class Document {
+
+public: /* ------------------------------------------------------ Public types ---------------------------------------------------- */
+
+    /// Type of indices of nodes and offsets of strings
+    using index_type = std::uint32_t;
+
+public: /* ---------------------------------------------------- Public constants -------------------------------------------------- */
+
+    /// Key of the node's child holding XML attributes
+    static constexpr std::string_view ATTRIBUTES_KEY { "<xmlattr>" };
+
+    /// Index marking absence of the linked node
+    static constexpr index_type NO_NODE { UINT32_MAX };
+
+    /// Number of entries of the cache of resolved paths
+    static constexpr std::size_t RESOLVED_PATHS_CACHE_SIZE { 64 };
+    /// Number of subsequent entries of the cache of resolved paths probed for the given path
+    static constexpr std::size_t RESOLVED_PATHS_CACHE_PROBES { 4 };
+
+    /// Version of the binary image format produced by save_image()
+    static constexpr std::uint32_t IMAGE_VERSION { 1 };
+
+public: /* ------------------------------------------------------ Public types ---------------------------------------------------- */
+
+    /**
+     * @brief Node of the document (nodes are stored in pre-order, i.e. each node is placed after
+     *    its parent and its preceding siblings)
+     */
+    struct Node {
+
+        /// Offset of the key (name of the XML element or attribute) in the document's text
+        index_type key_offset { 0 };
+        /// Size of the key
+        index_type key_size { 0 };
+        /// Offset of the value (text content of the XML element or value of the attribute) in the document's text
+        index_type value_offset { 0 };
+        /// Size of the value
+        index_type value_size { 0 };
+
+        /// Parent of the node
+        index_type parent { NO_NODE };
+        /// First child of the node
+        index_type first_child { NO_NODE };
+        /// Last child of the node
+        index_type last_child { NO_NODE };
+        /// Previous sibling of the node
+        index_type prev_sibling { NO_NODE };
+        /// Next sibling of the node
+        index_type next_sibling { NO_NODE };
+        /// Number of direct children of the node
+        index_type children_num { 0 };
+
+    };
+
+    /**
+     * @brief Key interned by the document (identified by the offset and size of the string 
+     *    shared by all nodes having the key)
+     */
+    struct Symbol {
+
+        /// Offset of the key in the document's text ( @ref NO_NODE if no node has the key )
+        index_type offset { NO_NODE };
+        /// Size of the key
+        index_type size { 0 };
+
+        /// @returns @c true if any node of the document has the key
+        constexpr bool is_valid() const { return offset != NO_NODE; }
+
+    };
+
+    /**
+     * @brief Precompiled path with keys resolved to symbols interned by the document
+     */
+    struct ResolvedPath {
+
+        /// Symbols of subsequent keys of the path
+        std::array<Symbol, Path::MAX_DEPTH> symbols { };
+        /// Number of keys of the path
+        std::size_t depth { 0 };
+        /// @c false if any key of the path is not present in the document (path cannot be found)
+        bool valid { false };
+
+    };
+
+    /// Bidirectional iterator over direct children of the node
+    class iterator;
+    /// Reverse iterator over direct children of the node
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+public: /* ------------------------------------------------- Public ctors & dtors ------------------------------------------------- */
+
+    /// Constructs an empty document (containing only the root node)
+    Document();
+
+    /// Disable copy-construction
+    Document(const Document &rdoc) = delete;
+    /// Disable copy-asignment
+    Document &operator=(const Document &rdoc) = delete;
+
+    /// Disable move-construction
+    Document(Document &&rdoc) = delete;
+    /// Disable move-asignment
+    Document &operator=(Document &&rdoc) = delete;
+
+public: /* ------------------------------------------------- Public static methods ------------------------------------------------ */
+
+    /**
+     * @brief Parses XML @p source into the document
+     *
+     * @param source
+     *    XML text to be parsed (taken over by the document)
+     * @returns
+     *    parsed document
+     *
+     * @throws std::runtime_error
+     *    if @p source is not a well-formed XML document
+     */
+    static std::shared_ptr<Document> parse(std::string source);
+
+    /**
+     * @brief Parses XML file located at @p path
+     * @details The file is mapped into the memory (privately, i.e. copy-on-write) and parsed in
+     *    place, so that keys and values of the document refer directly to the mapping. In result
+     *    the source text is never copied (only pages holding XML entities are duplicated by the 
+     *    kernel when entities are decoded). If the file cannot be mapped, it is read into the memory.
+     *
+     * @param path
+     *    path to the file
+     * @returns
+     *    parsed document
+     *
+     * @throws std::runtime_error
+     *    if file could not be read or is not a well-formed XML document
+     */
+    static std::shared_ptr<Document> parse_file(const std::filesystem::path &path);
+
+    /**
+     * @brief Reads and parses XML document from the @p stream
+     *
+     * @param stream
+     *    source stream
+     * @returns
+     *    parsed document
+     *
+     * @throws std::runtime_error
+     *    if stream could not be read or does not contain a well-formed XML document
+     */
+    static std::shared_ptr<Document> parse_stream(std::istream &stream);
+
+    /**
+     * @brief Creates an independent document holding copy of the subtree rooted at @p node
+     *    (root of the new document holds value and children of the @p node )
+     *
+     * @param doc
+     *    document holding the @p node
+     * @param node
+     *    root of the subtree to be copied
+     * @returns
+     *    created document
+     */
+    static std::shared_ptr<Document> copy_subtree(const Document &doc, const Node &node);
+
+    /**
+     * @brief Calculates hash of the XML @p source used to key binary images of documents
+     *
+     * @param source
+     *    XML text
+     * @returns
+     *    64-bit hash of the @p source
+     */
+    static std::uint64_t hash(std::string_view source);
+
+    /**
+     * @brief Maps binary image of the document produced by save_image() from the file located 
+     *    at @p path
+     * @details Image holds table of nodes and the text buffer in the same form as they are used
+     *    by the document, so that the returned document refers directly to the mapped file (it
+     *    is only validated before use). The mapping is held by the document for its whole lifetime.
+     *
+     * @param path
+     *    path to the image file
+     * @param source_hash
+     *    expected hash of the XML source the image has been produced from
+     * @returns
+     *    mapped document or @c nullptr if the file does not exist, is not a valid image of the 
+     *    current version or has been produced from a different source
+     */
+    static std::shared_ptr<Document> map_image(const std::filesystem::path &path, std::uint64_t source_hash);
+
+    /**
+     * @brief Reads and parses XML file located at @p path using binary image cached at 
+     *    @p image_path , if it is up-to-date. Otherwise parses the file and (re)writes the image.
+     *
+     * @param path
+     *    path to the XML file
+     * @param image_path
+     *    path to the cached image of the document
+     * @returns
+     *    parsed document
+     *
+     * @throws std::runtime_error
+     *    if file could not be read or is not a well-formed XML document
+     * 
+     * @note Failure to write the image is not reported, as the cache is an optimization only
+     */
+    static std::shared_ptr<Document> parse_file_cached(
+        const std::filesystem::path &path,
+        const std::filesystem::path &image_path
+    );
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /// @returns reference to the root node of the document
+    inline Node &get_root();
+
+    /// @returns constant reference to the root node of the document
+    inline const Node &get_root() const;
+
+    /// @returns number of nodes in the document
+    inline std::size_t get_nodes_num() const;
+
+    /// @returns path to the XML file the document has been parsed from (empty if not parsed from file)
+    inline const std::filesystem::path &get_source_path() const;
+
+    /// @returns hash of the XML file the document has been parsed from (see hash(); @c 0 if not parsed from file)
+    inline std::uint64_t get_source_hash() const;
+
+    /// @returns @c true if the document refers to the binary image mapped with map_image() (i.e. the XML has not been parsed)
+    inline bool is_from_image() const;
+
+    /// @returns key of the @p node
+    inline std::string_view get_key(const Node &node) const;
+
+    /// @returns value of the @p node
+    inline std::string_view get_value(const Node &node) const;
+
+    /// @returns pointer to the node at the given @p index or @c nullptr if @p index is @ref NO_NODE
+    inline Node *get_node(index_type index) const;
+
+    /// @returns iterator to the first direct child of the @p node
+    inline iterator begin(const Node &node) const;
+    /// @returns iterator past the last direct child of the @p node
+    inline iterator end(const Node &node) const;
+    /// @returns reverse iterator to the last direct child of the @p node
+    inline reverse_iterator rbegin(const Node &node) const;
+    /// @returns reverse iterator past the first direct child of the @p node
+    inline reverse_iterator rend(const Node &node) const;
+
+    /**
+     * @param node
+     *    parent node
+     * @param key
+     *    key of the child
+     * @returns
+     *    pointer to the first direct child of the @p node with the given @p key or @c nullptr 
+     *    if there is none
+     */
+    inline Node *find_child(const Node &node, std::string_view key) const;
+
+    /**
+     * @param node
+     *    parent node
+     * @param symbol
+     *    interned key of the child
+     * @returns
+     *    pointer to the first direct child of the @p node with the given key or @c nullptr if 
+     *    there is none
+     */
+    inline Node *find_child(const Node &node, Symbol symbol) const;
+
+    /**
+     * @param node
+     *    parent node
+     * @param key
+     *    key of the child
+     * @returns
+     *    number of direct children of the @p node with the given @p key
+     */
+    inline std::size_t count(const Node &node, std::string_view key) const;
+
+    /**
+     * @param node
+     *    node the @p path is relative to
+     * @param path
+     *    path to the descendant (keys of subsequent children separated with @p separator )
+     * @param separator
+     *    keys separator
+     * @returns
+     *    pointer to the descendant at the given @p path or @c nullptr if there is none
+     *    (on each level the first child with the matching key is choosen)
+     */
+    inline Node *find_path(const Node &node, std::string_view path, char separator) const;
+
+    /**
+     * @param node
+     *    node the @p path is relative to
+     * @param path
+     *    precompiled path to the descendant
+     * @returns
+     *    pointer to the descendant at the given @p path or @c nullptr if there is none
+     *    (on each level the first child with the matching key is choosen)
+     */
+    inline Node *find_path(const Node &node, const Path &path) const;
+
+    /// @returns @c true if key of the @p node is the given @p symbol
+    inline bool has_key(const Node &node, Symbol symbol) const;
+
+    /**
+     * @param path
+     *    precompiled path
+     * @returns
+     *    keys of the @p path resolved to symbols of the document
+     *
+     * @note Resolved paths are cached by the document (keyed by Path::hash()), so that 
+     *    symbols of the path are looked up once per document. Cache is lock-free and bounded
+     *    ( @ref RESOLVED_PATHS_CACHE_SIZE entries); paths that do not fit into it are resolved
+     *    on each call.
+     */
+    inline ResolvedPath resolve_path(const Path &path) const;
+
+    /**
+     * @param key
+     *    key to be found
+     * @returns
+     *    symbol of the @p key interned by the document (invalid symbol if no node has the @p key )
+     *
+     * @note Table of symbols of the documents mapped from images and of copied subtrees is built
+     *    on the first call (in a thread-safe manner)
+     */
+    Symbol find_symbol(std::string_view key) const;
+
+    /**
+     * @brief Writes binary image of the document to the file at @p path (the file is replaced
+     *    atomically)
+     *
+     * @param path
+     *    path to the image file
+     * @param source_hash
+     *    hash of the XML source the document has been parsed from
+     *
+     * @throws std::runtime_error
+     *    if image could not be written
+     */
+    void save_image(const std::filesystem::path &path, std::uint64_t source_hash) const;
+
+private: /* ---------------------------------------------------- Private methods -------------------------------------------------- */
+
+    /// Parses text in the [ @p begin, @p begin + @p size ) range (owned by the document) into the tree of nodes
+    void parse_source(char *begin, std::size_t size);
+
+    /// Maps and parses XML file at @p path (returns @c nullptr if file could not be mapped)
+    static std::shared_ptr<Document> parse_mapped_file(const std::filesystem::path &path);
+
+    /// @returns string of the given @p size placed at @p offset of the text
+    inline std::string_view get_string(index_type offset, index_type size) const;
+
+    /// Builds table of symbols from keys of nodes
+    void build_symbols() const;
+
+    /// Resolves @p path with the table of symbols and caches it in the first free entry probed from the @p first_slot
+    ResolvedPath resolve_path_slow(const Path &path, std::size_t first_slot) const;
+
+    /// Appends a new child node to the @p parent
+    index_type append_child(index_type parent, index_type key_offset, index_type key_size, 
+        index_type value_offset = 0, index_type value_size = 0);
+
+    /// Updates views of the @a text and @a nodes after modification of the owned storage
+    void update_views();
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Owned text of the document (if it has not been parsed from the mapped file)
+    std::string source;
+    /// Auxiliary strings created during parsing (key of the attributes node and concatenated text segments)
+    std::string auxiliary;
+    /// Owned table of nodes (first node is the root)
+    std::vector<Node> storage;
+
+    /// Path to the XML file the document has been parsed from
+    std::filesystem::path source_path;
+    /// Hash of the XML file the document has been parsed from
+    std::uint64_t source_hash { 0 };
+
+    /// Mapped file the document refers to (either the XML source or the binary image of the document)
+    std::shared_ptr<const void> mapping;
+    /// @c true if the @a mapping is the binary image of the document
+    bool from_image { false };
+
+    /// Text that keys and values of nodes refer to (either @a source or part of the @a mapping )
+    const char *text { nullptr };
+    /// Offset that the @a auxiliary strings start at (in the space of offsets of the text)
+    index_type auxiliary_base { NO_NODE };
+
+    /// Flag guarding (lazy) initialization of the @a symbols table
+    mutable std::once_flag symbols_built;
+    /// Table of symbols (offsets of interned keys)
+    mutable std::unordered_map<std::string_view, index_type> symbols;
+
+    /// Entry of the cache of resolved paths
+    struct ResolvedPathsCacheEntry {
+
+        /// State of the entry (@c 0 - empty, @c 1 - being written, @c 2 - ready)
+        std::atomic<std::uint8_t> state { 0 };
+        /// Hash of the cached path
+        std::uint64_t hash { 0 };
+        /// Source string of the cached path
+        std::string_view path;
+        /// Resolved path
+        ResolvedPath resolved;
+
+    };
+
+    /// Cache of resolved paths
+    mutable std::array<ResolvedPathsCacheEntry, RESOLVED_PATHS_CACHE_SIZE> resolved_paths;
+    /// Table of nodes (either @a storage or part of the @a image )
+    Node *nodes { nullptr };
+    /// Number of nodes
+    std::size_t nodes_num { 0 };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni::details
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/eni/common/document/document.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,242 @@
+/* ============================================================================================================================ *//**
+ * @file       document.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:51:46 am
+ * @modified   Sunday, 18th October 2026 1:40:45 pm
+ * @project    ethercat-lib
+ * @brief      Definition of inline methods of the Document class
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_COMMON_DOCUMENT_DOCUMENT_H__
+#define __ETHERCAT_COMMON_ENI_COMMON_DOCUMENT_DOCUMENT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Private includes
+#include "ethercat/eni/common/document.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni::details {
+
+/* =========================================================== iterator =========================================================== */
+
+class Document::iterator {
+
+public: /* ------------------------------------------------------ Public types ---------------------------------------------------- */
+
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = Node;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = Node*;
+    using reference         = Node&;
+
+public: /* ------------------------------------------------- Public ctors & dtors ------------------------------------------------- */
+
+    /// Default constructor
+    iterator() = default;
+
+    /// Constructs iterator pointing to the @p current child of the @p parent in the @p doc ( @ref NO_NODE for end )
+    iterator(const Document *doc, const Node *parent, index_type current) :
+        doc{ doc },
+        parent{ parent },
+        current{ current }
+    { }
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    reference operator*() const { return doc->nodes[current]; }
+    pointer operator->() const { return &doc->nodes[current]; }
+
+    iterator &operator++() { current = doc->nodes[current].next_sibling; return *this; }
+    iterator operator++(int) { auto ret = *this; ++(*this); return ret; }
+
+    iterator &operator--() { current = (current == NO_NODE) ? parent->last_child : doc->nodes[current].prev_sibling; return *this; }
+    iterator operator--(int) { auto ret = *this; --(*this); return ret; }
+
+    bool operator==(const iterator &rit) const { return current == rit.current; }
+    bool operator!=(const iterator &rit) const { return current != rit.current; }
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Iterated document
+    const Document *doc { nullptr };
+    /// Parent of iterated nodes (required to decrement end iterator)
+    const Node *parent { nullptr };
+    /// Index of the current node
+    index_type current { NO_NODE };
+
+};
+
+/* ======================================================== Public methods ======================================================== */
+
+Document::Node &Document::get_root() {
+    return nodes[0];
+}
+
+
+const Document::Node &Document::get_root() const {
+    return nodes[0];
+}
+
+
+std::size_t Document::get_nodes_num() const {
+    return nodes_num;
+}
+
+
+const std::filesystem::path &Document::get_source_path() const {
+    return source_path;
+}
+
+
+std::uint64_t Document::get_source_hash() const {
+    return source_hash;
+}
+
+
+bool Document::is_from_image() const {
+    return from_image;
+}
+
+
+std::string_view Document::get_key(const Node &node) const {
+    return get_string(node.key_offset, node.key_size);
+}
+
+
+std::string_view Document::get_value(const Node &node) const {
+    return get_string(node.value_offset, node.value_size);
+}
+
+
+Document::Node *Document::get_node(index_type index) const {
+    return (index == NO_NODE) ? nullptr : &nodes[index];
+}
+
+
+Document::iterator Document::begin(const Node &node) const {
+    return iterator{ this, &node, node.first_child };
+}
+
+
+Document::iterator Document::end(const Node &node) const {
+    return iterator{ this, &node, NO_NODE };
+}
+
+
+Document::reverse_iterator Document::rbegin(const Node &node) const {
+    return reverse_iterator{ end(node) };
+}
+
+
+Document::reverse_iterator Document::rend(const Node &node) const {
+    return reverse_iterator{ begin(node) };
+}
+
+
+Document::Node *Document::find_child(const Node &node, std::string_view key) const {
+    for(auto child = node.first_child; child != NO_NODE; child = nodes[child].next_sibling) {
+        if(get_key(nodes[child]) == key)
+            return &nodes[child];
+    }
+    return nullptr;
+}
+
+
+Document::Node *Document::find_child(const Node &node, Symbol symbol) const {
+    for(auto child = node.first_child; child != NO_NODE; child = nodes[child].next_sibling) {
+        if(has_key(nodes[child], symbol))
+            return &nodes[child];
+    }
+    return nullptr;
+}
+
+
+std::size_t Document::count(const Node &node, std::string_view key) const {
+    std::size_t ret = 0;
+    for(auto child = node.first_child; child != NO_NODE; child = nodes[child].next_sibling) {
+        if(get_key(nodes[child]) == key)
+            ++ret;
+    }
+    return ret;
+}
+
+
+Document::Node *Document::find_path(const Node &node, std::string_view path, char separator) const {
+
+    auto *current = const_cast<Node*>(&node);
+
+    // Resolve subsequent segments of the path
+    while(current != nullptr and not path.empty()) {
+
+        auto separator_pos = path.find(separator);
+
+        current = find_child(*current, path.substr(0, separator_pos));
+        path    = (separator_pos == std::string_view::npos) ? std::string_view{ } : path.substr(separator_pos + 1);
+    }
+
+    return current;
+}
+
+
+Document::Node *Document::find_path(const Node &node, const Path &path) const {
+
+    // Resolve keys of the path (if any key is not present in the document, the path cannot be found)
+    auto resolved = resolve_path(path);
+    if(not resolved.valid)
+        return nullptr;
+
+    auto *current = const_cast<Node*>(&node);
+
+    // Follow subsequent symbols of the path
+    for(std::size_t i = 0; i < resolved.depth; ++i) {
+        if(current = find_child(*current, resolved.symbols[i]); current == nullptr)
+            return nullptr;
+    }
+
+    return current;
+}
+
+
+bool Document::has_key(const Node &node, Symbol symbol) const {
+    return (node.key_offset == symbol.offset) and (node.key_size == symbol.size);
+}
+
+
+Document::ResolvedPath Document::resolve_path(const Path &path) const {
+
+    auto first_slot = path.hash() % RESOLVED_PATHS_CACHE_SIZE;
+
+    // Look for the path in the cache
+    for(std::size_t i = 0; i < RESOLVED_PATHS_CACHE_PROBES; ++i) {
+
+        auto &entry = resolved_paths[(first_slot + i) % RESOLVED_PATHS_CACHE_SIZE];
+
+        if(entry.state.load(std::memory_order_acquire) != 2)
+            break;
+        if(entry.hash == path.hash() and entry.path == path.str())
+            return entry.resolved;
+    }
+
+    // Otherwise, resolve the path
+    return resolve_path_slow(path, first_slot);
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+std::string_view Document::get_string(index_type offset, index_type size) const {
+    return (offset < auxiliary_base) ?
+        std::string_view{ text + offset, size } :
+        std::string_view{ auxiliary.data() + (offset - auxiliary_base), size };
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni::details
+
+#endif
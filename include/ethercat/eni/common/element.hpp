@@ -18,11 +18,17 @@
 
 // Standard includes
 #include <string>
+#include <string_view>
 #include <filesystem>
-// Boost includes
-#include "boost/property_tree/ptree.hpp"
+#include <memory>
+#include <optional>
 // Private includes
+#include "ethercat/config.hpp"
 #include "ethercat/eni/common/error.hpp"
+#include "ethercat/eni/common/document.hpp"
+#include "ethercat/eni/common/path.hpp"
+#include "ethercat/eni/common/paths.hpp"
+#include "ethercat/eni/common/element_view.hpp"
 #include "ethercat/eni/common/element/iterators_base.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
@@ -34,7 +40,9 @@ namespace ethercat::eni {
 /**
  * @brief Base class for parser classes for the ENI (EtherCAT Network Informations) files
  * @details Element class provides implementation-independant interface for parsing and 
- *    traversing ENI property tree as well as proper memory management model.
+ *    traversing ENI property tree as well as proper memory management model. The tree is
+ *    backed by the arena-allocated details::Document that can be either parsed from the ENI
+ *    source text or mapped from its compiled image (see element_from_file_cached()).
  * 
  *    Element class is a reference type that abstracts-out access to the underlying parsed 
  *    ENI structure handled by some implementation-specific mechanism. As so, all elements
@@ -63,17 +71,19 @@ public: /* ---------------------------------------------------- Public constants
 public: /* ------------------------------------------------------ Public types ---------------------------------------------------- */
 
     /// Internal type used for ENI tree parsing
-    using property_tree_type = boost::property_tree::ptree;
+    using document_type = details::Document;
+    /// Internal type of the ENI tree's node
+    using node_type = details::Document::Node;
 
     // Basic key type used to identify element's direct children
-    using key_type = property_tree_type::key_type;
-    // Basic key type used to identify element's indirect children
-    using path_type = property_tree_type::path_type;
+    using key_type = std::string_view;
+    // Basic key type used to identify element's indirect children (keys separated with @ref PATH_SEPRATOR )
+    using path_type = std::string_view;
 
     /// Element's value type (for elements iteration)
     using value_type = std::pair<const key_type, Element>;
     /// Element's size type (for elements iteration)
-    using size_type = property_tree_type::size_type;
+    using size_type = std::size_t;
 
     /// Basic iterator
     class iterator;
@@ -180,6 +190,32 @@ public: /* ----------------------------------------------- Public STL-like metho
     /// @returns const reference to the last direct child of the element
     inline const value_type back() const;
 
+public: /* ------------------------------------------------- Public view methods -------------------------------------------------- */
+
+    /**
+     * @returns 
+     *    borrowed (non-owning) view of the element; iterating over the view does not touch
+     *    reference count of the ENI tree, so that it is the preferred way of traversing 
+     *    elements that are only inspected
+     * 
+     * @note The view is valid as long as the element (or any other element referring to the
+     *    same ENI tree) is alive
+     */
+    inline ElementView view() const;
+
+    /**
+     * @brief Creates owning element referring to the node viewed by the @p view
+     * 
+     * @param view 
+     *    view of the node of the ENI tree referenced by the element
+     * @returns 
+     *    element sharing ownership of the ENI tree with this element
+     * 
+     * @throws Error 
+     *    if @p view refers to a different ENI tree
+     */
+    inline Element make_element(const ElementView &view) const;
+
 public: /* ---------------------------------------------- Public management methods ----------------------------------------------- */
 
     /**
@@ -203,6 +239,28 @@ public: /* ---------------------------------------------- Public management meth
      */
     inline void autonomize();
 
+    /**
+     * @returns 
+     *    path to the ENI file that the tree referenced by the element has been loaded from
+     *    (empty if the tree has been loaded from string, stream or the element has been 
+     *    autonomized)
+     */
+    inline const std::filesystem::path &get_source_path() const;
+
+    /**
+     * @returns 
+     *    hash of the content of the ENI file that the tree referenced by the element has been
+     *    loaded from (see details::Document::hash(); @c 0 if @ref get_source_path() is empty)
+     */
+    inline std::uint64_t get_source_hash() const;
+
+    /**
+     * @returns 
+     *    @c true if the tree referenced by the element has been mapped from the compiled cache
+     *    (see element_from_file_cached()) instead of being parsed from the ENI file
+     */
+    inline bool is_from_cache() const;
+
 public: /* ----------------------------------------------- Public searching methods ----------------------------------------------- */
 
     /**
@@ -226,6 +284,17 @@ public: /* ----------------------------------------------- Public searching meth
      */
     inline bool has_child(const key_type &child) const;
 
+    /**
+     * @param path 
+     *    precompiled path to the child to be found
+     * 
+     * @retval true 
+     *    if element has (possibly indirect) child at the given @p path
+     * @retval false 
+     *    otherwise
+     */
+    inline bool has_child(const Path &path) const;
+
     /** 
      * @brief Finds and returns child element at the given path
      * 
@@ -257,6 +326,18 @@ public: /* ----------------------------------------------- Public searching meth
      */
     inline const Element get_child(const path_type &path) const;
 
+    /**
+     * @brief Version of @ref get_child resolving precompiled @p path
+     * @overload Element get_child(const path_type &path)
+     */
+    inline Element get_child(const Path &path);
+
+    /**
+     * @brief Constant version of @ref get_child
+     * @overload Element get_child(const Path &path)
+     */
+    inline const Element get_child(const Path &path) const;
+
     /** 
      * @brief Finds and returns child element at the given path
      * 
@@ -278,6 +359,18 @@ public: /* ----------------------------------------------- Public searching meth
      */
     inline const Element get_child_or(const path_type &path, const Element default_element) const;
 
+    /**
+     * @brief Version of @ref get_child_or resolving precompiled @p path
+     * @overload get_child_or(const path_type &path, Element default_element)
+     */
+    inline Element get_child_or(const Path &path, Element default_element);
+
+    /**
+     * @brief Constant version of @ref get_child_or
+     * @overload get_child_or(const Path &path, Element default_element)
+     */
+    inline const Element get_child_or(const Path &path, const Element default_element) const;
+
     /** 
      * @brief Finds and returns child element at the given path
      * 
@@ -297,6 +390,18 @@ public: /* ----------------------------------------------- Public searching meth
      */
     inline std::optional<const Element> get_child_or_empty(const path_type &path) const;
 
+    /**
+     * @brief Version of @ref get_child_or_empty resolving precompiled @p path
+     * @overload get_child_or_empty(const path_type &path)
+     */
+    inline std::optional<Element> get_child_or_empty(const Path &path);
+
+    /**
+     * @brief Constant version of @ref get_child_or_empty
+     * @overload get_child_or_empty(const Path &path)
+     */
+    inline std::optional<const Element> get_child_or_empty(const Path &path) const;
+
 public: /* ------------------------------------------------- Public access methods ------------------------------------------------ */
 
     /** 
@@ -396,14 +501,37 @@ public: /* ------------------------------------------------- Public access metho
     template<class Type>
     inline std::optional<Type> get_child_value_or_empty(const path_type &path) const;
 
+    /**
+     * @brief Version of @ref get_child_value resolving precompiled @p path
+     * @overload get_child_value(const path_type &path)
+     */
+    template<class Type>
+    inline Type get_child_value(const Path &path) const;
+
+    /**
+     * @brief Version of @ref get_child_value_or resolving precompiled @p path
+     * @overload get_child_value_or(const path_type &path, Type default_value)
+     */
+    template<class Type>
+    inline Type get_child_value_or(const Path &path, Type default_value) const;
+
+    /**
+     * @brief Version of @ref get_child_value_or_empty resolving precompiled @p path
+     * @overload get_child_value_or_empty(const path_type &path)
+     */
+    template<class Type>
+    inline std::optional<Type> get_child_value_or_empty(const Path &path) const;
+
 private: /* --------------------------------------------------- Private friends --------------------------------------------------- */
 
     /// Make iterator base class a friend to let it access private constructors
-    template<typename, typename, typename>
+    template<typename, typename, typename, typename>
     friend class details::element_iterator_impl;
 
     /// Friend function loading Element from ENI file at @p path
     friend Element element_from_file(const std::filesystem::path &path);
+    /// Friend function loading Element from ENI file at @p path with use of the compiled cache
+    friend Element element_from_file_cached(const std::filesystem::path &path, const std::filesystem::path &cache_path);
     /// Friend function loading Element from ENI file loaded to @p eni string
     friend Element element_from_string(const std::string &eni);
     /// Friend function loading Element from ENI file read from @p stream
@@ -419,7 +547,7 @@ private: /* ------------------------------------------------ Private ctors & dto
      * @param root 
      *    source ENI (XML) tree to construct root element from
      */
-    inline Element(std::shared_ptr<property_tree_type> root);
+    inline Element(std::shared_ptr<document_type> root);
 
     /**
      * @brief Construct a new ENI Element referencing the given @p node in the @p root tree
@@ -429,25 +557,25 @@ private: /* ------------------------------------------------ Private ctors & dto
      * @param node 
      *    node referenced by the element
      */
-    inline Element(std::shared_ptr<property_tree_type> root, property_tree_type &node);
+    inline Element(std::shared_ptr<document_type> root, node_type &node);
 
 private: /* ---------------------------------------------------- Private methods -------------------------------------------------- */
 
     /// @returns reference to the wrapped node
-    inline property_tree_type &get_node();
+    inline node_type &get_node();
 
     /// @returns constant reference to the wrapped node
-    inline const property_tree_type &get_node() const;
+    inline const node_type &get_node() const;
 
     /// @returns element referencing given @p subnode in the same @a root tree
-    inline Element make_subelement(property_tree_type &subnode) const;
+    inline Element make_subelement(node_type &subnode) const;
 
 private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
 
     /// Shared pointer to the whole XML tree buffer ( held to assert validity of the @a node reference )
-    std::shared_ptr<property_tree_type> root;
+    std::shared_ptr<document_type> root;
     /// Reference to the XML node of the ENI file parsed by the class
-    property_tree_type *node { nullptr };
+    node_type *node { nullptr };
     
 };
 
@@ -466,6 +594,28 @@ private: /* ----------------------------------------------------- Private data -
  */
 inline Element element_from_file(const std::filesystem::path &path);
 
+/**
+ * @brief Loads ENI property tree from the file located at @p path using the compiled (binary)
+ *    image of the tree cached at @p cache_path
+ * @details Cache is keyed by the hash of the ENI file's content. If the cache is up-to-date,
+ *    it is mapped into the memory and used directly (no XML parsing is performed). Otherwise
+ *    the ENI file is parsed and the cache is (re)written.
+ *
+ * @param path
+ *    path to the ENI file to be parsed
+ * @param cache_path
+ *    path to the cache file (if empty, @p path extended with the 
+ *    @ref config::eni::CompiledCacheExtension is used)
+ * @returns 
+ *    target element loaded from XML tree
+ * 
+ * @throws eni::Error
+ *    if ENI file could not be loaded
+ * 
+ * @note Failure to write the cache is not reported
+ */
+inline Element element_from_file_cached(const std::filesystem::path &path, const std::filesystem::path &cache_path = { });
+
 /**
  * @brief Loads ENI property tree read into the runtime string
  *
@@ -505,6 +655,7 @@ inline Element element_from_stream(std::basic_istream<char> &stream);
 #include "ethercat/eni/common/element/loaders.hpp"
 #include "ethercat/eni/common/element/stl.hpp"
 #include "ethercat/eni/common/element/searching.hpp"
+#include "ethercat/eni/common/element/translation.hpp"
 #include "ethercat/eni/common/element/access.hpp"
 
 /* ================================================================================================================================ */
@@ -27,45 +27,78 @@ namespace ethercat::eni {
 template<class Type>
 Type Element::get_value() const {
     return wrap_error([&]{ 
-        return get_node().get_value<Type>();
+        return details::translate_value<Type>(root->get_value(get_node()));
     }, "ethercat::eni::Element::get_value()");
 }
 
 
 template<class Type>
 Type Element::get_value_or(Type default_value) const {
-    return get_node().get_value<Type>(default_value);
+    return details::translate_value_optional<Type>(root->get_value(get_node())).value_or(std::move(default_value));
 }
 
 
 template<class Type>
 std::optional<Type> Element::get_value_or_empty() const {
-    if(auto ret = get_node().get_value_optional<Type>(); ret.has_value())
-        return ret.get();
-    else
-        return std::optional<Type>{};
+    return details::translate_value_optional<Type>(root->get_value(get_node()));
 }
 
 
 template<class Type>
 Type Element::get_child_value(const path_type &path) const {
     return wrap_error([&]{ 
-        return get_node().get<Type>(path);
+
+        // Find the child
+        auto *child = root->find_path(get_node(), path, PATH_SEPRATOR);
+        if(child == nullptr)
+            throw std::runtime_error{ "No such node (" + std::string{ path } + ")" };
+
+        return details::translate_value<Type>(root->get_value(*child));
+
     }, "ethercat::eni::Element::get_child_value()");
 }
 
 
 template<class Type>
 Type Element::get_child_value_or(const path_type &path, Type default_value) const {
-    return get_node().get<Type>(path, default_value);
-
+    return get_child_value_or_empty<Type>(path).value_or(std::move(default_value));
 }
 
 
 template<class Type>
 std::optional<Type> Element::get_child_value_or_empty(const path_type &path) const {
-    if(auto ret = get_node().get_optional<Type>(path); ret.has_value())
-        return ret.get();
+    if(auto *child = root->find_path(get_node(), path, PATH_SEPRATOR); child != nullptr)
+        return details::translate_value_optional<Type>(root->get_value(*child));
+    else
+        return std::optional<Type>{};
+}
+
+
+template<class Type>
+Type Element::get_child_value(const Path &path) const {
+    return wrap_error([&]{ 
+
+        // Find the child
+        auto *child = root->find_path(get_node(), path);
+        if(child == nullptr)
+            throw std::runtime_error{ "No such node (" + std::string{ path.str() } + ")" };
+
+        return details::translate_value<Type>(root->get_value(*child));
+
+    }, "ethercat::eni::Element::get_child_value()");
+}
+
+
+template<class Type>
+Type Element::get_child_value_or(const Path &path, Type default_value) const {
+    return get_child_value_or_empty<Type>(path).value_or(std::move(default_value));
+}
+
+
+template<class Type>
+std::optional<Type> Element::get_child_value_or_empty(const Path &path) const {
+    if(auto *child = root->find_path(get_node(), path); child != nullptr)
+        return details::translate_value_optional<Type>(root->get_value(*child));
     else
         return std::optional<Type>{};
 }
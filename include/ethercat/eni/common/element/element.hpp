@@ -29,6 +29,23 @@ Element::operator ElementType() const {
     return ElementType{ root, *node };
 }
 
+/* ===================================================== Public view methods ====================================================== */
+
+ElementView Element::view() const {
+    return ElementView{ *root, get_node() };
+}
+
+
+Element Element::make_element(const ElementView &view) const {
+
+    // Make sure that the view refers to the same tree
+    if(view.doc != root.get()) {
+        throw Error{ "[ethercat::eni::Element::make_element] View refers to a different ENI tree" };
+    }
+
+    return Element{ root, const_cast<node_type&>(*view.node) };
+}
+
 /* ================================================================================================================================ */
 
 } // End namespace ethercat::eni
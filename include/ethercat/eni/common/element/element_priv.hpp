@@ -24,30 +24,30 @@ namespace ethercat::eni {
 
 /* ===================================================== Private ctors & dtors ==================================================== */
 
-Element::Element(std::shared_ptr<property_tree_type> root) :
+Element::Element(std::shared_ptr<document_type> root) :
     root{ root },
-    node{ root.get() }
+    node{ &root->get_root() }
 { }
 
 
-Element::Element(std::shared_ptr<property_tree_type> root, property_tree_type &node) :
+Element::Element(std::shared_ptr<document_type> root, node_type &node) :
     root{ root },
     node{ &node }
 { }
 
 /* ======================================================== Private methods ======================================================= */
 
-Element::property_tree_type &Element::get_node() {
+Element::node_type &Element::get_node() {
     return *node;
 }
 
 
-const Element::property_tree_type &Element::get_node() const {
-    return const_cast<const property_tree_type &>(*node);
+const Element::node_type &Element::get_node() const {
+    return const_cast<const node_type &>(*node);
 }
 
 
-Element Element::make_subelement(property_tree_type &subnode) const {
+Element Element::make_subelement(node_type &subnode) const {
     return Element(root, subnode);
 }
 
@@ -25,30 +25,30 @@ namespace ethercat::eni {
 /* =========================================================== Iterators ========================================================== */
 
 class Element::iterator : 
-    public details::element_iterator<Element, property_tree_type::iterator> 
+    public details::element_iterator<Element, document_type::iterator> 
 { 
-    using details::element_iterator<Element, property_tree_type::iterator>::element_iterator;
+    using details::element_iterator<Element, document_type::iterator>::element_iterator;
 };
 
 
 class Element::const_iterator : 
-    public details::const_element_iterator<Element, property_tree_type::const_iterator> 
+    public details::const_element_iterator<Element, document_type::iterator> 
 { 
-    using details::const_element_iterator<Element, property_tree_type::const_iterator>::const_element_iterator;
+    using details::const_element_iterator<Element, document_type::iterator>::const_element_iterator;
 };
 
 
 class Element::reverse_iterator : 
-    public details::element_iterator<Element, property_tree_type::reverse_iterator> 
+    public details::element_iterator<Element, document_type::reverse_iterator> 
 { 
-    using details::element_iterator<Element, property_tree_type::reverse_iterator>::element_iterator;
+    using details::element_iterator<Element, document_type::reverse_iterator>::element_iterator;
 };
 
 
 class Element::const_reverse_iterator : 
-    public details::const_element_iterator<Element, property_tree_type::const_reverse_iterator> 
+    public details::const_element_iterator<Element, document_type::reverse_iterator> 
 { 
-    using details::const_element_iterator<Element, property_tree_type::const_reverse_iterator>::const_element_iterator;
+    using details::const_element_iterator<Element, document_type::reverse_iterator>::const_element_iterator;
 };
 
 /* ================================================================================================================================ */
@@ -33,7 +33,9 @@ namespace details {
      *   Wraps iterators API of the implementation-specific type handling ENI parsing
      * 
      * @tparam root_type 
-     *    type of the root node that is referenced by all elements
+     *    type of the document that is referenced by all elements
+     * @tparam node_type 
+     *    type of the document's node referenced by the wrapped iterator
      * @tparam wrapped_iterator_type 
      *    type of the wrapped iterator
      * @tparam value_type 
@@ -43,9 +45,9 @@ namespace details {
      * 
      * @see https://www.boost.org/doc/libs/1_55_0/libs/iterator/doc/iterator_facade.html#tutorial-example
      */
-    template<typename root_type, typename wrapped_iterator_type, typename value_type>
+    template<typename root_type, typename node_type, typename wrapped_iterator_type, typename value_type>
     class element_iterator_impl : 
-        public boost::iterator_facade<element_iterator_impl<root_type, wrapped_iterator_type, value_type>, 
+        public boost::iterator_facade<element_iterator_impl<root_type, node_type, wrapped_iterator_type, value_type>, 
             /* Value type     */ value_type,
             /* Category       */ typename boost::iterator_traversal<wrapped_iterator_type>::type,
             /* Reference type */ value_type>
@@ -56,7 +58,7 @@ namespace details {
         struct enabler { };
 
         /// Make all specialization friendly to allow potential interoperability
-        template<typename other_root_type, typename other_wrapped_iterator_type, typename other_value_type>
+        template<typename other_root_type, typename other_node_type, typename other_wrapped_iterator_type, typename other_value_type>
         friend class element_iterator_impl;
 
     public: /* Public ctors */
@@ -74,9 +76,9 @@ namespace details {
         { }
 
         /// Copy constructor
-        template<typename other_root_type, typename other_wrapped_iterator_type, typename other_value_type>
+        template<typename other_root_type, typename other_node_type, typename other_wrapped_iterator_type, typename other_value_type>
         element_iterator_impl(
-            element_iterator_impl<other_root_type, other_wrapped_iterator_type, other_value_type> const &other,
+            element_iterator_impl<other_root_type, other_node_type, other_wrapped_iterator_type, other_value_type> const &other,
             typename boost::enable_if<
                 boost::is_convertible<other_wrapped_iterator_type, wrapped_iterator_type>,
             enabler>::type = enabler()
@@ -91,8 +93,8 @@ namespace details {
         friend class boost::iterator_core_access;
 
         /// Compares two iterators
-        template<typename other_root_type, typename other_wrapped_iterator_type, typename other_value_type>
-        bool equal(element_iterator_impl<other_root_type, other_wrapped_iterator_type, other_value_type> const &other) const {
+        template<typename other_root_type, typename other_node_type, typename other_wrapped_iterator_type, typename other_value_type>
+        bool equal(element_iterator_impl<other_root_type, other_node_type, other_wrapped_iterator_type, other_value_type> const &other) const {
             return ((root == other.root) and (it == other.it));
         }
         
@@ -106,14 +108,14 @@ namespace details {
         value_type dereference() const {
             auto &ref = *it;
             return  value_type{ 
-                ref.first,
-                typename value_type::second_type{ root, const_cast<root_type&>(ref.second) } 
+                typename value_type::first_type{ root->get_key(ref) },
+                typename value_type::second_type{ root, const_cast<node_type&>(ref) } 
             };
         }
 
     private: /* Private members */
 
-        /// Root of the property tree referenced by the referenced element
+        /// Document referenced by the referenced element
         std::shared_ptr<root_type> root;
         /// Implementation-specific iterator 
         wrapped_iterator_type it;
@@ -126,8 +128,9 @@ namespace details {
      * @tparam element_type 
      *    element type that the iterator is defined for; if needs to define following public types:
      * 
-     *       * property_tree_type - type of the underlying implementation-specific representation
+     *       * document_type      - type of the underlying implementation-specific representation
      *                              of the ENI tree shared by all elements
+     *       * node_type          - type of the node of the document
      *       * value_type         - type of the iterator's value and reference, it is expected to 
      *                              be std::pair ( same as value_type of the @p wrapped_iterator_type ) 
      *                              holding std::string providing name of the element's child and element
@@ -139,7 +142,8 @@ namespace details {
     template<typename element_type, typename wrapped_iterator_type>
     using element_iterator = 
         element_iterator_impl<
-            typename element_type::property_tree_type,
+            typename element_type::document_type,
+            typename element_type::node_type,
             wrapped_iterator_type,
             typename element_type::value_type
         >;
@@ -151,7 +155,8 @@ namespace details {
     template<typename element_type, typename wrapped_iterator_type>
     using const_element_iterator =
         element_iterator_impl<
-            typename element_type::property_tree_type,
+            typename element_type::document_type,
+            typename element_type::node_type,
             wrapped_iterator_type,
             const typename element_type::value_type
         >;
@@ -15,8 +15,6 @@
 
 /* =========================================================== Includes =========================================================== */
 
-// Boost includes
-#include "boost/property_tree/xml_parser.hpp"
 // Private includes
 #include "ethercat/eni/common/element.hpp"
 
@@ -28,15 +26,9 @@ namespace ethercat::eni {
 
 Element element_from_file(const std::filesystem::path &path) {
 
-    // Allocate property tree in the memory
-    auto ret = std::make_shared<Element::property_tree_type>();
-
-    // Load property tree from XML
-    wrap_error([&]{
-
-        // Load tree from the file
-        boost::property_tree::read_xml(path.string(), *ret);
-
+    // Load document from XML file
+    auto ret = wrap_error([&]{
+        return details::Document::parse_file(path);
     }, "ethercat::eni::element_from_file()");
 
     // Return wrapping element
@@ -44,37 +36,44 @@ Element element_from_file(const std::filesystem::path &path) {
 }
 
 
-Element element_from_string(const std::string &eni) {
+Element element_from_file_cached(const std::filesystem::path &path, const std::filesystem::path &cache_path) {
 
-    // Allocate property tree in the memory
-    auto ret = std::make_shared<Element::property_tree_type>();
+    // Load document from the cache or from XML file
+    auto ret = wrap_error([&]{
 
-    // Create stream from string
-    std::istringstream stream{ eni };
-    // Load property tree from XML
-    wrap_error([&]{
+        // Place cache next to the ENI file by default
+        auto image_path = cache_path;
+        if(image_path.empty()) {
+            image_path = path;
+            image_path += config::eni::CompiledCacheExtension;
+        }
 
-        // Load tree from the stream
-        boost::property_tree::read_xml(stream, *ret);
+        return details::Document::parse_file_cached(path, image_path);
 
-    }, "ethercat::eni::element_from_string()");
+    }, "ethercat::eni::element_from_file_cached()");
 
     // Return wrapping element
     return Element(ret);
 }
 
 
-Element element_from_stream(std::basic_istream<char> &stream) {
+Element element_from_string(const std::string &eni) {
 
-    // Allocate property tree in the memory
-    auto ret = std::make_shared<Element::property_tree_type>();
+    // Load document from XML string
+    auto ret = wrap_error([&]{
+        return details::Document::parse(std::string{ eni });
+    }, "ethercat::eni::element_from_string()");
+
+    // Return wrapping element
+    return Element(ret);
+}
 
-    // Load property tree from XML
-    wrap_error([&]{
 
-        // Load tree from the stream
-        boost::property_tree::read_xml(stream, *ret);
+Element element_from_stream(std::basic_istream<char> &stream) {
 
+    // Load document from the stream
+    auto ret = wrap_error([&]{
+        return details::Document::parse_stream(stream);
     }, "ethercat::eni::element_from_stream()");
 
     // Return wrapping element
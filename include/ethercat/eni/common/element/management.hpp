@@ -27,11 +27,26 @@ namespace ethercat::eni {
 void Element::autonomize() {
 
     // Create copy of the currently referenced element
-    auto new_root = std::make_shared<property_tree_type>(*node);
+    auto new_root = details::Document::copy_subtree(*root, *node);
     // Store reference to the created obejct as a new root
     root = new_root;
     // Store reference to the root object as node reference
-    node = root.get();
+    node = &root->get_root();
+}
+
+
+const std::filesystem::path &Element::get_source_path() const {
+    return root->get_source_path();
+}
+
+
+std::uint64_t Element::get_source_hash() const {
+    return root->get_source_hash();
+}
+
+
+bool Element::is_from_cache() const {
+    return root->is_from_image();
 }
 
 /* ================================================================================================================================ */
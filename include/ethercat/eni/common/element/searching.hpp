@@ -25,18 +25,25 @@ namespace ethercat::eni {
 /* =================================================== Public searching methods =================================================== */
 
 Element::size_type Element::count(const key_type &key) const {
-    return get_node().count(key);
+    return root->count(get_node(), key);
 }
 
 
 bool Element::has_child(const key_type &child) const {
-    return (get_node().find(child) != get_node().not_found());
+    return (root->find_child(get_node(), child) != nullptr);
 }
 
 
 Element Element::get_child(const path_type &path) {
     return wrap_error([&]{ 
-        return make_subelement(get_node().get_child(path));
+
+        // Find the child
+        auto *child = root->find_path(get_node(), path, PATH_SEPRATOR);
+        if(child == nullptr)
+            throw std::runtime_error{ "No such node (" + std::string{ path } + ")" };
+
+        return make_subelement(*child);
+
     }, "ethercat::eni::Element::get_child()");
 }
 
@@ -47,7 +54,10 @@ const Element Element::get_child(const path_type &path) const {
 
 
 Element Element::get_child_or(const path_type &path, Element default_element) {
-    return make_subelement(get_node().get_child(path, default_element.get_node()));
+    if(auto *child = root->find_path(get_node(), path, PATH_SEPRATOR); child != nullptr)
+        return make_subelement(*child);
+    else
+        return default_element;
 }
 
 
@@ -57,8 +67,8 @@ const Element Element::get_child_or(const path_type &path, const Element default
 
 
 std::optional<Element> Element::get_child_or_empty(const path_type &path) {
-    if(auto ret = get_node().get_child_optional(path); ret.has_value())
-        return make_subelement(ret.get());
+    if(auto *child = root->find_path(get_node(), path, PATH_SEPRATOR); child != nullptr)
+        return make_subelement(*child);
     else
         return std::optional<Element>{};
 }
@@ -68,6 +78,56 @@ std::optional<const Element> Element::get_child_or_empty(const path_type &path)
     return const_cast<Element*>(this)->get_child_or_empty(path);
 }
 
+
+bool Element::has_child(const Path &path) const {
+    return (root->find_path(get_node(), path) != nullptr);
+}
+
+
+Element Element::get_child(const Path &path) {
+    return wrap_error([&]{ 
+
+        // Find the child
+        auto *child = root->find_path(get_node(), path);
+        if(child == nullptr)
+            throw std::runtime_error{ "No such node (" + std::string{ path.str() } + ")" };
+
+        return make_subelement(*child);
+
+    }, "ethercat::eni::Element::get_child()");
+}
+
+
+const Element Element::get_child(const Path &path) const {
+    return const_cast<Element*>(this)->get_child(path);
+}
+
+
+Element Element::get_child_or(const Path &path, Element default_element) {
+    if(auto *child = root->find_path(get_node(), path); child != nullptr)
+        return make_subelement(*child);
+    else
+        return default_element;
+}
+
+
+const Element Element::get_child_or(const Path &path, const Element default_element) const {
+    return const_cast<Element*>(this)->get_child_or(path, const_cast<Element&>(default_element));
+}
+
+
+std::optional<Element> Element::get_child_or_empty(const Path &path) {
+    if(auto *child = root->find_path(get_node(), path); child != nullptr)
+        return make_subelement(*child);
+    else
+        return std::optional<Element>{};
+}
+
+
+std::optional<const Element> Element::get_child_or_empty(const Path &path) const {
+    return const_cast<Element*>(this)->get_child_or_empty(path);
+}
+
 /* ================================================================================================================================ */
 
 } // End namespace ethercat::eni
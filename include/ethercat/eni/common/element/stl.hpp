@@ -25,76 +25,76 @@ namespace ethercat::eni {
 /* ==================================================== Protected ctors & dtors =================================================== */
 
 Element::size_type Element::size() const {
-    return get_node().size();
+    return get_node().children_num;
 }
 
 
 bool Element::empty() const {
-    return get_node().empty();
+    return (get_node().children_num == 0);
 }
 
 
 Element::iterator Element::begin() {
-    return iterator(root, get_node().begin());
+    return iterator(root, root->begin(get_node()));
 }
 
 
 Element::const_iterator Element::begin() const {
-    return const_iterator(root, get_node().begin());
+    return const_iterator(root, root->begin(get_node()));
 }
 
 
 Element::iterator Element::end() {
-    return iterator(root, get_node().end());
+    return iterator(root, root->end(get_node()));
 }
 
 
 Element::const_iterator Element::end() const {
-    return const_iterator(root, get_node().end());
+    return const_iterator(root, root->end(get_node()));
 }
 
 
 Element::reverse_iterator Element::rbegin() {
-    return reverse_iterator(root, get_node().rbegin());
+    return reverse_iterator(root, root->rbegin(get_node()));
 }
 
 
 Element::const_reverse_iterator Element::rbegin() const {
-    return const_reverse_iterator(root, get_node().rbegin());
+    return const_reverse_iterator(root, root->rbegin(get_node()));
 }
 
 
 Element::reverse_iterator Element::rend() {
-    return reverse_iterator(root, get_node().rend());
+    return reverse_iterator(root, root->rend(get_node()));
 }
 
 
 Element::const_reverse_iterator Element::rend() const {
-    return const_reverse_iterator(root, get_node().rend());
+    return const_reverse_iterator(root, root->rend(get_node()));
 }
 
 
 Element::value_type Element::front() {
-    auto front = get_node().front();
-    return value_type{ front.first, make_subelement(front.second) };
+    auto &front = *root->get_node(get_node().first_child);
+    return value_type{ root->get_key(front), make_subelement(front) };
 }
 
 
 const Element::value_type Element::front() const {
-    auto front = get_node().front();
-    return value_type{ front.first, make_subelement(front.second) };
+    auto &front = *root->get_node(get_node().first_child);
+    return value_type{ root->get_key(front), make_subelement(front) };
 }
 
 
 Element::value_type Element::back() {
-    auto back = get_node().back();
-    return value_type{ back.first, make_subelement(back.second) };
+    auto &back = *root->get_node(get_node().last_child);
+    return value_type{ root->get_key(back), make_subelement(back) };
 }
 
 
 const Element::value_type Element::back() const {
-    auto back = get_node().back();
-    return value_type{ back.first, make_subelement(back.second) };
+    auto &back = *root->get_node(get_node().last_child);
+    return value_type{ root->get_key(back), make_subelement(back) };
 }
 
 /* ================================================================================================================================ */
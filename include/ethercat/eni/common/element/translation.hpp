@@ -0,0 +1,175 @@
+/* ============================================================================================================================ *//**
+ * @file       translation.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:51:46 am
+ * @modified   Sunday, 18th October 2026 12:25:04 pm
+ * @project    ethercat-lib
+ * @brief      Definition of helper functions translating raw values of ENI nodes into requested types
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_COMMON_ELEMENT_TRANSLATION_H__
+#define __ETHERCAT_COMMON_ENI_COMMON_ELEMENT_TRANSLATION_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <charconv>
+#include <ios>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni::details {
+
+/* ======================================================== Free functions ======================================================== */
+
+/**
+ * @brief Translates raw @p value of the ENI node into the arithmetic value of type @p T with
+ *    std::from_chars (fast path of the translate_value_optional())
+ *
+ * @tparam T
+ *    target type
+ * @param value
+ *    raw value
+ * @returns
+ *    translated value on success, empty optional if @p value is not a plain decimal number
+ *    (or boolean literal) that could be parsed without the stream
+ */
+template<typename T>
+std::optional<T> translate_value_fast(std::string_view value) {
+
+    constexpr std::string_view whitespaces { " \t\n\r\f\v" };
+
+    // Trim whitespaces
+    auto begin = value.find_first_not_of(whitespaces);
+    if(begin == std::string_view::npos)
+        return std::optional<T>{};
+    value = value.substr(begin, value.find_last_not_of(whitespaces) - begin + 1);
+
+    // Booleans may be given either in numeric or alphabetic form
+    if constexpr(std::is_same_v<T, bool>) {
+        if(value == "1" or value == "true")
+            return true;
+        if(value == "0" or value == "false")
+            return false;
+        return std::optional<T>{};
+    } else {
+
+        // Skip explicit plus sign (not accepted by std::from_chars)
+        if(value.size() > 1 and value.front() == '+' and value[1] != '-')
+            value.remove_prefix(1);
+
+        // Characters are parsed as integers
+        using ParsedT = std::conditional_t<std::is_same_v<T, signed char> or std::is_same_v<T, unsigned char>, int, T>;
+
+        ParsedT ret { };
+        auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), ret);
+
+        // Check whether the whole value has been consumed
+        if(ec != std::errc{ } or end != value.data() + value.size())
+            return std::optional<T>{};
+
+        return static_cast<T>(ret);
+    }
+}
+
+
+/**
+ * @brief Translates raw @p value of the ENI node into the value of type @p T
+ * @details Translation follows semantic of the stream-based translator of the boost::property_tree
+ *    that the library used to rely on, i.e. the value is parsed as with the std::istringstream
+ *    (booleans are accepted in both numeric and alphabetic form, characters are parsed as
+ *    integers) and it is required that the whole @p value (except trailing whitespaces) is consumed.
+ *    Arithmetic values are parsed with std::from_chars, while the stream is used only for values 
+ *    that it does not accept (e.g. negative values of unsigned types)
+ *
+ * @tparam T
+ *    target type
+ * @param value
+ *    raw value
+ * @returns
+ *    translated value on success, empty optional otherwise
+ */
+template<typename T>
+std::optional<T> translate_value_optional(std::string_view value) {
+
+    // Strings are returned as is
+    if constexpr(std::is_same_v<T, std::string> or std::is_same_v<T, std::string_view>)
+        return T{ value };
+    else {
+
+        // Parse arithmetic values without the stream, if possible
+        if constexpr(std::is_arithmetic_v<T>) {
+            if(auto ret = translate_value_fast<T>(value); ret.has_value())
+                return ret;
+        }
+
+        std::istringstream stream{ std::string{ value } };
+
+        T ret { };
+
+        // Booleans may be given either in numeric or alphabetic form
+        if constexpr(std::is_same_v<T, bool>) {
+            stream >> ret;
+            if(stream.fail()) {
+                stream.clear();
+                stream.seekg(0);
+                stream >> std::boolalpha >> ret;
+            }
+        // Characters are parsed as integers
+        } else if constexpr(std::is_same_v<T, signed char> or std::is_same_v<T, unsigned char>) {
+            int i { };
+            stream >> i;
+            ret = static_cast<T>(i);
+        } else
+            stream >> ret;
+
+        // Skip trailing whitespaces
+        if(not stream.eof())
+            stream >> std::ws;
+
+        // Check whether the whole value has been consumed
+        if(stream.fail() or stream.bad() or not stream.eof())
+            return std::optional<T>{};
+
+        return ret;
+    }
+}
+
+
+/**
+ * @brief Translates raw @p value of the ENI node into the value of type @p T
+ * @see translate_value_optional()
+ *
+ * @tparam T
+ *    target type
+ * @param value
+ *    raw value
+ * @returns
+ *    translated value
+ *
+ * @throws std::runtime_error
+ *    if translation failed
+ */
+template<typename T>
+T translate_value(std::string_view value) {
+    if(auto ret = translate_value_optional<T>(value); ret.has_value())
+        return *ret;
+    else
+        throw std::runtime_error{ std::string{ "conversion of data to type \"" } + typeid(T).name() + "\" failed" };
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni::details
+
+#endif
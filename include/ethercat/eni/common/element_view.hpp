@@ -0,0 +1,186 @@
+/* ============================================================================================================================ *//**
+ * @file       element_view.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:33:44 pm
+ * @modified   Sunday, 18th October 2026 12:33:44 pm
+ * @project    ethercat-lib
+ * @brief      Definition of the ElementView class providing non-owning access to nodes of the ENI (EtherCAT Network Informations)
+ *             tree
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_COMMON_ELEMENT_VIEW_H__
+#define __ETHERCAT_COMMON_ENI_COMMON_ELEMENT_VIEW_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <iterator>
+#include <optional>
+#include <string_view>
+// Private includes
+#include "ethercat/eni/common/error.hpp"
+#include "ethercat/eni/common/document.hpp"
+#include "ethercat/eni/common/path.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* ============================================================= Class ============================================================ */
+
+/**
+ * @brief Borrowed (non-owning) view of the node of the ENI tree
+ * @details Contrary to the Element, view does not share ownership of the ENI tree. In result
+ *    copying it and iterating over its children costs no more than copying a pair of pointers
+ *    (no reference counting is involved). Traversals that only inspect the tree (e.g. searching
+ *    elements with the given key) should iterate over views and create owning Element (see
+ *    Element::make_element()) only for the elements that are returned to the caller.
+ *
+ * @note View is valid as long as any Element referring to the same ENI tree is alive
+ *    (in particular, the Element that the view has been obtained from)
+ */
+class ElementView {
+
+public: /* ------------------------------------------------------ Public types ---------------------------------------------------- */
+
+    /// Internal type used for ENI tree parsing
+    using document_type = details::Document;
+    /// Internal type of the ENI tree's node
+    using node_type = details::Document::Node;
+
+    /// Basic key type used to identify view's direct children
+    using key_type = std::string_view;
+    /// View's size type
+    using size_type = std::size_t;
+
+    /// Constant iterator over direct children of the view (yields views of children)
+    class iterator;
+    /// Constant iterator (views provide read-only access)
+    using const_iterator = iterator;
+
+public: /* ------------------------------------------------- Public ctors & dtors ------------------------------------------------- */
+
+    /**
+     * @brief Constructs view of the @p node of the @p doc
+     *
+     * @param doc
+     *    document holding the @p node
+     * @param node
+     *    node to be referenced
+     */
+    inline ElementView(const document_type &doc, const node_type &node);
+
+public: /* ----------------------------------------------- Public STL-like methods ------------------------------------------------ */
+
+    /// @returns number of direct children of the element
+    inline size_type size() const;
+    /// @retval true if element has no direct children @retval false otherwise
+    inline bool empty() const;
+
+    /// @returns iterator to the first direct child of the element
+    inline iterator begin() const;
+    /// @returns iterator past the last direct child of the element
+    inline iterator end() const;
+
+public: /* ----------------------------------------------- Public searching methods ----------------------------------------------- */
+
+    /// @returns key (name) of the referenced element
+    inline key_type get_key() const;
+
+    /**
+     * @param child
+     *    identifier of the child to be found
+     *
+     * @retval true
+     *    if element has direct child named @p child
+     * @retval false
+     *    otherwise
+     */
+    inline bool has_child(const key_type &child) const;
+
+    /**
+     * @param path
+     *    precompiled path to the child to be found
+     *
+     * @retval true
+     *    if element has (possibly indirect) child at the given @p path
+     * @retval false
+     *    otherwise
+     */
+    inline bool has_child(const Path &path) const;
+
+    /**
+     * @param path
+     *    precompiled path to the target child
+     * @returns
+     *    view of the requested child element
+     * @throws Error
+     *    if @p path does not identify element's child
+     */
+    inline ElementView get_child(const Path &path) const;
+
+    /**
+     * @param path
+     *    precompiled path to the target child
+     *
+     * @retval child
+     *    view of the requested child element if @p path refers to a valid child
+     * @retval empty
+     *    optional otherwise
+     */
+    inline std::optional<ElementView> get_child_or_empty(const Path &path) const;
+
+public: /* ------------------------------------------------- Public access methods ------------------------------------------------ */
+
+    /// @see Element::get_value()
+    template<class Type>
+    inline Type get_value() const;
+
+    /// @see Element::get_value_or()
+    template<class Type>
+    inline Type get_value_or(Type default_value) const;
+
+    /// @see Element::get_value_or_empty()
+    template<class Type>
+    inline std::optional<Type> get_value_or_empty() const;
+
+    /// @see Element::get_child_value()
+    template<class Type>
+    inline Type get_child_value(const Path &path) const;
+
+    /// @see Element::get_child_value_or()
+    template<class Type>
+    inline Type get_child_value_or(const Path &path, Type default_value) const;
+
+    /// @see Element::get_child_value_or_empty()
+    template<class Type>
+    inline std::optional<Type> get_child_value_or_empty(const Path &path) const;
+
+private: /* --------------------------------------------------- Private friends --------------------------------------------------- */
+
+    /// Make Element a friend to let it create owning elements from views
+    friend class Element;
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Document holding the referenced node
+    const document_type *doc { nullptr };
+    /// Referenced node
+    const node_type *node { nullptr };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/eni/common/element_view/element_view.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
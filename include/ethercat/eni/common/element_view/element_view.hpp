@@ -0,0 +1,192 @@
+/* ============================================================================================================================ *//**
+ * @file       element_view.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:33:44 pm
+ * @modified   Sunday, 18th October 2026 12:33:44 pm
+ * @project    ethercat-lib
+ * @brief      Definition of inline methods of the ElementView class
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_COMMON_ELEMENT_VIEW_ELEMENT_VIEW_H__
+#define __ETHERCAT_COMMON_ENI_COMMON_ELEMENT_VIEW_ELEMENT_VIEW_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <stdexcept>
+#include <string>
+// Private includes
+#include "ethercat/eni/common/element_view.hpp"
+#include "ethercat/eni/common/element/translation.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* =========================================================== Iterator =========================================================== */
+
+class ElementView::iterator {
+
+public: /* ------------------------------------------------------ Public types ---------------------------------------------------- */
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = ElementView;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = ElementView;
+
+public: /* ------------------------------------------------- Public ctors & dtors ------------------------------------------------- */
+
+    /// Default constructor
+    iterator() = default;
+
+    /// Constructs iterator wrapping iterator over children of the node of the @p doc
+    iterator(const document_type *doc, document_type::iterator it) :
+        doc{ doc },
+        it{ it }
+    { }
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    reference operator*() const { return ElementView{ *doc, *it }; }
+
+    iterator &operator++() { ++it; return *this; }
+    iterator operator++(int) { auto ret = *this; ++(*this); return ret; }
+
+    bool operator==(const iterator &rit) const { return it == rit.it; }
+    bool operator!=(const iterator &rit) const { return it != rit.it; }
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Iterated document
+    const document_type *doc { nullptr };
+    /// Wrapped iterator over document's nodes
+    document_type::iterator it;
+
+};
+
+/* ===================================================== Public ctors & dtors ===================================================== */
+
+ElementView::ElementView(const document_type &doc, const node_type &node) :
+    doc{ &doc },
+    node{ &node }
+{ }
+
+/* =================================================== Public STL-like methods ==================================================== */
+
+ElementView::size_type ElementView::size() const {
+    return node->children_num;
+}
+
+
+bool ElementView::empty() const {
+    return (node->children_num == 0);
+}
+
+
+ElementView::iterator ElementView::begin() const {
+    return iterator(doc, doc->begin(*node));
+}
+
+
+ElementView::iterator ElementView::end() const {
+    return iterator(doc, doc->end(*node));
+}
+
+/* =================================================== Public searching methods =================================================== */
+
+ElementView::key_type ElementView::get_key() const {
+    return doc->get_key(*node);
+}
+
+
+bool ElementView::has_child(const key_type &child) const {
+    return (doc->find_child(*node, child) != nullptr);
+}
+
+
+bool ElementView::has_child(const Path &path) const {
+    return (doc->find_path(*node, path) != nullptr);
+}
+
+
+ElementView ElementView::get_child(const Path &path) const {
+    return wrap_error([&]{
+
+        // Find the child
+        auto *child = doc->find_path(*node, path);
+        if(child == nullptr)
+            throw std::runtime_error{ "No such node (" + std::string{ path.str() } + ")" };
+
+        return ElementView{ *doc, *child };
+
+    }, "ethercat::eni::ElementView::get_child()");
+}
+
+
+std::optional<ElementView> ElementView::get_child_or_empty(const Path &path) const {
+    if(auto *child = doc->find_path(*node, path); child != nullptr)
+        return ElementView{ *doc, *child };
+    else
+        return std::optional<ElementView>{};
+}
+
+/* ===================================================== Public access methods ==================================================== */
+
+template<class Type>
+Type ElementView::get_value() const {
+    return wrap_error([&]{
+        return details::translate_value<Type>(doc->get_value(*node));
+    }, "ethercat::eni::ElementView::get_value()");
+}
+
+
+template<class Type>
+Type ElementView::get_value_or(Type default_value) const {
+    return details::translate_value_optional<Type>(doc->get_value(*node)).value_or(std::move(default_value));
+}
+
+
+template<class Type>
+std::optional<Type> ElementView::get_value_or_empty() const {
+    return details::translate_value_optional<Type>(doc->get_value(*node));
+}
+
+
+template<class Type>
+Type ElementView::get_child_value(const Path &path) const {
+    return wrap_error([&]{
+
+        // Find the child
+        auto *child = doc->find_path(*node, path);
+        if(child == nullptr)
+            throw std::runtime_error{ "No such node (" + std::string{ path.str() } + ")" };
+
+        return details::translate_value<Type>(doc->get_value(*child));
+
+    }, "ethercat::eni::ElementView::get_child_value()");
+}
+
+
+template<class Type>
+Type ElementView::get_child_value_or(const Path &path, Type default_value) const {
+    return get_child_value_or_empty<Type>(path).value_or(std::move(default_value));
+}
+
+
+template<class Type>
+std::optional<Type> ElementView::get_child_value_or_empty(const Path &path) const {
+    if(auto *child = doc->find_path(*node, path); child != nullptr)
+        return details::translate_value_optional<Type>(doc->get_value(*child));
+    else
+        return std::optional<Type>{};
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
+
+#endif
@@ -0,0 +1,126 @@
+/* ============================================================================================================================ *//**
+ * @file       path.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:30:12 pm
+ * @modified   Sunday, 18th October 2026 1:40:45 pm
+ * @project    ethercat-lib
+ * @brief      Definition of the Path class representing precompiled path to the ENI element
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_COMMON_PATH_H__
+#define __ETHERCAT_COMMON_ENI_COMMON_PATH_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* ============================================================= Path ============================================================= */
+
+/**
+ * @brief Precompiled path to the (possibly indirect) child of the ENI element
+ * @details Path is split into keys of subsequent children once, when constructed. If constructed
+ *    as @c constexpr object, splitting takes place at compile time, e.g.:
+ *
+ *    @code
+ *       // Path to the name of the slave
+ *       constexpr eni::Path NAME_PATH { "Info.Name" };
+ *
+ *       auto name = slave.get_child_value<std::string>(NAME_PATH);
+ *    @endcode
+ *
+ *    When the path is resolved, keys are matched against symbols interned by the document (see
+ *    details::Document::find_symbol()), so that children are compared by integer identifiers
+ *    rather than by strings. Symbols of the path are looked up once per document and cached
+ *    by it (keyed by the hash of the path computed at construction).
+ *
+ * @note Path refers to the string it has been constructed from (it should be usually constructed
+ *    from string literals)
+ */
+class Path {
+
+public: /* ---------------------------------------------------- Public constants -------------------------------------------------- */
+
+    /// Keys separator
+    static constexpr char SEPARATOR = '.';
+
+    /// Maximal number of keys in the path
+    static constexpr std::size_t MAX_DEPTH = 8;
+
+public: /* ------------------------------------------------------ Public types ---------------------------------------------------- */
+
+    /// Type of the path's key
+    using key_type = std::string_view;
+    /// Iterator over keys of the path
+    using const_iterator = const key_type*;
+
+public: /* ------------------------------------------------- Public ctors & dtors ------------------------------------------------- */
+
+    /**
+     * @brief Compiles the @p path
+     *
+     * @param source
+     *    path to the child (keys separated with @ref SEPARATOR )
+     *
+     * @throws std::length_error
+     *    if @p source consists of more than @ref MAX_DEPTH keys (compile-time error for constexpr
+     *    paths)
+     */
+    explicit constexpr Path(std::string_view source);
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /// @returns source string of the path
+    constexpr std::string_view str() const;
+
+    /// @returns number of keys in the path
+    constexpr std::size_t depth() const;
+
+    /// @returns hash of the source string of the path (used to cache paths resolved by documents)
+    constexpr std::uint64_t hash() const;
+
+    /// @returns @p i 'th key of the path
+    constexpr key_type operator[](std::size_t i) const;
+
+    /// @returns iterator to the first key of the path
+    constexpr const_iterator begin() const;
+    /// @returns iterator past the last key of the path
+    constexpr const_iterator end() const;
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Source string of the path
+    std::string_view path;
+
+    /// Keys of the path
+    std::array<key_type, MAX_DEPTH> keys { };
+    /// Number of keys
+    std::size_t keys_num { 0 };
+
+    /// Hash of the source string (FNV-1a)
+    std::uint64_t path_hash { 0 };
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/eni/common/path/path.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
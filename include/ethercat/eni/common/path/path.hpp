@@ -0,0 +1,89 @@
+/* ============================================================================================================================ *//**
+ * @file       path.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:30:12 pm
+ * @modified   Sunday, 18th October 2026 1:40:45 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of inline methods of the Path class
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_COMMON_PATH_PATH_H__
+#define __ETHERCAT_COMMON_ENI_COMMON_PATH_PATH_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <stdexcept>
+// Private includes
+#include "ethercat/eni/common/path.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* ===================================================== Public ctors & dtors ===================================================== */
+
+constexpr Path::Path(std::string_view source) :
+    path{ source }
+{
+    // Hash the source string (FNV-1a)
+    path_hash = 0xcbf29ce484222325ULL;
+    for(char c : source)
+        path_hash = (path_hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+
+    // Split path into keys
+    while(true) {
+
+        if(keys_num == MAX_DEPTH)
+            throw std::length_error{ "[ethercat::eni::Path::Path] Path is too deep" };
+
+        auto separator_pos = source.find(SEPARATOR);
+        keys[keys_num++]   = source.substr(0, separator_pos);
+
+        if(separator_pos == std::string_view::npos)
+            break;
+
+        source.remove_prefix(separator_pos + 1);
+    }
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+constexpr std::string_view Path::str() const {
+    return path;
+}
+
+
+constexpr std::size_t Path::depth() const {
+    return keys_num;
+}
+
+
+constexpr std::uint64_t Path::hash() const {
+    return path_hash;
+}
+
+
+constexpr Path::key_type Path::operator[](std::size_t i) const {
+    return keys[i];
+}
+
+
+constexpr Path::const_iterator Path::begin() const {
+    return keys.data();
+}
+
+
+constexpr Path::const_iterator Path::end() const {
+    return keys.data() + keys_num;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
+
+#endif
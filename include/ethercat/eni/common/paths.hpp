@@ -0,0 +1,132 @@
+/* ============================================================================================================================ *//**
+ * @file       paths.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:30:12 pm
+ * @modified   Sunday, 18th October 2026 12:50:20 pm
+ * @project    ethercat-lib
+ * @brief      Precompiled paths of the ENI (EtherCAT Network Informations) elements accessed by the library's parsers
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_COMMON_PATHS_H__
+#define __ETHERCAT_COMMON_ENI_COMMON_PATHS_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Private includes
+#include "ethercat/eni/common/path.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni::details::paths {
+
+/* ======================================================= Configuration paths ==================================================== */
+
+/// Path to the <Config> element of the ENI file (relative to the document's root)
+inline constexpr Path CONFIG { "EtherCATConfig.Config" };
+
+/// Path to the <Master> element (relative to <Config>)
+inline constexpr Path MASTER { "Master" };
+/// Path to the <Cyclic> element (relative to <Config>)
+inline constexpr Path CYCLIC { "Cyclic" };
+/// Path to the <ProcessImage> element (relative to <Config>)
+inline constexpr Path PROCESS_IMAGE { "ProcessImage" };
+
+/* ========================================================== Common paths ======================================================== */
+
+/// Path to the name of the <Master>/<Slave> element
+inline constexpr Path INFO_NAME { "Info.Name" };
+/// Path to the name of the PDO, PDO entry and PDI variable
+inline constexpr Path NAME { "Name" };
+/// Path to the data type of the PDO entry and PDI variable
+inline constexpr Path DATA_TYPE { "DataType" };
+/// Path to the index of the PDO, PDO entry and init command
+inline constexpr Path INDEX { "Index" };
+/// Path to the subindex of the PDO entry and init command
+inline constexpr Path SUBINDEX { "SubIndex" };
+/// Path to the <Fixed> attribute of the PDO and init command
+inline constexpr Path FIXED_ATTRIBUTE { "<xmlattr>.Fixed" };
+
+/* ========================================================== Slave paths ========================================================= */
+
+/// Path to the physical address of the slave
+inline constexpr Path INFO_PHYS_ADDR { "Info.PhysAddr" };
+/// Path to the auto-increment address of the slave
+inline constexpr Path INFO_AUTO_INC_ADDR { "Info.AutoIncAddr" };
+/// Path to the vendor ID of the slave
+inline constexpr Path INFO_VENDOR_ID { "Info.VendorId" };
+/// Path to the product code of the slave
+inline constexpr Path INFO_PRODUCT_CODE { "Info.ProductCode" };
+/// Path to the revision number of the slave
+inline constexpr Path INFO_REVISION_NO { "Info.RevisionNo" };
+/// Path to the serial number of the slave
+inline constexpr Path INFO_SERIAL_NO { "Info.SerialNo" };
+/// Path to the <ProcessData> element of the slave
+inline constexpr Path PROCESS_DATA { "ProcessData" };
+/// Path to the <InitCmds> element of the slave's CoE mailbox
+inline constexpr Path COE_INIT_CMDS { "Mailbox.CoE.InitCmds" };
+
+/// Path to the <Sm> attribute of the PDO
+inline constexpr Path SM_ATTRIBUTE { "<xmlattr>.Sm" };
+/// Path to the bit length of the PDO entry
+inline constexpr Path BIT_LEN { "BitLen" };
+
+/// Path to the <CompleteAccess> attribute of the init command
+inline constexpr Path COMPLETE_ACCESS_ATTRIBUTE { "<xmlattr>.CompleteAccess" };
+/// Path to the comment of the init command
+inline constexpr Path COMMENT { "Comment" };
+/// Path to the timeout of the init command
+inline constexpr Path TIMEOUT { "Timeout" };
+/// Path to the CoE command specifier of the init command
+inline constexpr Path CCS { "Ccs" };
+/// Path to the data of the init command
+inline constexpr Path DATA { "Data" };
+
+/* ====================================================== Process image paths ===================================================== */
+
+/// Path to the inputs PDI description
+inline constexpr Path INPUTS { "Inputs" };
+/// Path to the outputs PDI description
+inline constexpr Path OUTPUTS { "Outputs" };
+/// Path to the size of the inputs PDI
+inline constexpr Path INPUTS_BYTE_SIZE { "Inputs.ByteSize" };
+/// Path to the size of the outputs PDI
+inline constexpr Path OUTPUTS_BYTE_SIZE { "Outputs.ByteSize" };
+/// Path to the bit size of the PDI variable
+inline constexpr Path BIT_SIZE { "BitSize" };
+/// Path to the bit offset of the PDI variable
+inline constexpr Path BIT_OFFS { "BitOffs" };
+
+/* ========================================================== Cyclic paths ======================================================== */
+
+/// Path to the cycle time
+inline constexpr Path CYCLE_TIME { "CycleTime" };
+/// Path to the identifier of the task exchanging cyclic data
+inline constexpr Path TASK_ID { "TaskId" };
+/// Path to the priority of the task exchanging cyclic data
+inline constexpr Path PRIORITY { "Priority" };
+/// Path to the type of the cyclic command
+inline constexpr Path CMD { "Cmd" };
+/// Path to the ADP (position/node address) of the cyclic command
+inline constexpr Path ADP { "Adp" };
+/// Path to the ADO (offset in the slave's memory) of the cyclic command
+inline constexpr Path ADO { "Ado" };
+/// Path to the logical address of the cyclic command
+inline constexpr Path ADDR { "Addr" };
+/// Path to the data length of the cyclic command
+inline constexpr Path DATA_LENGTH { "DataLength" };
+/// Path to the expected working counter of the cyclic command
+inline constexpr Path CNT { "Cnt" };
+/// Path to the offset of the cyclic command's data in the input PDI
+inline constexpr Path INPUT_OFFS { "InputOffs" };
+/// Path to the offset of the cyclic command's data in the output PDI
+inline constexpr Path OUTPUT_OFFS { "OutputOffs" };
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni::details::paths
+
+#endif
@@ -23,14 +23,14 @@
 #include <sstream>
 #include <filesystem>
 #include <string>
-// Boost includes
-#include <boost/property_tree/ptree.hpp>
 // Private includes
+#include "ethercat/common/utilities/string.hpp"
 #include "ethercat/eni/common.hpp"
 #include "ethercat/eni/master.hpp"
 #include "ethercat/eni/slave.hpp"
 #include "ethercat/eni/cyclic.hpp"
 #include "ethercat/eni/process_image.hpp"
+#include "ethercat/eni/validation.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
 
@@ -84,6 +84,12 @@ public: /* ---------------------------------------------- Public management meth
 
     /// Let user autonomize the element
     using Element::autonomize;
+    /// Let user check the source file of the element
+    using Element::get_source_path;
+    /// Let user check the hash of the source file of the element
+    using Element::get_source_hash;
+    /// Let user check whether the element has been mapped from the compiled cache
+    using Element::is_from_cache;
 
 public: /* --------------------------------------------------- Public methods ----------------------------------------------------- */
 
@@ -106,6 +112,9 @@ public: /* --------------------------------------------------- Public methods --
      *
      * @throws eni::Error
      *    if any of <Slave> ENI elements does not contain <Info>/<Name> element
+     * 
+     * @note Slaves are looked up in the index of slaves' names built on the first call (and 
+     *    shared by copies of the object). Building the index is not thread-safe (see [2])
      */
     std::optional<Slave> get_slave(std::string_view name) const;
 
@@ -135,6 +144,28 @@ public: /* --------------------------------------------------- Public methods --
      */
     std::optional<Slave> are_slaves_unique() const;
 
+    /**
+     * @brief Validates consistency of the whole ENI in a single pass
+     * @details Validation verifies that:
+     * 
+     *       - all slaves have unique names, physical and auto-increment addresses
+     *       - each entry of the assigned PDO has a matching variable in the <ProcessImage>
+     *         description with the same data type and bitsize
+     *       - PDI variables are byte-aligned (unless @ref config::BitAlignedPdoSupport is set)
+     *       - bit ranges of PDI variables mapped by PDO entries do not overlap (variables
+     *         not mapped by slaves' PDOs, e.g. working counter states, may alias each other)
+     * 
+     *    Unlike the Master's constructor, validation does not stop at the first problem found.
+     *    It can be used by offline tools to verify ENI files without constructing the Master.
+     * 
+     * @returns
+     *    report listing all issues found in the ENI
+     * 
+     * @throws eni::Error
+     *    if required ENI elements are missing or malformed
+     */
+    ValidationReport validate() const;
+
     /**
      * @returns
      *    parser object of the <Cyclic> tag of the ENI file
@@ -144,6 +175,13 @@ public: /* --------------------------------------------------- Public methods --
      */
     inline Cyclic get_cyclic() const;
 
+    /**
+     * @returns
+     *    parser objects of all <Cyclic> tags of the ENI file (one per task exchanging process
+     *    data with the bus, in order of the ENI)
+     */
+    std::vector<Cyclic> get_cyclics() const;
+
     /**
      * @returns
      *    parser object of the <ProcessImage> tag of the ENI file
@@ -152,6 +190,11 @@ public: /* --------------------------------------------------- Public methods --
      *    if <Config> ENI elements does not contain <ProcessImage> element
      */
     inline ProcessImage get_process_image() const;
+
+protected: /* ------------------------------------------------- Protected data --------------------------------------------------- */
+
+    /// Lazily-built index of slaves (by name)
+    mutable std::shared_ptr<const common::utilities::StringMap<Slave>> slaves_index;
     
 };
 
@@ -170,6 +213,28 @@ public: /* --------------------------------------------------- Public methods --
  */
 inline Configuration configruation_from_file(const std::filesystem::path &path);
 
+/**
+ * @brief Loads ENI property tree from the file located at @p path using compiled cache of the 
+ *    parsed tree. Obtains <Config> element from it.
+ * @details The cache holds the parsed (DOM) tree of the ENI rather than a serialized 
+ *    Configuration. Descriptors of the Configuration (slaves, PDOs, process image, ...) are
+ *    thin views decoding the tree on access, so loading from the cache skips XML parsing 
+ *    but descriptors are still decoded from the mapped tree when they are accessed.
+ * @see element_from_file_cached()
+ *
+ * @param path
+ *    path to the ENI file to be parsed
+ * @param cache_path
+ *    path to the cache file (if empty, @p path extended with the 
+ *    @ref config::eni::CompiledCacheExtension is used)
+ * @returns 
+ *    target element loaded from XML tree
+ * 
+ * @throws eni::Error
+ *    if ENI file could not be loaded
+ */
+inline Configuration configruation_from_file_cached(const std::filesystem::path &path, const std::filesystem::path &cache_path = { });
+
 /**
  * @brief Loads ENI property tree read into the runtime string . Obtains <Config> element from it.
  *
@@ -27,7 +27,7 @@ namespace ethercat::eni {
 /* ======================================================== Public methods ======================================================== */
 
 Master Configuration::get_master() const {
-    return get_child("Master");
+    return get_child(details::paths::MASTER);
 }
 
 
@@ -37,36 +37,33 @@ std::size_t Configuration::get_slaves_num() const {
 
 
 Cyclic Configuration::get_cyclic() const {
-    return get_child("Cyclic");
+    return get_child(details::paths::CYCLIC);
 }
 
 
 ProcessImage Configuration::get_process_image() const {
-    return get_child("ProcessImage");
+    return get_child(details::paths::PROCESS_IMAGE);
 }
 
 /* ==================================================== Auxiliary I/O functions =================================================== */
 
-namespace details {
-
-    /// Path to the <Config> element in the ENI file
-    constexpr auto ENI_CONFIG_ELEMENT_PATH = "EtherCATConfig.Config";
-
+Configuration configruation_from_file(const std::filesystem::path &path) {
+    return element_from_file(path).get_child(details::paths::CONFIG);
 }
 
 
-Configuration configruation_from_file(const std::filesystem::path &path) {
-    return element_from_file(path).get_child(details::ENI_CONFIG_ELEMENT_PATH);
+Configuration configruation_from_file_cached(const std::filesystem::path &path, const std::filesystem::path &cache_path) {
+    return element_from_file_cached(path, cache_path).get_child(details::paths::CONFIG);
 }
 
 
 Configuration configruation_from_string(const std::string &eni) {
-    return element_from_string(eni).get_child(details::ENI_CONFIG_ELEMENT_PATH);
+    return element_from_string(eni).get_child(details::paths::CONFIG);
 }
 
 
 Configuration configruation_from_stream(std::basic_istream<char> &stream) {
-    return element_from_stream(stream).get_child(details::ENI_CONFIG_ELEMENT_PATH);
+    return element_from_stream(stream).get_child(details::paths::CONFIG);
 }
 
 /* ================================================================================================================================ */
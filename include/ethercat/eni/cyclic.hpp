@@ -17,10 +17,11 @@
 /* =========================================================== Includes =========================================================== */
 
 // Standard includes
+#include <cstdint>
 #include <string>
 #include <chrono>
-// Boost includes
-#include "boost/property_tree/ptree.hpp"
+#include <optional>
+#include <vector>
 // Private includes
 #include "ethercat/eni/common.hpp"
 
@@ -42,6 +43,80 @@ class Cyclic : protected Element {
     /// Make Configruaiton class a friend to let it spawn Cyclic parsers
     friend class Configuration;
 
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /**
+     * @brief ESM states that the cyclic command can be associated with (values are bit flags 
+     *    so that set of states can be stored as a single mask)
+     */
+    enum class State : uint8_t {
+        Init      = 0x01,
+        Preop     = 0x02,
+        Bootstrap = 0x04,
+        Safeop    = 0x08,
+        Op        = 0x10
+    };
+
+    /**
+     * @brief Types of EtherCAT datagrams (commands) as given by the <Cmd> element
+     */
+    enum class CommandType : uint8_t {
+        NOP  = 0,
+        APRD = 1,
+        APWR = 2,
+        APRW = 3,
+        FPRD = 4,
+        FPWR = 5,
+        FPRW = 6,
+        BRD  = 7,
+        BWR  = 8,
+        BRW  = 9,
+        LRD  = 10,
+        LWR  = 11,
+        LRW  = 12,
+        ARMW = 13,
+        FRMW = 14
+    };
+
+    /**
+     * @brief Parsed description of the single cyclic command (<Cyclic>.<Frame>.<Cmd> element)
+     */
+    struct Command {
+
+        /// Type of the datagram
+        CommandType type;
+        /// Address of the datagram (ADP in lower and ADO in upper 16 bits or logical address)
+        uint32_t address;
+        /// Length of the datagram's data in bytes
+        std::size_t data_length;
+        /// Offset of the datagram's data in the input PDI in bytes
+        std::size_t input_offset;
+        /// Offset of the datagram's data in the output PDI in bytes
+        std::size_t output_offset;
+        /// Expected working counter of the datagram (@c 0 if not given)
+        uint16_t expected_wkc;
+        /// Mask of ESM states that the command is sent in (see @ref State)
+        uint8_t states;
+
+        /// @returns @c true if command is sent in the given ESM @p state
+        inline bool is_active_in(State state) const;
+        /// @returns @c true if data of the command is copied into the input PDI
+        inline bool reads_inputs() const;
+        /// @returns @c true if data of the command is taken from the output PDI
+        inline bool writes_outputs() const;
+
+    };
+
+    /**
+     * @brief Parsed description of the single cyclic frame (<Cyclic>.<Frame> element)
+     */
+    struct Frame {
+
+        /// Commands of the frame (in order of the ENI)
+        std::vector<Command> commands;
+
+    };
+
 public: /* ---------------------------------------------- Public management methods ----------------------------------------------- */
 
     /// Let user autonomize the element
@@ -58,6 +133,28 @@ public: /* --------------------------------------------------- Public methods --
      */
     inline std::chrono::microseconds get_cycle_time() const;
 
+    /**
+     * @returns
+     *    identifier of the task that the cyclic data is exchanged by (empty if not given)
+     */
+    inline std::optional<std::size_t> get_task_id() const;
+
+    /**
+     * @returns
+     *    priority of the task that the cyclic data is exchanged by (empty if not given)
+     */
+    inline std::optional<std::size_t> get_priority() const;
+
+    /**
+     * @returns
+     *    list of cyclic frames (in order of the ENI)
+     *
+     * @throws eni::Error
+     *    if any <Cmd> element of the frame is missing required elements (<Cmd>, <DataLength>)
+     *    or contains invalid values
+     */
+    std::vector<Frame> get_frames() const;
+
 protected: /* ---------------------------------------------- Protected ctors & dtors ---------------------------------------------- */
 
     /// Inherit all basic constructors
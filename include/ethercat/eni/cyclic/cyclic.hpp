@@ -23,10 +23,53 @@
 
 namespace ethercat::eni {
 
+/* =================================================== Command: Public methods ==================================================== */
+
+bool Cyclic::Command::is_active_in(State state) const {
+    return (states & static_cast<uint8_t>(state)) != 0;
+}
+
+
+bool Cyclic::Command::reads_inputs() const {
+    switch(type) {
+        case CommandType::APRD: case CommandType::APRW:
+        case CommandType::FPRD: case CommandType::FPRW:
+        case CommandType::BRD:  case CommandType::BRW:
+        case CommandType::LRD:  case CommandType::LRW:
+        case CommandType::ARMW: case CommandType::FRMW:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+bool Cyclic::Command::writes_outputs() const {
+    switch(type) {
+        case CommandType::APWR: case CommandType::APRW:
+        case CommandType::FPWR: case CommandType::FPRW:
+        case CommandType::BWR:  case CommandType::BRW:
+        case CommandType::LWR:  case CommandType::LRW:
+            return true;
+        default:
+            return false;
+    }
+}
+
 /* ======================================================== Public methods ======================================================== */
 
 std::chrono::microseconds Cyclic::get_cycle_time() const {
-    return std::chrono::microseconds{ get_child_value<int64_t>("CycleTime") };
+    return std::chrono::microseconds{ get_child_value<int64_t>(details::paths::CYCLE_TIME) };
+}
+
+
+std::optional<std::size_t> Cyclic::get_task_id() const {
+    return get_child_value_or_empty<std::size_t>(details::paths::TASK_ID);
+}
+
+
+std::optional<std::size_t> Cyclic::get_priority() const {
+    return get_child_value_or_empty<std::size_t>(details::paths::PRIORITY);
 }
 
 /* ================================================================================================================================ */
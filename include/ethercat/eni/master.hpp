@@ -19,8 +19,6 @@
 
 // Standard includes
 #include <string>
-// Boost includes
-#include <boost/property_tree/ptree.hpp>
 // Private includes
 #include "ethercat/eni/common.hpp"
 
@@ -26,7 +26,7 @@ namespace ethercat::eni {
 /* ======================================================== Public methods ======================================================== */
 
 std::string Master::get_name() const {
-    return get_child_value<std::string>("Info.Name");
+    return get_child_value<std::string>(details::paths::INFO_NAME);
 }
 
 /* ================================================================================================================================ */
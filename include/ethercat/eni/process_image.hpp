@@ -16,10 +16,12 @@
 
 /* =========================================================== Includes =========================================================== */
 
-// Boost includes
-#include "boost/property_tree/ptree.hpp"
+// Standard includes
+#include <array>
+#include <memory>
 // Private includes
 #include "ethercat/types.hpp"
+#include "ethercat/common/utilities/string.hpp"
 #include "ethercat/eni/common/error.hpp"
 #include "ethercat/eni/common/element.hpp"
 
@@ -232,6 +234,23 @@ public: /* ----------------------------------------------------- Public types --
         /// Type of the variable
         Type type{ };
 
+        /**
+         * @brief Fields of the variable's name split at construction (so that name-based lookups 
+         *    do not need to re-parse the name)
+         */
+        struct {
+
+            /// Fully qualified name of the variable
+            std::string fq_name;
+            /// Name of the slave associated with the variable (empty for non-slave variables)
+            std::string slave_name;
+            /// Name of the PDO/mapping that the variable is associated with
+            std::string pdo_name;
+            /// Specific name of the mapped variable
+            std::string name;
+
+        } names;
+
     };
 
     /**
@@ -386,6 +405,123 @@ public: /* ----------------------------------------------------- Public types --
 
     };
 
+    /**
+     * @brief Index of variables mapped into the PDIs built once from the ENI that provides
+     *    hash-based lookups of slave variables by names of the slave, PDO and the variable itself
+     *    (without re-parsing variables' descriptions on each lookup)
+     */
+    class Index {
+
+        /// Make ProcessImage class a friend to let it build the index
+        friend class ProcessImage;
+
+    public: /* Public types */
+
+        /**
+         * @brief Pre-parsed description of the slave variable mapped into the PDI
+         */
+        struct Entry {
+
+            /// Description of the variable
+            Variable variable;
+            /// Bit offset of the variable in the PDI
+            std::size_t bit_offset;
+            /// Bit size of the variable
+            std::size_t bit_size;
+            /// Data type of the variable
+            types::Type type;
+
+        };
+
+    public: /* Public methods */
+
+        /**
+         * @returns 
+         *    list of input and output variables mapped into the PDIs
+         */
+        inline const VariablesSet &get_variables() const;
+
+        /**
+         * @param slave_name 
+         *    name of the slave device
+         * @returns 
+         *    list of input and output variables related to the slave device named @p slave_name
+         *    (empty if there is no such a slave)
+         */
+        inline const VariablesSet &get_slave_variables(std::string_view slave_name) const;
+
+        /**
+         * @param direction 
+         *    direction of the image
+         * @param slave_name 
+         *    name of the slave device
+         * @param pdo_name 
+         *    name of the PDO
+         * @returns 
+         *    list of variables of the given @p direction associated with the PDO named @p pdo_name 
+         *    of the slave named @p slave_name (empty if there is no such a PDO)
+         */
+        inline const VariablesList &get_pdo_variables(
+            Direction direction,
+            std::string_view slave_name,
+            std::string_view pdo_name
+        ) const;
+
+        /**
+         * @param direction 
+         *    direction of the image
+         * @param slave_name 
+         *    name of the slave device
+         * @param pdo_name 
+         *    name of the PDO
+         * @param name 
+         *    name of the variable
+         * @returns 
+         *    pointer to the description of the variable or @c nullptr if there is no such a variable
+         */
+        inline const Entry *get_entry(
+            Direction direction,
+            std::string_view slave_name,
+            std::string_view pdo_name,
+            std::string_view name
+        ) const;
+
+    private: /* Private types */
+
+        /// Index of variables associated with a single PDO
+        struct PdoIndex {
+
+            /// Variables associated with the PDO
+            VariablesList variables;
+            /// Pre-parsed descriptions of variables associated with the PDO (by variable name)
+            common::utilities::StringMap<Entry> entries;
+
+        };
+
+        /// Index of variables associated with a single slave
+        struct SlaveIndex {
+
+            /// Variables associated with the slave
+            VariablesSet variables;
+            /// Indices of slave's PDOs (by PDO name) for subsequent directions
+            std::array<common::utilities::StringMap<PdoIndex>, 2> pdos;
+
+        };
+
+    private: /* Private ctors & dtors */
+
+        /// Builds index of the @p process_image
+        Index(const ProcessImage &process_image);
+
+    private: /* Private data */
+
+        /// All variables mapped into the PDIs
+        VariablesSet variables;
+        /// Indices of slaves (by slave name)
+        common::utilities::StringMap<SlaveIndex> slaves;
+
+    };
+
 public: /* ---------------------------------------------- Public management methods ----------------------------------------------- */
 
     /// Let user autonomize the element
@@ -442,11 +578,28 @@ public: /* ---------------------------------------------------- Public methods -
      */
     inline VariablesSet get_slave_variables(std::string_view name) const;
 
+    /**
+     * @returns 
+     *    index of variables mapped into the PDIs (built on the first call and shared by copies
+     *    of the object)
+     *
+     * @throws eni::Error
+     *    if <ProcessImage> ENI elements does not contain valid <Inputs/Outputs> element
+     * 
+     * @note Building the index is not thread-safe (see note [2] of the Configuration class)
+     */
+    inline const Index &get_index() const;
+
 protected: /* ---------------------------------------------- Protected ctors & dtors ---------------------------------------------- */
 
     /// Inherit all basic constructors
     using Element::Element;
 
+protected: /* -------------------------------------------------- Protected data --------------------------------------------------- */
+
+    /// Lazily-built index of variables
+    mutable std::shared_ptr<const Index> index;
+
 };
 
 /* ================================================================================================================================ */
@@ -17,6 +17,7 @@
 /* =========================================================== Includes =========================================================== */
 
 // Private includes
+#include "ethercat/common/utilities/enum.hpp"
 #include "ethercat/eni/process_image.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
@@ -27,8 +28,8 @@ namespace ethercat::eni {
 
 std::size_t ProcessImage::get_size(Direction direction) const {
     return ( direction == Direction::Inputs ) ?
-        get_child_value<std::size_t>("Inputs.ByteSize") :
-        get_child_value<std::size_t>("Outputs.ByteSize");
+        get_child_value<std::size_t>(details::paths::INPUTS_BYTE_SIZE) :
+        get_child_value<std::size_t>(details::paths::OUTPUTS_BYTE_SIZE);
 }
 
 
@@ -41,15 +42,88 @@ ProcessImage::VariablesSet ProcessImage::get_variables() const {
 
 
 ProcessImage::VariablesList ProcessImage::get_slave_variables(Direction direction, std::string_view name) const {
-    return get_variables(direction).get_slave_variables(name);
+    auto &variables = get_index().get_slave_variables(name);
+    return (direction == Direction::Inputs) ? variables.inputs : variables.outputs;
 }
 
 
 ProcessImage::VariablesSet ProcessImage::get_slave_variables(std::string_view name) const {
-    return VariablesSet {
-        .inputs  = get_slave_variables(Direction::Inputs,  name),
-        .outputs = get_slave_variables(Direction::Outputs, name)
-    };
+    return get_index().get_slave_variables(name);
+}
+
+
+const ProcessImage::Index &ProcessImage::get_index() const {
+
+    // Build index on the first call
+    if(not index)
+        index = std::shared_ptr<const Index>{ new Index{ *this } };
+
+    return *index;
+}
+
+/* ===================================================== Index: Public methods ==================================================== */
+
+const ProcessImage::VariablesSet &ProcessImage::Index::get_variables() const {
+    return variables;
+}
+
+
+const ProcessImage::VariablesSet &ProcessImage::Index::get_slave_variables(std::string_view slave_name) const {
+
+    static const VariablesSet empty;
+
+    if(auto slave = slaves.find(slave_name); slave != slaves.end())
+        return slave->second.variables;
+    else
+        return empty;
+}
+
+
+const ProcessImage::VariablesList &ProcessImage::Index::get_pdo_variables(
+    Direction direction,
+    std::string_view slave_name,
+    std::string_view pdo_name
+) const {
+
+    static const VariablesList empty;
+
+    // Find the slave
+    auto slave = slaves.find(slave_name);
+    if(slave == slaves.end())
+        return empty;
+
+    // Find the PDO
+    auto &pdos = slave->second.pdos[common::utilities::to_underlying(direction)];
+    if(auto pdo = pdos.find(pdo_name); pdo != pdos.end())
+        return pdo->second.variables;
+    else
+        return empty;
+}
+
+
+const ProcessImage::Index::Entry *ProcessImage::Index::get_entry(
+    Direction direction,
+    std::string_view slave_name,
+    std::string_view pdo_name,
+    std::string_view name
+) const {
+
+    // Find the slave
+    auto slave = slaves.find(slave_name);
+    if(slave == slaves.end())
+        return nullptr;
+
+    // Find the PDO
+    auto &pdos = slave->second.pdos[common::utilities::to_underlying(direction)];
+    auto pdo = pdos.find(pdo_name);
+    if(pdo == pdos.end())
+        return nullptr;
+
+    // Find the entry
+    if(auto entry = pdo->second.entries.find(name); entry != pdo->second.entries.end())
+        return &entry->second;
+    else
+        return nullptr;
 }
 
 /* ================================================================================================================================ */
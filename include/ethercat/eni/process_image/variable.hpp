@@ -108,7 +108,7 @@ std::string ProcessImage::Variable::get_fq_name() const {
      * @note Existance of the <Name> tage is verified in the constructor
      */
     
-    return get_child_value<std::string>("Name");
+    return names.fq_name;
 }
 
 
@@ -138,56 +138,35 @@ std::string ProcessImage::Variable::get_slave_name() const {
     if(type != Type::Slave)
         throw std::runtime_error{ "Variable is not related with any slave device" };
     
-    // Else, get fully qualified name split into elements by '.' delimiter
-    auto splitted_name = details::split_variable_name(get_fq_name());
-    // Else, return name
-    return splitted_name[details::SlaveVariableNamingScheme::SLAVE_NAME_FIELD_IDX];
+    return names.slave_name;
 }
 
 
 std::string ProcessImage::Variable::get_pdo_name() const {
-        
-    // Else, get fully qualified name split into elements by '.' delimiter
-    auto splitted_name = details::split_variable_name(get_fq_name());
-    // Else, return PDO name
-    return splitted_name[
-        (type == Type::Master) ? 
-            details::MasterVariableNamingScheme::PDO_NAME_FIELD_IDX : 
-            details::SlaveVariableNamingScheme::PDO_NAME_FIELD_IDX
-    ];
-
+    return names.pdo_name;
 }
 
 
 std::string ProcessImage::Variable::get_name() const {
-        
-    // Else, get fully qualified name split into elements by '.' delimiter
-    auto splitted_name = details::split_variable_name(get_fq_name());
-    // Else, return variable name
-    return splitted_name[
-        (type == Type::Master) ? 
-            details::MasterVariableNamingScheme::VARIABLE_NAME_FIELD_IDX : 
-            details::SlaveVariableNamingScheme::VARIABLE_NAME_FIELD_IDX 
-    ];
-    
+    return names.name;
 }
 
 
 types::Type ProcessImage::Variable::get_data_type() const {
     return types::Type::parse(
-        get_child_value<std::string>("DataType"),
+        get_child_value<std::string>(details::paths::DATA_TYPE),
         get_bit_size()
     );
 }
 
 
 std::size_t ProcessImage::Variable::get_bit_size() const {
-    return get_child_value<std::size_t>("BitSize");
+    return get_child_value<std::size_t>(details::paths::BIT_SIZE);
 }
 
 
 std::size_t ProcessImage::Variable::get_bit_offset() const {
-    return get_child_value<std::size_t>("BitOffs");
+    return get_child_value<std::size_t>(details::paths::BIT_OFFS);
 }
 
 
@@ -17,9 +17,8 @@
 /* =========================================================== Includes =========================================================== */
 
 // Standard includes
+#include <chrono>
 #include <optional>
-// Boost includes
-#include "boost/property_tree/ptree.hpp"
 // Private includes
 #include "ethercat/types.hpp"
 #include "ethercat/eni/common/error.hpp"
@@ -255,10 +254,144 @@ public: /* ----------------------------------------------------- Public types --
 
     };
 
+    /**
+     * @brief Auxiliary type implementing parsing interface for <InitCmd> elements of the 
+     *    <Mailbox>.<CoE>.<InitCmds> section of the <Slave> description (CoE commands sent
+     *    to the slave by the Master at ESM state transitions)
+     */
+    class InitCmd : protected Element { 
+    
+        /// Make Slave class a friend to let it spawn InitCmd parsers
+        friend class Slave;
+
+    public: /* Public management methods */
+
+        /// Let user autonomize the element
+        using Element::autonomize;
+        
+    public: /* Public methods */
+
+        /**
+         * @returns 
+         *    list of ESM transitions that the command is associated with in the ENI 
+         *    notation (e.g. 'PS' for PREOP -> SAFEOP)
+         */
+        std::vector<std::string> get_transitions() const;
+
+        /**
+         * @param transition 
+         *    ESM transition in the ENI notation (e.g. 'PS' for PREOP -> SAFEOP)
+         * @returns 
+         *    @retval @c true if command is associated with the given @p transition
+         *    @retval @c false otherwise
+         */
+        bool has_transition(std::string_view transition) const;
+
+        /**
+         * @returns 
+         *    @retval @c true if command is marked as fixed (i.e. it cannot be changed
+         *       by the configuration tool)
+         *    @retval @c false otherwise
+         */
+        bool is_fixed() const;
+
+        /**
+         * @returns 
+         *    @retval @c true if command should be performed using Complete Access
+         *    @retval @c false otherwise
+         */
+        bool is_complete_access() const;
+
+        /**
+         * @returns 
+         *    comment associated with the command (empty if none given)
+         */
+        inline std::string get_comment() const;
+
+        /**
+         * @returns 
+         *    timeout of the command (zero if none given)
+         */
+        inline std::chrono::milliseconds get_timeout() const;
+
+        /**
+         * @returns 
+         *    client command specifier of the command (1 for download, 2 for upload)
+         *
+         * @throws eni::Error
+         *    if <InitCmd> ENI element does not contain <Ccs>
+         */
+        inline std::size_t get_ccs() const;
+
+        /**
+         * @returns 
+         *    @retval @c true if the command is an SDO download request
+         *    @retval @c false otherwise
+         *
+         * @throws eni::Error
+         *    if <InitCmd> ENI element does not contain <Ccs>
+         */
+        inline bool is_download() const;
+
+        /**
+         * @returns 
+         *    index of the target object
+         *
+         * @throws eni::Error
+         *    if <InitCmd> ENI element does not contain <Index>
+         */
+        std::size_t get_index() const;
+
+        /**
+         * @returns 
+         *    subindex of the target object
+         *
+         * @throws eni::Error
+         *    if <InitCmd> ENI element does not contain <SubIndex>
+         */
+        inline std::size_t get_subindex() const;
+
+        /**
+         * @returns 
+         *    binary data of the command (decoded from the hex string)
+         *
+         * @throws eni::Error
+         *    if <InitCmd> ENI element contains invalid <Data>
+         */
+        std::vector<uint8_t> get_data() const;
+
+    protected: /* Protected ctors */
+
+        /// Inherit all basic constructors
+        using Element::Element;
+        
+    };
+
+    /**
+     * @brief Auxiliary wrapper around vector of CoE init commands descriptions providing 
+     *    additional methods for searching the list
+     */
+    struct InitCmdsList : public std::vector<InitCmd> {
+
+        /**
+         * @param transition 
+         *    ESM transition in the ENI notation (e.g. 'PS' for PREOP -> SAFEOP)
+         * @returns 
+         *    sublist of commands associated with the given @p transition (in order of 
+         *    appearance in the ENI)
+         */
+        inline InitCmdsList get_for_transition(std::string_view transition) const;
+
+    };
+
 public: /* ---------------------------------------------- Public management methods ----------------------------------------------- */
 
     /// Let user autonomize the element
     using Element::autonomize;
+    /// Let user check the source file of the element
+    using Element::get_source_path;
+    /// Let user check the hash of the source file of the element
+    using Element::get_source_hash;
 
 public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
 
@@ -289,6 +422,42 @@ public: /* ---------------------------------------------------- Public methods -
      */
     inline std::size_t get_auto_increment_addr() const;
 
+    /**
+     * @returns 
+     *    vendor ID of the slave
+     *
+     * @throws eni::Error
+     *    if <Info>.<VendorId> ENI element does not exist
+     */
+    inline std::size_t get_vendor_id() const;
+
+    /**
+     * @returns 
+     *    product code of the slave
+     *
+     * @throws eni::Error
+     *    if <Info>.<ProductCode> ENI element does not exist
+     */
+    inline std::size_t get_product_code() const;
+
+    /**
+     * @returns 
+     *    revision number of the slave
+     *
+     * @throws eni::Error
+     *    if <Info>.<RevisionNo> ENI element does not exist
+     */
+    inline std::size_t get_revision_no() const;
+
+    /**
+     * @returns 
+     *    serial number of the slave
+     *
+     * @throws eni::Error
+     *    if <Info>.<SerialNo> ENI element does not exist
+     */
+    inline std::size_t get_serial_no() const;
+
     /**
      * @param direction 
      *    direction of the PDOs to be inspected
@@ -318,6 +487,13 @@ public: /* ---------------------------------------------------- Public methods -
      */
     inline PdosSet get_assigned_pdos() const;
 
+    /**
+     * @returns 
+     *    list of CoE init commands defined for the slave (empty if slave has no
+     *    <Mailbox>.<CoE>.<InitCmds> section)
+     */
+    InitCmdsList get_init_cmds() const;
+
 protected: /* ---------------------------------------------- Protected ctors & dtors ---------------------------------------------- */
 
     /// Inherit all basic constructors
@@ -333,6 +509,7 @@ protected: /* ---------------------------------------------- Protected ctors & d
 
 #include "ethercat/eni/slave/entry.hpp"
 #include "ethercat/eni/slave/pdo.hpp"
+#include "ethercat/eni/slave/init_cmd.hpp"
 #include "ethercat/eni/slave/slave.hpp"
 
 /* ================================================================================================================================ */
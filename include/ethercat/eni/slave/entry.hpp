@@ -36,16 +36,16 @@ namespace details {
 /* ======================================================== Public methods ======================================================== */
 
 std::size_t Slave::Pdo::Entry::get_index() const {
-    return parse_index(get_child_value<std::string>("Index"));
+    return parse_index(get_child_value<std::string>(details::paths::INDEX));
 }
 
 std::size_t Slave::Pdo::Entry::get_subindex() const {
-    return get_child_value<std::size_t>("SubIndex");
+    return get_child_value<std::size_t>(details::paths::SUBINDEX);
 }
 
 
 std::size_t Slave::Pdo::Entry::get_bit_len() const {
-    return get_child_value<std::size_t>("BitLen");
+    return get_child_value<std::size_t>(details::paths::BIT_LEN);
 }
 
 
@@ -55,13 +55,13 @@ std::size_t Slave::Pdo::Entry::get_byte_len() const {
 
 
 std::string Slave::Pdo::Entry::get_name() const {
-    return get_child_value<std::string>("Name");
+    return get_child_value<std::string>(details::paths::NAME);
 }
 
 
 types::Type Slave::Pdo::Entry::get_data_type() const {
     return ethercat::types::Type::parse(
-        get_child_value<std::string>("DataType"),
+        get_child_value<std::string>(details::paths::DATA_TYPE),
         get_bit_len()
     );
 }
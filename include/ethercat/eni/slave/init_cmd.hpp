@@ -0,0 +1,71 @@
+/* ============================================================================================================================ *//**
+ * @file       init_cmd.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:31:40 am
+ * @modified   Sunday, 18th October 2026 12:30:12 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of inline methods of the InitCmd class implementing parsing interface of the <InitCmd> tag of the
+ *             ENI (EtherCAT Network Informations) tag
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_SLAVE_INIT_CMD_H__
+#define __ETHERCAT_COMMON_SLAVE_INIT_CMD_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+// Private includes
+#include "ethercat/eni/slave.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* ==================================================== InitCmd: Public methods =================================================== */
+
+std::string Slave::InitCmd::get_comment() const {
+    return get_child_value_or<std::string>(details::paths::COMMENT, std::string{ });
+}
+
+
+std::chrono::milliseconds Slave::InitCmd::get_timeout() const {
+    return std::chrono::milliseconds{ get_child_value_or<std::size_t>(details::paths::TIMEOUT, 0) };
+}
+
+
+std::size_t Slave::InitCmd::get_ccs() const {
+    return get_child_value<std::size_t>(details::paths::CCS);
+}
+
+
+bool Slave::InitCmd::is_download() const {
+    return (get_ccs() == 1);
+}
+
+
+std::size_t Slave::InitCmd::get_subindex() const {
+    return get_child_value<std::size_t>(details::paths::SUBINDEX);
+}
+
+/* ================================================= InitCmdsList: Public methods ================================================= */
+
+Slave::InitCmdsList Slave::InitCmdsList::get_for_transition(std::string_view transition) const {
+    
+    InitCmdsList ret;
+
+    // Copy commands that are associated with the given transition
+    std::copy_if(this->begin(), this->end(), std::back_insert_iterator(ret),
+        [&transition](const InitCmd &cmd){ return cmd.has_transition(transition); });
+
+    return ret;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
+
+#endif
@@ -37,12 +37,12 @@ bool Slave::Pdo::is_assigned() const {
 
 
 std::size_t Slave::Pdo::get_index() const {
-    return parse_index(get_child_value<std::string>("Index"));
+    return parse_index(get_child_value<std::string>(details::paths::INDEX));
 }
 
 
 std::string Slave::Pdo::get_name() const {
-    return get_child_value<std::string>("Name");
+    return get_child_value<std::string>(details::paths::NAME);
 }
 
 /* ================================================= Pdo: Protected ctors & dtors ================================================= */
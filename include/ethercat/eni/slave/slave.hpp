@@ -26,17 +26,37 @@ namespace ethercat::eni {
 /* ======================================================== Public methods ======================================================== */
 
 std::string Slave::get_name() const {
-    return get_child_value<std::string>("Info.Name");
+    return get_child_value<std::string>(details::paths::INFO_NAME);
 }
 
 
 std::size_t Slave::get_physical_addr() const {
-    return get_child_value<std::size_t>("Info.PhysAddr");
+    return get_child_value<std::size_t>(details::paths::INFO_PHYS_ADDR);
 }
 
 
 std::size_t Slave::get_auto_increment_addr() const {
-    return get_child_value<std::size_t>("Info.AutoIncAddr");
+    return get_child_value<std::size_t>(details::paths::INFO_AUTO_INC_ADDR);
+}
+
+
+std::size_t Slave::get_vendor_id() const {
+    return get_child_value<std::size_t>(details::paths::INFO_VENDOR_ID);
+}
+
+
+std::size_t Slave::get_product_code() const {
+    return get_child_value<std::size_t>(details::paths::INFO_PRODUCT_CODE);
+}
+
+
+std::size_t Slave::get_revision_no() const {
+    return get_child_value<std::size_t>(details::paths::INFO_REVISION_NO);
+}
+
+
+std::size_t Slave::get_serial_no() const {
+    return get_child_value<std::size_t>(details::paths::INFO_SERIAL_NO);
 }
 
 
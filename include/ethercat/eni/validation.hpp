@@ -0,0 +1,145 @@
+/* ============================================================================================================================ *//**
+ * @file       validation.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:13:11 pm
+ * @modified   Sunday, 18th October 2026 12:13:11 pm
+ * @project    ethercat-lib
+ * @brief      Definition of the ValidationReport class describing consistency of the ENI (EtherCAT Network Informations)
+ *             file
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_VALIDATION_H__
+#define __ETHERCAT_COMMON_ENI_VALIDATION_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* ============================================================= Class ============================================================ */
+
+/**
+ * @brief Report of the ENI consistency validation listing all issues found in the ENI file
+ *    (see Configuration::validate())
+ */
+class ValidationReport {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /**
+     * @brief Type of the issue found in the ENI
+     */
+    enum class IssueType {
+        NonUniqueName,
+        NonUniquePhysicalAddr,
+        NonUniqueAutoIncrementAddr,
+        MissingVariable,
+        TypeMismatch,
+        BitSizeMismatch,
+        UnalignedVariable,
+        OverlappingVariables
+    };
+
+    /**
+     * @brief Description of the single issue found in the ENI
+     */
+    struct Issue {
+
+        /// Type of the issue
+        IssueType type;
+        /// Name of the slave concerned by the issue
+        std::string slave;
+        /// Name of the PDO concerned by the issue (empty for slave-level issues)
+        std::string pdo;
+        /// Name of the PDO entry or PDI variable concerned by the issue (empty for slave-level issues)
+        std::string entry;
+        /// Human-readable description of the issue
+        std::string description;
+
+    };
+
+public: /* ------------------------------------------------- Public static methods ------------------------------------------------ */
+
+    /**
+     * @param type
+     *    type of the issue
+     * @returns
+     *    human-readable name of the issue type
+     */
+    static constexpr std::string_view issue_type_to_str(IssueType type);
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @retval true
+     *    if no issues has been found in the ENI
+     * @retval false
+     *    otherwise
+     */
+    inline bool is_valid() const;
+
+    /**
+     * @returns
+     *    list of all issues found in the ENI (in order of slaves' appearance in the ENI)
+     */
+    inline const std::vector<Issue> &get_issues() const;
+
+    /**
+     * @param type
+     *    type of the issue
+     * @returns
+     *    number of issues of the given @p type
+     */
+    inline std::size_t count(IssueType type) const;
+
+    /**
+     * @returns
+     *    multi-line, human-readable representation of the report (one line per issue)
+     */
+    std::string to_string() const;
+
+private: /* --------------------------------------------------- Private friends --------------------------------------------------- */
+
+    /// Make Configuration a friend to let it fill the report
+    friend class Configuration;
+
+private: /* ---------------------------------------------------- Private methods -------------------------------------------------- */
+
+    /// Appends a new issue to the report
+    inline void add_issue(
+        IssueType type,
+        std::string_view slave,
+        std::string_view pdo,
+        std::string_view entry,
+        std::string description
+    );
+
+private: /* ----------------------------------------------------- Private data ---------------------------------------------------- */
+
+    /// Issues found in the ENI
+    std::vector<Issue> issues;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/eni/validation/validation.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
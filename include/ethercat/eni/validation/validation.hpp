@@ -0,0 +1,79 @@
+/* ============================================================================================================================ *//**
+ * @file       validation.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:13:11 pm
+ * @modified   Sunday, 18th October 2026 12:13:11 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of inline methods of the ValidationReport class describing consistency of the ENI (EtherCAT
+ *             Network Informations) file
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_COMMON_ENI_VALIDATION_VALIDATION_H__
+#define __ETHERCAT_COMMON_ENI_VALIDATION_VALIDATION_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+// Private includes
+#include "ethercat/eni/validation.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* ===================================================== Public static methods ==================================================== */
+
+constexpr std::string_view ValidationReport::issue_type_to_str(IssueType type) {
+    switch(type) {
+        case IssueType::NonUniqueName:              return "NonUniqueName";
+        case IssueType::NonUniquePhysicalAddr:      return "NonUniquePhysicalAddr";
+        case IssueType::NonUniqueAutoIncrementAddr: return "NonUniqueAutoIncrementAddr";
+        case IssueType::MissingVariable:            return "MissingVariable";
+        case IssueType::TypeMismatch:               return "TypeMismatch";
+        case IssueType::BitSizeMismatch:            return "BitSizeMismatch";
+        case IssueType::UnalignedVariable:          return "UnalignedVariable";
+        case IssueType::OverlappingVariables:       return "OverlappingVariables";
+        default:
+            return "<Unknown>";
+    }
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+bool ValidationReport::is_valid() const {
+    return issues.empty();
+}
+
+
+const std::vector<ValidationReport::Issue> &ValidationReport::get_issues() const {
+    return issues;
+}
+
+
+std::size_t ValidationReport::count(IssueType type) const {
+    return static_cast<std::size_t>(std::count_if(issues.begin(), issues.end(),
+        [type](const auto &issue) { return issue.type == type; }));
+}
+
+/* ======================================================== Private methods ======================================================= */
+
+void ValidationReport::add_issue(
+    IssueType type,
+    std::string_view slave,
+    std::string_view pdo,
+    std::string_view entry,
+    std::string description
+) {
+    issues.push_back(Issue{ type, std::string{ slave }, std::string{ pdo }, std::string{ entry }, std::move(description) });
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
+
+#endif
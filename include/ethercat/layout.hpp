@@ -0,0 +1,172 @@
+/* ============================================================================================================================ *//**
+ * @file       layout.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:21:24 pm
+ * @modified   Sunday, 18th October 2026 12:21:24 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of compile-time descriptors of the Process Data Image layout generated from the ENI file
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_LAYOUT_H__
+#define __ETHERCAT_LAYOUT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+// Private includes
+#include "ethercat/config.hpp"
+#include "ethercat/common/types/traits.hpp"
+#include "ethercat/common/utilities/bit.hpp"
+#include "ethercat/eni/configuration.hpp"
+#include "ethercat/types.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+/**
+ * @brief Compile-time description of the Process Data Image (PDI) layout
+ * @details Headers holding layout of the PDI described by the given ENI file are generated at
+ *    build time with the @c eni_codegen tool (see @c add_eni_layout_header() CMake helper). The
+ *    generated header contains EntryDescriptor object and the typed Entry accessor for each
+ *    entry of the PDOs assigned to slaves, placed in nested namespaces named after the slave
+ *    and the PDO (converted to snake_case) inside the namespace given to the generator 
+ *    ( @c eni_layout by default). E.g. for the 'Status word' entry of the 'Inputs' PDO of the
+ *    'WheelRearLeft' slave:
+ *
+ *    @code
+ *       master.read_bus(timeout);
+ *       // Read entry at the fixed offset of the input PDI (no lookups, no runtime dispatch)
+ *       auto status_word = eni_layout::wheel_rear_left::inputs::status_word::read(master._get_input_buffer());
+ *    @endcode
+ *
+ *    As generated header may get out of sync with the ENI file loaded at runtime, application
+ *    should verify() it against the loaded ENI at startup.
+ *
+ * @note Accessors do not synchronise with the bus I/O. The input PDI is written by read_bus()
+ *    (and the output PDI is read by write_bus() ) under the Master's internal locks, which
+ *    are not taken by accessors. Accessors need to be used from the thread driving the bus 
+ *    I/O (e.g. between subsequent read_bus() and write_bus() calls or from their event
+ *    handlers), never concurrently with it.
+ */
+namespace ethercat::layout {
+
+/* ======================================================= EntryDescriptor ======================================================== */
+
+/**
+ * @brief Compile-time description of the PDO entry mapped into the PDI
+ */
+struct EntryDescriptor {
+
+    /// Name of the slave
+    std::string_view slave;
+    /// Name of the PDO
+    std::string_view pdo;
+    /// Name of the entry
+    std::string_view name;
+    /// Direction of the PDI that the entry is mapped into
+    eni::ProcessImage::Direction direction;
+    /// Bit offset of the entry in the PDI
+    std::size_t bit_offset;
+    /// Bit size of the entry
+    std::size_t bit_size;
+    /// Name of the entry's data type (see types::Type::get_name())
+    std::string_view type;
+
+};
+
+/* ============================================================ Entry ============================================================= */
+
+/**
+ * @brief Auxiliary alias for the default app-domain representation of the EtherCAT builtin type
+ */
+template<types::BuiltinType::ID type_id, std::size_t arity = 0>
+using Representation = common::types::traits::TypeRepresentation<type_id, arity>;
+
+/**
+ * @brief Typed accessor of the PDO entry mapped into the PDI at the fixed offset
+ * @details Offset and size of the entry are compile-time constants, so that accesses are fully
+ *    inlined into a plain copy of bytes (or bits if entry is not byte-aligned)
+ *
+ * @tparam descriptor
+ *    descriptor of the entry
+ * @tparam T
+ *    app-domain representation of the entry (@c bool for 1-bit and 8-bit booleans, trivially
+ *    copyable type of size matching the entry otherwise)
+ *
+ * @warning Similarly to DefaultTranslator, accessor assumes that the target platform uses
+ *    <b>Little Endian</b> format of data
+ */
+template<const EntryDescriptor &descriptor, typename T>
+struct Entry {
+
+    static_assert(std::is_trivially_copyable_v<T>,
+        "[ethercat::layout::Entry] Representation of the entry must be trivially copyable");
+    static_assert(std::is_same_v<T, bool> or sizeof(T) * common::utilities::bit::BITS_IN_BYTE == descriptor.bit_size,
+        "[ethercat::layout::Entry] Size of the representation does not match size of the entry");
+
+    /// Descriptor of the entry
+    static constexpr const EntryDescriptor &Descriptor = descriptor;
+    /// App-domain representation of the entry
+    using Type = T;
+
+    /// @c true if entry is byte-aligned in the PDI
+    static constexpr bool IsByteAligned =
+        (descriptor.bit_offset % common::utilities::bit::BITS_IN_BYTE == 0) and
+        (descriptor.bit_size   % common::utilities::bit::BITS_IN_BYTE == 0);
+
+    /**
+     * @param pdi
+     *    PDI buffer the entry is mapped into
+     * @returns
+     *    value of the entry
+     *
+     * @note @p pdi is required to cover the entry (see verify())
+     */
+    static inline T read(config::types::Span<const uint8_t> pdi);
+
+    /**
+     * @param pdi
+     *    PDI buffer the entry is mapped into
+     * @param value
+     *    value to be written to the entry
+     *
+     * @note @p pdi is required to cover the entry (see verify())
+     */
+    static inline void write(config::types::Span<uint8_t> pdi, const T &value);
+
+};
+
+/* ======================================================== Free functions ======================================================== */
+
+/**
+ * @brief Verifies that compile-time descriptors of entries match the layout of the PDI described
+ *    by the loaded @p eni
+ *
+ * @param eni
+ *    loaded ENI
+ * @param descriptors
+ *    descriptors to be verified (usually @c entries array of the generated header)
+ *
+ * @throws eni::Error
+ *    if any of @p descriptors does not match the @p eni (message lists all mismatches)
+ */
+void verify(const eni::Configuration &eni, config::types::Span<const EntryDescriptor * const> descriptors);
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::layout
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/layout/layout.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,79 @@
+/* ============================================================================================================================ *//**
+ * @file       layout.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:21:24 pm
+ * @modified   Sunday, 18th October 2026 12:21:24 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of inline methods of typed accessors of the Process Data Image layout generated from the ENI file
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_LAYOUT_LAYOUT_H__
+#define __ETHERCAT_LAYOUT_LAYOUT_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cstring>
+// Private includes
+#include "ethercat/layout.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::layout {
+
+/* ============================================================ Entry ============================================================= */
+
+template<const EntryDescriptor &descriptor, typename T>
+T Entry<descriptor, T>::read(config::types::Span<const uint8_t> pdi) {
+
+    using namespace common::utilities::bit;
+
+    // Booleans are represented by the single bit or the whole byte in the PDI
+    if constexpr(std::is_same_v<T, bool>) {
+        uint8_t raw { 0 };
+        copy_bits_from_bitshifted(pdi.data(), &raw, descriptor.bit_size, descriptor.bit_offset);
+        return (raw != 0);
+
+    // Byte-aligned entries are copied directly
+    } else if constexpr(IsByteAligned) {
+        T ret;
+        std::memcpy(&ret, pdi.data() + descriptor.bit_offset / BITS_IN_BYTE, sizeof(T));
+        return ret;
+
+    // Other entries are copied bit-by-bit
+    } else {
+        T ret;
+        copy_bits_from_bitshifted(pdi.data(), reinterpret_cast<uint8_t*>(&ret), descriptor.bit_size, descriptor.bit_offset);
+        return ret;
+    }
+}
+
+
+template<const EntryDescriptor &descriptor, typename T>
+void Entry<descriptor, T>::write(config::types::Span<uint8_t> pdi, const T &value) {
+
+    using namespace common::utilities::bit;
+
+    // Booleans are represented by the single bit or the whole byte in the PDI
+    if constexpr(std::is_same_v<T, bool>) {
+        uint8_t raw = value ? 1 : 0;
+        copy_bits_to_bitshifted(&raw, pdi.data(), descriptor.bit_size, descriptor.bit_offset);
+
+    // Byte-aligned entries are copied directly
+    } else if constexpr(IsByteAligned) {
+        std::memcpy(pdi.data() + descriptor.bit_offset / BITS_IN_BYTE, &value, sizeof(T));
+
+    // Other entries are copied bit-by-bit
+    } else
+        copy_bits_to_bitshifted(reinterpret_cast<const uint8_t*>(&value), pdi.data(), descriptor.bit_size, descriptor.bit_offset);
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::layout
+
+#endif
@@ -16,9 +16,21 @@
 
 /* =========================================================== Includes =========================================================== */
 
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <memory_resource>
 // Private includes
 #include "ethercat/config.hpp"
+#include "ethercat/common/pdi/entry_table.hpp"
+#include "ethercat/common/pdi/image_buffer.hpp"
 #include "ethercat/common/utilities/crtp.hpp"
+#include "ethercat/common/utilities/string_pool.hpp"
 #include "ethercat/common/handlers/event_handler.hpp"
 #include "ethercat/eni/configuration.hpp"
 #include "ethercat/slave.hpp"
@@ -83,6 +95,27 @@ public: /* ---------------------------------------------------- Public types ---
         WriteBusComplete,
 
     };
+
+    /// Identifier of the cyclic group (see @ref add_cyclic_group() )
+    using GroupId = std::size_t;
+
+    /**
+     * @brief Summary of the reconfiguration performed by @ref reload()
+     */
+    struct ReloadSummary {
+
+        /// Number of slaves kept (only offsets of their entries in the PDI might have been changed)
+        std::size_t kept_slaves { 0 };
+        /// Number of slaves (re)created by the implementation (new slaves and slaves whose description changed)
+        std::size_t rebuilt_slaves { 0 };
+        /// Number of slaves removed from the bus
+        std::size_t removed_slaves { 0 };
+        /// Number of PDOs carried over from the previous configuration (including PDOs moved to rebuilt slaves)
+        std::size_t kept_pdos { 0 };
+        /// Number of carried-over entries whose offset in the PDI has changed
+        std::size_t remapped_entries { 0 };
+
+    };
     
 public: /* ------------------------------------------------ Public static methods ------------------------------------------------- */
 
@@ -169,6 +202,12 @@ public: /* -------------------------------------------- Public EtherCAT common m
      */
     inline std::chrono::microseconds get_bus_cycle() const;
 
+    /**
+     * @returns 
+     *     cyclic frames (and commands they consist of) configured in the ENI file
+     */
+    inline const std::vector<eni::Cyclic::Frame> &get_cyclic_frames() const;
+
     /**
      * @brief Reads current state of the slave device in the ESM (EtherCAT slave machine)
      * 
@@ -199,6 +238,35 @@ public: /* -------------------------------------------- Public EtherCAT common m
      */
     inline void set_state(State state, std::chrono::milliseconds timeout = std::chrono::milliseconds{ 100 });
 
+    /**
+     * @brief Executes CoE init commands described in the ENI for the @p from -> @p to transition
+     *    of all slaves on the bus
+     * @details Commands of each slave are executed in order of appearance in the ENI. If enabled
+     *    with @ref config::init_cmds::ExecutionThreadsNum , commands of different slaves are 
+     *    executed concurrently (slaves are served one by one by a bounded pool of threads) so 
+     *    that mailbox round-trips to subsequent slaves overlap. This requires @a download_sdo(...)
+     *    / @a upload_sdo(...) methods of the slave implementation to be safe to call concurrently
+     *    for distinct slaves. By default slaves are served sequentially.
+     * 
+     * @param from 
+     *    source state of the transition
+     * @param to 
+     *    target state of the transition
+     * @param timeout 
+     *    access timeout used for commands that do not define timeout on their own
+     * 
+     * @throws implementation-specific
+     *    eror on failure (the first error is rethrown after all slaves finished execution)
+     * 
+     * @note This method is called automatically by @ref set_state() if 
+     *    @ref config::init_cmds::ExecuteAtStateChange is enabled
+     */
+    inline void execute_init_cmds(
+        State from,
+        State to,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds{ 100 }
+    );
+
 public: /* --------------------------------------------- Public EtherCAT I/O methods ---------------------------------------------- */
 
     
@@ -208,7 +276,7 @@ public: /* --------------------------------------------- Public EtherCAT I/O met
      * 
      * @note This metho is only for debugging purposes
      */
-    inline std::vector<uint8_t> &_get_input_buffer();
+    inline common::pdi::ImageBuffer &_get_input_buffer();
     
     /**
      * @returns 
@@ -216,7 +284,7 @@ public: /* --------------------------------------------- Public EtherCAT I/O met
      * 
      * @note This metho is only for debugging purposes
      */
-    inline const std::vector<uint8_t> &_get_input_buffer() const;
+    inline const common::pdi::ImageBuffer &_get_input_buffer() const;
     
     /**
      * @returns 
@@ -224,7 +292,7 @@ public: /* --------------------------------------------- Public EtherCAT I/O met
      * 
      * @note This metho is only for debugging purposes
      */
-    inline std::vector<uint8_t> &_get_output_buffer();
+    inline common::pdi::ImageBuffer &_get_output_buffer();
     
     /**
      * @returns 
@@ -232,7 +300,7 @@ public: /* --------------------------------------------- Public EtherCAT I/O met
      * 
      * @note This metho is only for debugging purposes
      */
-    inline const std::vector<uint8_t> &_get_output_buffer() const;
+    inline const common::pdi::ImageBuffer &_get_output_buffer() const;
 
     /**
      * @brief Reads Input Process Data Image from the bus updating slave's input PDOs after I/O.
@@ -244,6 +312,10 @@ public: /* --------------------------------------------- Public EtherCAT I/O met
      *       2) update all slaves from input PDI
      *       3) call 'input PDO update end' handler
      * 
+     *    If the implementation provides per-command I/O (@a read_command_impl() ), reading
+     *    is performed command-by-command for cyclic commands active in the current state
+     *    of the master and only entries covered by completed commands are updated.
+     * 
      * @param[in] timeout
      *    timeout of the I/O operation
      * 
@@ -261,6 +333,11 @@ public: /* --------------------------------------------- Public EtherCAT I/O met
      *       3) call 'output PDO update end' handler
      *       4) perform writting
      *       5) call 'write end' handler
+     *       6) serve mailbox tasks fitting into the slack of the cycle (see @ref schedule_mailbox_task() )
+     * 
+     *    If the implementation provides per-command I/O (@a write_command_impl() ), writing
+     *    is performed command-by-command for cyclic commands active in the current state
+     *    of the master and only entries covered by these commands are written to the PDI.
      * 
      * @param[in] timeout
      *    timeout of the I/O operation
@@ -270,6 +347,179 @@ public: /* --------------------------------------------- Public EtherCAT I/O met
      */
     void write_bus(std::chrono::milliseconds timeout);
 
+public: /* ------------------------------------------ Public mailbox scheduling methods ------------------------------------------- */
+
+    /**
+     * @brief Schedules mailbox @p task (e.g. SDO transfer) to be executed in the slack time 
+     *    of the bus cycle
+     * @details Queued tasks are served by @ref write_bus() after the output PDI has been written.
+     *    Remaining slack of the cycle is calculated as a difference between the bus cycle (see
+     *    @ref get_bus_cycle() ) and the time elapsed since the entry to the last @ref read_bus() 
+     *    call. Tasks are executed in order of scheduling for as long as their estimated execution
+     *    time (plus @ref config::mailbox::SlackGuard ) fits into the remaining slack. Remaining
+     *    tasks are left for the next cycle. This way mailbox traffic does not compete with the
+     *    cyclic I/O for the backend and does not increase cyclic jitter. Until the first 
+     *    @ref read_bus() call (e.g. during startup) slack is considered unlimited and all queued 
+     *    tasks are served by @ref write_bus() .
+     * 
+     * @param task 
+     *    task to be executed
+     * @param estimate 
+     *    estimated execution time of the task; if zero, running average of measured execution
+     *    times of tasks executed so far is used
+     * @returns 
+     *    future object signalled when the task is executed (carries exception thrown by the task)
+     * 
+     * @note Tasks are executed in the context of the thread calling @ref write_bus() 
+     */
+    inline std::future<void> schedule_mailbox_task(
+        std::function<void()> task,
+        std::chrono::microseconds estimate = std::chrono::microseconds{ 0 }
+    );
+
+    /**
+     * @returns 
+     *    number of mailbox tasks waiting for execution
+     */
+    inline std::size_t get_pending_mailbox_tasks_num() const;
+
+    /**
+     * @returns 
+     *    slack of the last bus cycle measured at the end of @ref write_bus() (before serving 
+     *    mailbox tasks)
+     */
+    inline std::chrono::microseconds get_last_cycle_slack() const;
+
+public: /* --------------------------------------------- Public cyclic groups methods --------------------------------------------- */
+
+    /**
+     * @brief Creates cyclic group of slaves that are processed only every @p rate_divisor-th
+     *    bus cycle
+     * @details In cycles that the group is not due in, PDO entries of group's slaves are not
+     *    copied from/to the PDI, slaves are not notified and group's event handlers are not
+     *    called. Slaves not assigned to any group are processed in every cycle. Cycles are
+     *    counted by @ref read_bus() and @ref write_bus() processes groups due in the cycle
+     *    started by the last call to @ref read_bus() . 
+     * 
+     *    This lets e.g. servo drives be served at the full rate of the bus while hundreds
+     *    of slow I/O terminals are processed at a fraction of it:
+     * 
+     *    @code
+     *       auto slow_io = master.add_cyclic_group({ "Terminal 1", "Terminal 2" }, 40);
+     *       master.register_group_event_handler(slow_io, Event::ReadBusSlavesUpdateComplete, update_slow_io);
+     *    @endcode
+     * 
+     * @param slave_names 
+     *    names of slaves belonging to the group
+     * @param rate_divisor 
+     *    number of bus cycles per single cycle of the group
+     * @returns 
+     *    identifier of the created group
+     * 
+     * @throws std::out_of_range 
+     *    if no slave named as one of @p slave_names is present on the bus
+     * @throws std::runtime_error
+     *    if @p rate_divisor is zero or one of slaves already belongs to another group
+     * 
+     * @note Groups are kept across @ref reload() (slaves are matched by names)
+     * @warning Method must not be called concurrently with @ref read_bus() and @ref write_bus()
+     */
+    GroupId add_cyclic_group(const std::vector<std::string_view> &slave_names, std::size_t rate_divisor);
+
+    /**
+     * @param group 
+     *    identifier of the group
+     * @returns 
+     *    @retval @c true if @p group is processed in the current bus cycle
+     *    @retval @c false otherwise
+     * 
+     * @throws std::out_of_range 
+     *    if invalid @p group given
+     */
+    inline bool is_cyclic_group_due(GroupId group) const;
+
+    /**
+     * @brief Registers custom handler for the given @p event of the cyclic @p group (called
+     *    only in cycles that the group is due in, after handler registered for the master)
+     * 
+     * @tparam HandlerT 
+     *    type of the handler functor
+     * @param group 
+     *    identifier of the group
+     * @param event 
+     *    target event
+     * @param handler 
+     *    handler to be registered
+     * 
+     * @throws std::out_of_range 
+     *    if invalid @p group or @p event given
+     */
+    template<typename HandlerT>
+    void register_group_event_handler(GroupId group, Event event, HandlerT &&handler);
+
+    /**
+     * @brief Unregsters custom handler for the given @p event of the cyclic @p group
+     * 
+     * @param group 
+     *    identifier of the group
+     * @param event 
+     *    target event
+     * 
+     * @throws std::out_of_range 
+     *    if invalid @p group or @p event given
+     */
+    void unregister_group_event_handler(GroupId group, Event event);
+
+public: /* -------------------------------------------- Public reconfiguration methods -------------------------------------------- */
+
+    /**
+     * @brief Reconfigures the master according to the new @p eni without recreating it
+     * @details New configuration is compared against the current one and only parts that
+     *    differ are rebuilt:
+     * 
+     *       - slaves described identically (same name, addresses, identity and layout of PDOs)
+     *         are kept as they are; only their entries are moved to the new tables of
+     *         entries (with their current data) and their CoE init commands are recompiled
+     *       - other slaves are (re)created with the slave factory given at construction;
+     *         however PDOs of the previous incarnation of the slave (same name) that map the
+     *         same entries are carried over to the new slave
+     *       - slaves that are no longer described are removed
+     *       - PDI buffers are resized (and zeroed) and the bus cycle is updated
+     * 
+     *    In result all PDO entries (and so all References obtained from them) whose layout
+     *    did not change remain valid. Before the master is modified, the implementation is
+     *    asked to apply the new configuration to the backend by calling:
+     * 
+     *        void reload_impl(const eni::Configuration &eni);
+     * 
+     *    If validation of the @p eni , creation of new slaves, allocation of new PDI buffers
+     *    and tables or the backend's reconfiguration fails, the master is left untouched.
+     * 
+     * @param eni 
+     *    new ENI configuration of the bus
+     * @returns 
+     *    summary of the performed reconfiguration
+     * 
+     * @throws eni::Error 
+     *    if inconsistency has been found in the @p eni configuration
+     * @throws implementation-specific
+     *    whatever the slave factory or @a reload_impl() throws
+     * 
+     * @note Slave interfaces are kept, but may be relocated. Pointers and references to slaves
+     *    (see @ref get_slave() ) need to be reacquired after the call.
+     * @warning This method must not be called concurrently with other methods of the master
+     *    (in particular with bus I/O) nor with accesses to PDO entries via References
+     */
+    ReloadSummary reload(eni::Configuration eni);
+
+protected: /* -------------------------------------------------- Protected types -------------------------------------------------- */
+
+    /**
+     * @brief Tag type selecting two-phase construction of the master (see 
+     *    Master(const std::filesystem::path &, SlaveFactoryT&&, Deferred) )
+     */
+    struct Deferred { explicit Deferred() = default; };
+
 protected: /* --------------------------------------------- Protected ctors & dtors ----------------------------------------------- */
 
     /**
@@ -282,14 +532,23 @@ protected: /* --------------------------------------------- Protected ctors & dt
      * @param slave_factory 
      *    factory-like functor provided by the implementation class that can construct
      *    implementation-specific slave interfaces (see [1])
+     * @param resource 
+     *    memory resource that cycle-critical data of the master (see [1]) is allocated from
      *
      * @throws eni::Error
      *    if ENI file could not be loaded
      * 
-     * @see [1] Master(eni::Configuration &&, SlaveFactoryT)
+     * @note If @ref config::eni::UseCompiledCache is @c true, the compiled cache of the ENI
+     *    is kept next to the file (see eni::configruation_from_file_cached())
+     * 
+     * @see [1] Master(eni::Configuration &&, SlaveFactoryT, std::pmr::memory_resource *)
      */
     template<typename SlaveFactoryT>
-    inline Master(const std::filesystem::path &eni_path, SlaveFactoryT&& slave_factory);
+    inline Master(
+        const std::filesystem::path &eni_path,
+        SlaveFactoryT&& slave_factory,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+    );
 
     /**
      * @brief Construct a new Master interface
@@ -301,14 +560,20 @@ protected: /* --------------------------------------------- Protected ctors & dt
      * @param slave_factory 
      *    factory-like functor provided by the implementation class that can construct
      *    implementation-specific slave interfaces (see [1])
+     * @param resource 
+     *    memory resource that cycle-critical data of the master (see [1]) is allocated from
      *
      * @throws eni::Error
      *    if ENI file could not be loaded
      * 
-     * @see [1] Master(eni::Configuration &&, SlaveFactoryT)
+     * @see [1] Master(eni::Configuration &&, SlaveFactoryT, std::pmr::memory_resource *)
      */
     template<typename SlaveFactoryT>
-    inline Master(const std::string &eni, SlaveFactoryT&& slave_factory);
+    inline Master(
+        const std::string &eni,
+        SlaveFactoryT&& slave_factory,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+    );
 
     /**
      * @brief Construct a new Master interface
@@ -320,14 +585,61 @@ protected: /* --------------------------------------------- Protected ctors & dt
      * @param slave_factory 
      *    factory-like functor provided by the implementation class that can construct
      *    implementation-specific slave interfaces (see [1])
+     * @param resource 
+     *    memory resource that cycle-critical data of the master (see [1]) is allocated from
      *
      * @throws eni::Error
      *    if ENI file could not be loaded
      * 
-     * @see [1] Master(eni::Configuration &&, SlaveFactoryT)
+     * @see [1] Master(eni::Configuration &&, SlaveFactoryT, std::pmr::memory_resource *)
      */
     template<typename SlaveFactoryT>
-    inline Master(std::basic_istream<char> &stream, SlaveFactoryT&& slave_factory);
+    inline Master(
+        std::basic_istream<char> &stream,
+        SlaveFactoryT&& slave_factory,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+    );
+
+    /**
+     * @brief Starts two-phase construction of a new Master interface
+     * @details Constructor returns immediately. The ENI file is loaded, validated and PDOs of 
+     *    slaves are prepared in the background, while the implementation class brings up its
+     *    transport (e.g. hardware or sockets) in its own constructor. Construction is completed
+     *    with @ref finish_construction() that the implementation is required to call before the
+     *    master is used (usually at the end of its constructor):
+     * 
+     *    @code
+     *       Master(cifx::Channel &channel) :
+     *           ethercat::Master<Master, Slave>{ eni_path, make_slave, Deferred{ } },
+     *           channel{ channel }
+     *       {
+     *           bring_up_channel();     // Overlaps with loading the ENI
+     *           finish_construction();  // Waits for the ENI and creates slaves
+     *       }
+     *    @endcode
+     *
+     * @tparam SlaveFactoryT 
+     *    type of the @p slave_factory functor
+     * @param eni_path
+     *    path to the ENI file describing the bus to be parsed
+     * @param slave_factory 
+     *    factory-like functor provided by the implementation class that can construct
+     *    implementation-specific slave interfaces (see [1])
+     * @param resource 
+     *    memory resource that cycle-critical data of the master (see [1]) is allocated from
+     * 
+     * @note If @ref config::eni::UseCompiledCache is @c true, the compiled cache of the ENI
+     *    is kept next to the file (see eni::configruation_from_file_cached())
+     * 
+     * @see [1] Master(eni::Configuration &&, SlaveFactoryT, std::pmr::memory_resource *)
+     */
+    template<typename SlaveFactoryT>
+    inline Master(
+        const std::filesystem::path &eni_path,
+        SlaveFactoryT&& slave_factory,
+        Deferred,
+        std::pmr::memory_resource *resource = std::pmr::get_default_resource()
+    );
 
     /// Disable copy-construction semantic
     Master(const Master &rmaster) = delete;
@@ -338,10 +650,26 @@ protected: /* --------------------------------------------- Protected ctors & dt
     /// Disable move-asignment semantic
     Master &operator=(Master &&rmaster) = delete;
 
+protected: /* ---------------------------------------------- Protected methods ---------------------------------------------------- */
+
+    /**
+     * @brief Completes two-phase construction of the master started with 
+     *    Master(const std::filesystem::path &, SlaveFactoryT&&, Deferred)
+     * @details Waits until the ENI is loaded in the background and creates slave interfaces.
+     *    If construction has not been deferred (or it has been already completed), the method
+     *    does nothing.
+     * 
+     * @throws eni::Error
+     *    if ENI file could not be loaded or inconsistency has been found in it
+     * @throws error  
+     *    whatever the slave factory throws
+     */
+    inline void finish_construction();
+
 protected: /* ------------------------------------------------ Protected data ----------------------------------------------------- */
 
-    /// Bus cycle in [us]
-    const std::chrono::microseconds bus_cycle;
+    /// Bus cycle in [us] (updated by @ref reload() )
+    std::chrono::microseconds bus_cycle { 0 };
 
 private: /* ------------------------------------------------ Private ctors & dtors ------------------------------------------------ */
 
@@ -358,54 +686,91 @@ private: /* ------------------------------------------------ Private ctors & dto
      *    implementation-specific slave interfaces. It should provide call operator with
      *    the following signature:
      * 
-     *        template<typename PdoEntryRegistrationProxyT>
      *        SlaveT operator()(
      *            eni::Slave slave_eni,
-     *            PdoEntryRegistrationProxyT make_entry
+     *            std::vector<SlaveT::Pdo<SlaveT::PdoDirection::Input>> &&inputs,
+     *            std::vector<SlaveT::Pdo<SlaveT::PdoDirection::Output>> &&outputs
      *        );
      * 
+     *    where @a inputs and @a outputs are PDOs of the slave prepared by the master (with
+     *    entries already registered in the master's tables) that are to be passed to the
+     *    constructor of the Slave. The factory is kept by the master for its whole lifetime to create slaves added by
+     *    @ref reload()
+     * @param resource 
+     *    memory resource that cycle-critical data of the master is allocated from, i.e. 
+     *    tables of PDO entries (including their data), table of cyclic commands and the list
+     *    of slave interfaces. It has to outlive the master. PDO and entry descriptors owned by
+     *    slave interfaces (passed to the @p slave_factory ) are allocated with the default
+     *    allocator, as they are not accessed by the bus I/O. PDI buffers are not allocated 
+     *    from the resource; each of them is placed in its own prefaulted (and, depending on
+     *    @ref config::pdi , locked and hugepage-backed) memory mapping.
+     * 
      * @throws eni::Error 
      *    if inconsistency has been found in the @p eni configuration
      * @throws error  
      *    whatever @p slave_factory throws
      */
     template<typename SlaveFactoryT>
-    Master(eni::Configuration &&eni, SlaveFactoryT&& slave_factory);
+    Master(eni::Configuration &&eni, SlaveFactoryT&& slave_factory, std::pmr::memory_resource *resource);
 
 private: /* -------------------------------------------------- Private types ------------------------------------------------------ */
 
-    /**
-     * @brief Auxiliary class wrapping a dynamic-size bytes-buffer storing process data 
-     *    exchanged with the bus
-     */
-    struct ProcessDataImageBuffer {
-
-        /// Synchronisation lock
-        config::types::Lock lock;
-        /// Data bufffer
-        std::vector<uint8_t> data;
+    /// Type of the input PDO of the slave
+    using InputPdo = typename SlaveT::template Pdo<SlaveT::PdoDirection::Input>;
+    /// Type of the output PDO of the slave
+    using OutputPdo = typename SlaveT::template Pdo<SlaveT::PdoDirection::Output>;
+    /// Type of input PDO entries
+    using InputEntry = typename InputPdo::Entry;
+    /// Type of output PDO entries
+    using OutputEntry = typename OutputPdo::Entry;
 
-        /// Constructs buffer of the given size with data bytes reset to @c 0
-        inline ProcessDataImageBuffer(std::size_t size) :
-            data(size, static_cast<uint8_t>(0))
-        { }
+    /// PDOs of the single slave prepared before the slave is constructed
+    struct SlavePdos {
+        std::vector<InputPdo> inputs;
+        std::vector<OutputPdo> outputs;
+    };
 
+    /**
+     * @brief Flat tables holding entries of all slaves (rows are sorted by offsets of entries
+     *    in the PDI; tables are kept on the heap, so that entries refer to them when moved)
+     */
+    struct EntryTables {
+        std::unique_ptr<common::pdi::EntryTable> inputs;
+        std::unique_ptr<common::pdi::EntryTable> outputs;
     };
 
-private: /* --------------------------------------------------- Private data ------------------------------------------------------ */
+    /// Type-erased slave factory (see Master(eni::Configuration &&, SlaveFactoryT, std::pmr::memory_resource *) )
+    using SlaveFactory = std::function<SlaveT(eni::Slave, std::vector<InputPdo>&&, std::vector<OutputPdo>&&)>;
 
-    /// Input Process Data Image buffer
-    ProcessDataImageBuffer input_pdi;
-    /// Output Process Data Image buffer
-    ProcessDataImageBuffer output_pdi;
+    /**
+     * @brief Validated ENI configuration with all data required to build the master prepared
+     *    (everything but creation of slave interfaces that is done by the implementation)
+     */
+    struct PreparedConfiguration {
 
-    /// List of slave interfaces representing devices on the bus
-    std::vector<SlaveT> slaves;
+        /// ENI configuration of the bus
+        eni::Configuration eni;
+        /// ENI descriptions of slaves
+        std::vector<eni::Slave> slave_eni_list;
+        /// PDOs of subsequent slaves
+        std::vector<SlavePdos> slaves_pdos;
+        /// Tables holding entries of all PDOs
+        EntryTables entries;
+        /// Size of the input PDI in bytes
+        std::size_t input_pdi_size;
+        /// Size of the output PDI in bytes
+        std::size_t output_pdi_size;
+        /// Bus cycle
+        std::chrono::microseconds bus_cycle;
+        /// Cyclic frames
+        std::vector<eni::Cyclic::Frame> cyclic_frames;
+
+    };
 
     /**
      * @brief Set of handlers for master-related events
      */
-    struct {
+    struct Handlers {
 
         /// Handler triggerred at the entry to @ref read_bus method
         common::handlers::EventHandler at_read_bus_start;
@@ -421,7 +786,413 @@ private: /* --------------------------------------------------- Private data ---
         /// Handler triggerred when the bus-write action is completed
         common::handlers::EventHandler at_write_bus_complete;
 
-    } handlers;
+    };
+
+    /**
+     * @brief Auxiliary class describing cyclic group of slaves (see @ref add_cyclic_group() )
+     */
+    struct CyclicGroup {
+
+        /// Number of bus cycles per single cycle of the group
+        std::size_t rate_divisor { 1 };
+        /// Names of slaves belonging to the group (interned in the @a names pool)
+        std::vector<common::utilities::Symbol> slaves;
+        /// @c true if the group is processed in the current bus cycle
+        bool due { true };
+        /// Handlers of group's events
+        Handlers handlers;
+
+    };
+
+    /// Table of cyclic commands of the bus (see @ref index_cyclic_commands() )
+    struct CyclicTable;
+
+private: /* ----------------------------------------------- Private static methods ------------------------------------------------ */
+
+    /**
+     * @brief Wraps @p slave_factory into the type-erased factory kept by the master
+     * 
+     * @tparam SlaveFactoryT 
+     *    type of the @p slave_factory functor
+     * @param slave_factory 
+     *    slave factory (see Master(eni::Configuration &&, SlaveFactoryT, std::pmr::memory_resource *) )
+     * @returns 
+     *    type-erased factory (@p slave_factory is shared, so that move-only factories are supported)
+     */
+    template<typename SlaveFactoryT>
+    static inline SlaveFactory make_slave_factory(SlaveFactoryT&& slave_factory);
+
+    /**
+     * @param eni_path 
+     *    path to the ENI file
+     * @returns 
+     *    ENI configuration loaded from the file (with use of the compiled cache if 
+     *    @ref config::eni::UseCompiledCache is @c true )
+     * 
+     * @throws eni::Error
+     *    if ENI file could not be loaded
+     */
+    static inline eni::Configuration load_eni(const std::filesystem::path &eni_path);
+
+    /**
+     * @brief Validates the @p eni and prepares data required to build the master
+     * 
+     * @param eni 
+     *    ENI configuration of the bus
+     * @param names 
+     *    pool that names of slaves, PDOs and entries are interned in
+     * @param resource 
+     *    memory resource that tables of entries are allocated from
+     * @param context 
+     *    name of the calling method (used in error messages)
+     * @returns 
+     *    prepared configuration
+     * 
+     * @throws eni::Error 
+     *    if inconsistency has been found in the @p eni configuration
+     */
+    static inline PreparedConfiguration prepare_configuration(
+        eni::Configuration &&eni,
+        common::utilities::StringPool &names,
+        std::pmr::memory_resource *resource,
+        std::string_view context
+    );
+
+    /**
+     * @brief Verifies consistency of the @p eni (all issues are reported at once)
+     * 
+     * @param eni 
+     *    ENI configuration to be verified
+     * @param context 
+     *    name of the calling method (used in the error message)
+     * 
+     * @throws eni::Error 
+     *    if inconsistency has been found in the @p eni configuration
+     */
+    static inline void validate_eni(const eni::Configuration &eni, std::string_view context);
+
+    /**
+     * @brief Prepares PDOs of all slaves described in the ENI
+     * @details Slaves are independent of each other and the ENI tree (as well as the PDI index)
+     *    is only read, so PDOs of different slaves are prepared concurrently (see 
+     *    @ref config::master::ConstructionThreadsNum ). Entries of each slave are allocated
+     *    in slave-local tables first and then gathered into the @p entries tables.
+     * 
+     * @param slave_eni_list 
+     *    ENI descriptions of slaves
+     * @param pdi_index 
+     *    index of the PDI variables described in the ENI
+     * @param names 
+     *    pool that names of PDOs and entries are interned in
+     * @param resource 
+     *    memory resource that @p entries tables are allocated from
+     * @param[out] entries 
+     *    tables that entries of all PDOs are gathered in
+     * @returns 
+     *    PDOs of subsequent slaves
+     * 
+     * @throws eni::Error 
+     *    if inconsistency has been found in the ENI (error of the first failed slave is 
+     *    reported)
+     */
+    static inline std::vector<SlavePdos> prepare_pdos(
+        const std::vector<eni::Slave> &slave_eni_list,
+        const eni::ProcessImage::Index &pdi_index,
+        common::utilities::StringPool &names,
+        std::pmr::memory_resource *resource,
+        EntryTables &entries
+    );
+
+    /**
+     * @returns 
+     *    state of the slave's ESM corresponding to the given master's @p state
+     */
+    static constexpr typename SlaveT::State to_slave_state(State state);
+
+    /**
+     * @returns 
+     *    state of the ESM corresponding to the given master's @p state in the notation of 
+     *    cyclic commands
+     */
+    static constexpr eni::Cyclic::State to_cyclic_state(State state);
+
+    /**
+     * @returns 
+     *    @retval @c true if the implementation provides per-command I/O methods 
+     *       (@a read_command_impl() and @a write_command_impl() )
+     *    @retval @c false otherwise
+     */
+    static constexpr bool supports_command_io();
+
+    /**
+     * @returns 
+     *    next state that the bus should be transitioned to on the way from the @p current
+     *    to the @p target state when ESM transitions are performed step-by-step
+     */
+    static constexpr State next_state(State current, State target);
+
+private: /* ----------------------------------------------- Private methods (setup) ----------------------------------------------- */
+
+    /**
+     * @brief Builds the master (PDI buffers and slave interfaces) from the prepared @p configuration
+     * 
+     * @param configuration 
+     *    prepared configuration of the bus
+     * 
+     * @throws error  
+     *    whatever the slave factory throws
+     */
+    inline void construct(PreparedConfiguration &&configuration);
+
+    /**
+     * @brief Builds table of cyclic commands associating each command of @p frames with 
+     *    PDO entries of slaves whose data the command carries
+     * 
+     * @param frames 
+     *    cyclic frames of the bus
+     * @param entries 
+     *    tables of entries of the PDIs
+     * @param input_pdi_size 
+     *    size of the input PDI in bytes
+     * @param output_pdi_size 
+     *    size of the output PDI in bytes
+     * @returns 
+     *    table of cyclic commands (to be swapped into @ref cyclic )
+     * 
+     * @note Table needs to be rebuilt each time the set of slaves (or PDI layout) changes
+     */
+    inline CyclicTable index_cyclic_commands(
+        std::vector<eni::Cyclic::Frame> &&frames,
+        const EntryTables &entries,
+        std::size_t input_pdi_size,
+        std::size_t output_pdi_size
+    ) const;
+
+    /**
+     * @param name 
+     *    name of the slave
+     * @returns 
+     *    iterator to the slave with the given @p name or past-the-end iterator if there is no 
+     *    such slave (slaves are compared by symbols of their interned names)
+     */
+    inline typename std::pmr::vector<SlaveT>::iterator find_slave(std::string_view name);
+
+private: /* ------------------------------------------- Private methods (cyclic groups) ------------------------------------------- */
+
+    /// Identifier marking slaves that do not belong to any cyclic group
+    static constexpr GroupId NoGroup = std::numeric_limits<GroupId>::max();
+
+    /**
+     * @param handlers 
+     *    set of handlers
+     * @param event 
+     *    target event
+     * @param context 
+     *    name of the calling method (used in error messages)
+     * @returns 
+     *    handler of the @p event in the @p handlers set
+     * 
+     * @throws std::out_of_range 
+     *    if invalid @p event given
+     */
+    static inline common::handlers::EventHandler &select_handler(Handlers &handlers, Event event, std::string_view context);
+
+    /**
+     * @param group 
+     *    identifier of the group
+     * @param context 
+     *    name of the calling method (used in error messages)
+     * @returns 
+     *    description of the cyclic @p group
+     * 
+     * @throws std::out_of_range 
+     *    if invalid @p group given
+     */
+    inline CyclicGroup &get_cyclic_group(GroupId group, std::string_view context);
+
+    /**
+     * @brief Associates slaves with cyclic groups they belong to (needs to be called each 
+     *    time the set of slaves or groups changes)
+     */
+    inline void assign_cyclic_groups();
+
+    /**
+     * @brief Starts the new bus cycle selecting cyclic groups due in it
+     */
+    inline void start_groups_cycle();
+
+    /**
+     * @param slave 
+     *    index of the slave
+     * @returns 
+     *    @retval @c true if the @p slave is processed in the current bus cycle
+     *    @retval @c false otherwise
+     */
+    inline bool is_slave_due(std::size_t slave) const;
+
+    /**
+     * @param entries 
+     *    table of entries
+     * @param begin 
+     *    index of the first row of the range
+     * @param end 
+     *    index past the last row of the range
+     * @returns 
+     *    @retval @c true if the range is empty or any of its entries belongs to the slave 
+     *       processed in the current bus cycle
+     *    @retval @c false otherwise
+     */
+    inline bool is_range_due(
+        const common::pdi::EntryTable &entries,
+        std::size_t begin,
+        std::size_t end
+    ) const;
+
+    /**
+     * @brief Calls @p handler of the master and handlers of all cyclic groups due in the 
+     *    current bus cycle
+     */
+    inline void trigger_event(common::handlers::EventHandler Handlers::*handler);
+
+private: /* ---------------------------------------------- Private methods (mailbox) ---------------------------------------------- */
+
+    /**
+     * @brief Executes scheduled mailbox tasks that fit into the remaining slack of the current
+     *    bus cycle
+     */
+    inline void serve_mailbox_tasks();
+
+private: /* -------------------------------------------------- Private types ------------------------------------------------------ */
+
+    /**
+     * @brief Auxiliary class wrapping a dynamic-size bytes-buffer storing process data 
+     *    exchanged with the bus
+     * @note Buffers are aligned to the cache line so that locks of the input and output
+     *    buffers (taken concurrently by the bus I/O) never share a line
+     */
+    struct alignas(config::pdi::CacheLineSize) ProcessDataImageBuffer {
+
+        /// Synchronisation lock
+        config::types::Lock lock;
+        /// Data bufffer
+        common::pdi::ImageBuffer data;
+
+    };
+
+    /**
+     * @brief Auxiliary class holding cyclic commands of the bus associated with PDO entries 
+     *    whose data they carry
+     */
+    struct CyclicTable {
+
+        /// Cyclic command with ranges of covered entries
+        struct Command {
+
+            /// Description of the command
+            eni::Cyclic::Command command;
+            /// @c true if command reads inputs and its data fits into the input PDI
+            bool exchanges_inputs { false };
+            /// @c true if command writes outputs and its data fits into the output PDI
+            bool exchanges_outputs { false };
+            /// Row of the first input entry covered by the command
+            std::size_t inputs_begin { 0 };
+            /// Row past the last input entry covered by the command
+            std::size_t inputs_end { 0 };
+            /// Row of the first output entry covered by the command
+            std::size_t outputs_begin { 0 };
+            /// Row past the last output entry covered by the command
+            std::size_t outputs_end { 0 };
+
+        };
+
+        /// Cyclic frames of the bus (as given by the ENI)
+        std::vector<eni::Cyclic::Frame> frames;
+        /// Commands of all frames (in order of the ENI)
+        std::pmr::vector<Command> commands;
+
+        /// Constructs an empty table (commands are allocated from the @p resource )
+        inline explicit CyclicTable(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) :
+            commands{ resource }
+        { }
+
+        /// Swaps content of the table with the @p table (both tables need to use the same resource)
+        inline void swap(CyclicTable &table) noexcept {
+            frames.swap(table.frames);
+            commands.swap(table.commands);
+        }
+
+    };
+
+    /**
+     * @brief Auxiliary class holding state of the slack-time mailbox scheduler
+     */
+    struct MailboxScheduler {
+
+        /// Scheduled task
+        struct Task {
+
+            /// Task to be executed
+            std::packaged_task<void()> task;
+            /// Estimated execution time of the task (zero if not given)
+            std::chrono::microseconds estimate;
+            /// Number of cycles that the task has been deferred for
+            std::size_t deferred_cycles { 0 };
+
+        };
+
+        /// Synchronisation lock
+        mutable config::types::Lock lock;
+        /// Queue of scheduled tasks
+        std::deque<Task> tasks;
+        /// Running average of measured execution times of tasks
+        std::chrono::microseconds average_task_time { config::mailbox::DefaultTaskEstimate };
+        /// Timestamp of the start of the current bus cycle (entry to the read_bus())
+        std::atomic<std::chrono::steady_clock::rep> cycle_start { 0 };
+        /// Slack of the last bus cycle
+        std::atomic<std::chrono::microseconds::rep> last_slack { 0 };
+
+    };
+
+private: /* --------------------------------------------------- Private data ------------------------------------------------------ */
+
+    /// Memory resource that cycle-critical data of the master is allocated from
+    std::pmr::memory_resource *resource;
+
+    /// Input Process Data Image buffer
+    ProcessDataImageBuffer input_pdi;
+    /// Output Process Data Image buffer
+    ProcessDataImageBuffer output_pdi;
+    /// Tables holding entries of all slaves (guarded by locks of corresponding PDIs)
+    EntryTables pdi_entries;
+
+    /// Pool of interned names of slaves, PDOs and entries (outlives objects referring to it; frozen
+    /// after construction and after reload, so that runtime lookups of names take no lock)
+    common::utilities::StringPool names;
+    /// List of slave interfaces representing devices on the bus
+    std::pmr::vector<SlaveT> slaves;
+    /// Factory creating slave interfaces (provided by the implementation)
+    SlaveFactory make_slave;
+
+    /// Table of cyclic commands (guarded by locks of both PDIs)
+    CyclicTable cyclic;
+    /// Last state of the master requested with @ref set_state() (selects active cyclic commands)
+    std::atomic<State> cyclic_state { State::Init };
+
+    /// State of the slack-time mailbox scheduler
+    MailboxScheduler mailbox_scheduler;
+
+    /// Set of handlers for master-related events
+    Handlers handlers;
+
+    /// Cyclic groups of slaves (deque keeps handlers of groups in place)
+    std::deque<CyclicGroup> cyclic_groups;
+    /// Groups that subsequent slaves belong to (@ref NoGroup for slaves processed in every cycle)
+    std::pmr::vector<GroupId> slave_groups;
+    /// Number of bus cycles started with @ref read_bus()
+    std::size_t cycles_counter { 0 };
+
+    /// ENI configuration loaded in background (valid only until deferred construction is finished)
+    std::future<PreparedConfiguration> pending_configuration;
 
 };
 
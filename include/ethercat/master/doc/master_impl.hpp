@@ -40,6 +40,11 @@ protected: /* ---------------------------------------------- Public ctors & dtor
      * 
      * @param channel 
      *    channel to be used for EtherCAT communication
+     * 
+     * @note Implementation whose bring-up takes considerable time (e.g. loading firmware of
+     *    the CIFX card) may construct the base class with the @c Deferred tag. In such case the
+     *    ENI is loaded in background while the constructor brings up the channel and the
+     *    constructor has to call @c finish_construction() before it returns
      */
     Master(cifx::Channel &channel);
 
@@ -106,6 +111,65 @@ protected: /* -------------------------------- Protected EtherCAT I/O methods (i
      */
     void write_bus_impl(::ethercat::config::types::Span<const uint8_t> pdi_buffer);
 
+    /**
+     * @brief Reads data of the single cyclic @p command from the bus (optional; if provided 
+     *    together with @ref write_command_impl() it is used by @ref read_bus() instead of
+     *    @ref read_bus_impl() for each command active in the current state of the master)
+     * 
+     * @param[in] command
+     *    description of the cyclic command
+     * @param[out] data
+     *    range of the input PDI carried by the command
+     * @param[in] timeout
+     *    timeout of the I/O operation
+     * @returns 
+     *    @retval @c true if command completed (e.g. working counter matched the expected one)
+     *       and entries covered by it should be updated
+     *    @retval @c false otherwise
+     * 
+     * @throws cifx::Error
+     *    on failure
+     */
+    bool read_command_impl(
+        const ::ethercat::eni::Cyclic::Command &command,
+        ::ethercat::config::types::Span<uint8_t> data,
+        std::chrono::milliseconds timeout
+    );
+
+    /**
+     * @brief Writes data of the single cyclic @p command to the bus (optional; see 
+     *    @ref read_command_impl() )
+     * 
+     * @param[in] command
+     *    description of the cyclic command
+     * @param[in] data
+     *    range of the output PDI carried by the command
+     * @param[in] timeout
+     *    timeout of the I/O operation
+     * 
+     * @throws cifx::Error
+     *    on failure
+     */
+    void write_command_impl(
+        const ::ethercat::eni::Cyclic::Command &command,
+        ::ethercat::config::types::Span<const uint8_t> data,
+        std::chrono::milliseconds timeout
+    );
+
+protected: /* ------------------------------ Protected reconfiguration methods (implementation) ----------------------------------- */
+
+    /**
+     * @brief Applies new ENI configuration to the backend (called by @ref reload() before the
+     *    master is reconfigured; required only if @ref reload() is used)
+     * 
+     * @param eni
+     *    new ENI configuration of the bus
+     * 
+     * @throws cifx::Error
+     *    on failure (master is left untouched)
+     */
+    void reload_impl(const ::ethercat::eni::Configuration &eni);
+
 };
 
 /* ================================================================================================================================ */
@@ -16,7 +16,21 @@
 
 /* =========================================================== Includes =========================================================== */
 
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <exception>
+#include <future>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
 // Private includes
+#include "ethercat/common/utilities/bit.hpp"
+#include "ethercat/common/utilities/enum.hpp"
 #include "ethercat/master.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
@@ -29,48 +43,131 @@ template<typename ImplementationT,typename SlaveImplementationT>
 template<typename SlaveFactoryT>
 Master<ImplementationT, SlaveImplementationT>::Master(
     eni::Configuration &&eni,
-    SlaveFactoryT&& slave_factory
+    SlaveFactoryT&& slave_factory,
+    std::pmr::memory_resource *resource
 ) :
-    // Parse ENI configuration
-    bus_cycle { eni.get_cyclic().get_cycle_time() },
-    // Initialize PDI buffers with zeros
-    input_pdi  { eni.get_process_image().get_size(eni::ProcessImage::Direction::Inputs)  },
-    output_pdi { eni.get_process_image().get_size(eni::ProcessImage::Direction::Outputs) }
+    // Allocate cycle-critical data from the given resource
+    resource{ resource },
+    slaves{ resource },
+    // Keep the factory to create slaves added on reload
+    make_slave{ make_slave_factory(std::forward<SlaveFactoryT>(slave_factory)) },
+    cyclic{ resource },
+    slave_groups{ resource }
 { 
-    
-    // Verify that all slaves have unique names
-    if(auto slave = eni.are_slaves_unique(); slave.has_value()) {
+    // Verify consistency of the ENI and build the master
+    construct(prepare_configuration(std::move(eni), names, resource, "ethercat::Master::Master"));
+}
+
+/* ==================================================== Private static methods ==================================================== */
+
+template<typename ImplementationT,typename SlaveImplementationT>
+template<typename SlaveFactoryT>
+typename Master<ImplementationT, SlaveImplementationT>::SlaveFactory
+Master<ImplementationT, SlaveImplementationT>::make_slave_factory(SlaveFactoryT&& slave_factory) {
+    return [factory = std::make_shared<std::decay_t<SlaveFactoryT>>(std::forward<SlaveFactoryT>(slave_factory))](
+        eni::Slave slave_eni,
+        std::vector<InputPdo> &&inputs,
+        std::vector<OutputPdo> &&outputs
+    ) {
+        return (*factory)(std::move(slave_eni), std::move(inputs), std::move(outputs));
+    };
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+eni::Configuration Master<ImplementationT, SlaveImplementationT>::load_eni(const std::filesystem::path &eni_path) {
+    return config::eni::UseCompiledCache ? 
+        eni::configruation_from_file_cached(eni_path) : 
+        eni::configruation_from_file(eni_path);
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+typename Master<ImplementationT, SlaveImplementationT>::PreparedConfiguration
+Master<ImplementationT, SlaveImplementationT>::prepare_configuration(
+    eni::Configuration &&eni,
+    common::utilities::StringPool &names,
+    std::pmr::memory_resource *resource,
+    std::string_view context
+) {
+
+    // Verify consistency of the ENI (report all issues at once)
+    validate_eni(eni, context);
+
+    // Get list of slaves on the bus
+    auto slave_eni_list = eni.get_slaves();
+    // Build index of the PDI variables
+    auto process_image = eni.get_process_image();
+    // Prepare PDOs of all slaves
+    EntryTables entries;
+    auto slaves_pdos = prepare_pdos(slave_eni_list, process_image.get_index(), names, resource, entries);
+
+    // Parse sizes of PDIs, the bus cycle and cyclic frames
+    auto input_pdi_size  = process_image.get_size(eni::ProcessImage::Direction::Inputs);
+    auto output_pdi_size = process_image.get_size(eni::ProcessImage::Direction::Outputs);
+    auto cyclic          = eni.get_cyclic();
+    auto cycle           = cyclic.get_cycle_time();
+    auto cyclic_frames   = cyclic.get_frames();
+
+    return PreparedConfiguration {
+        std::move(eni),
+        std::move(slave_eni_list),
+        std::move(slaves_pdos),
+        std::move(entries),
+        input_pdi_size,
+        output_pdi_size,
+        cycle,
+        std::move(cyclic_frames)
+    };
+}
+
 
-        // If no, throw error
+template<typename ImplementationT,typename SlaveImplementationT>
+void Master<ImplementationT, SlaveImplementationT>::validate_eni(const eni::Configuration &eni, std::string_view context) {
+    if(auto report = eni.validate(); not report.is_valid()) {
+
+        // If inconsistent, throw error
         std::stringstream ss;
-        ss << "[ethercat::Master::Master] Set of slaves listed in the ENI file contains more than " 
-           << "one slave with the non-unique name/address (" << slave->get_name() << ")";
+        ss << "[" << context << "] Incoherent ENI description found (" 
+           << report.get_issues().size() << " issue(s)):\n" << report.to_string();
         throw eni::Error{ ss.str() };
     }
- 
-    // Get list of slaves on the bus
-    auto slave_eni_list = eni.get_slaves();
-    // Prepare storage for Slave interfaces
-    slaves.reserve(slave_eni_list.size()); 
+}
 
+
+template<typename ImplementationT,typename SlaveImplementationT>
+std::vector<typename Master<ImplementationT, SlaveImplementationT>::SlavePdos>
+Master<ImplementationT, SlaveImplementationT>::prepare_pdos(
+    const std::vector<eni::Slave> &slave_eni_list,
+    const eni::ProcessImage::Index &pdi_index,
+    common::utilities::StringPool &names,
+    std::pmr::memory_resource *resource,
+    EntryTables &entries
+) {
     /*
      * @brief Auxiliary function constructing list of PDO objects for the single slave
      * @param dir
      *    std::integral_constant of type SlaveT::PdoDirection representing target direction of created PDOs
      * @param slave_pdos_config
      *    list of ENI descriptions of slave's PDOs defined for the given @p dir
-     * @param sslave_variables
-     *    list of ENI descriptions of slave-related PDI variables present in the description of Process Data
-     *    Image of the given @p dir
+     * @param slave_name
+     *    name of the slave
+     * @param table
+     *    table that entries of PDOs are allocated in
      */
-    auto make_pdos = [](
+    auto make_pdos = [&pdi_index, &names](
         auto dir,
         const eni::Slave::PdosList &slave_pdos_config,
-        const eni::ProcessImage::VariablesList &slave_variables
+        std::string_view slave_name,
+        common::pdi::EntryTable &table
     ) { 
 
         using PdoType = typename SlaveT::template Pdo<dir>;
 
+        // Direction of the PDI corresponding to the PDOs
+        constexpr auto pdi_dir = (dir == SlaveT::PdoDirection::Input) ? 
+            eni::ProcessImage::Direction::Inputs : eni::ProcessImage::Direction::Outputs;
+
         // Prepare list of slave's PDOs
         std::vector<PdoType> pdos;
         // Get ENI configurations of slave's mapped PDOs
@@ -80,32 +177,455 @@ Master<ImplementationT, SlaveImplementationT>::Master(
 
         // Iterate over descriptions of mapped PDOs and construct PDO objects
         for(const auto &pdo_config : assigned_pdos_config)
-            pdos.emplace_back(PdoType{ pdo_config, slave_variables.get_pdo_variables(pdo_config.get_name()) });
+            pdos.emplace_back(PdoType{ pdo_config, pdi_index.get_pdo_variables(pdi_dir, slave_name, pdo_config.get_name()), names, table });
             
         return pdos;
     };
 
-    // Create interface object for each slave described in the ENI
-    for(auto &slave_config : slave_eni_list) {
+    // Storage for PDOs of subsequent slaves (and errors that occurred when preparing them)
+    std::vector<SlavePdos> slaves_pdos(slave_eni_list.size());
+    std::vector<std::exception_ptr> errors(slave_eni_list.size());
+    // Slave-local tables of entries (filled concurrently, gathered into common tables afterwards; 
+    // these are temporary, so they are allocated with the default resource)
+    std::vector<common::pdi::EntryTable> slaves_inputs(slave_eni_list.size());
+    std::vector<common::pdi::EntryTable> slaves_outputs(slave_eni_list.size());
+
+    /*
+     * @brief Auxiliary function preparing PDOs of the slave at the given @p i position in the ENI
+     * @note Slaves are independent of each other and the ENI tree (as well as the PDI index) is 
+     *    only read, so PDOs of different slaves may be prepared concurrently
+     */
+    auto prepare_slave_pdos = [&](std::size_t i) {
+        try {
+
+            const auto &slave_config = slave_eni_list[i];
+
+            // Get list of slave's mapped pdos
+            auto pdos_config = slave_config.get_pdos();
+            // Get name of the slave
+            auto slave_name = slave_config.get_name();
+
+            slaves_pdos[i].inputs = make_pdos(
+                std::integral_constant<typename SlaveT::PdoDirection, SlaveT::PdoDirection::Input>{},
+                pdos_config.inputs,
+                slave_name,
+                slaves_inputs[i]);
+            slaves_pdos[i].outputs = make_pdos(
+                std::integral_constant<typename SlaveT::PdoDirection, SlaveT::PdoDirection::Output>{},
+                pdos_config.outputs,
+                slave_name,
+                slaves_outputs[i]);
+
+        } catch(...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    // Select number of threads preparing PDOs
+    std::size_t threads_num = config::master::ConstructionThreadsNum;
+    if(threads_num == 0)
+        threads_num = std::max(std::thread::hardware_concurrency(), 1U);
+    threads_num = std::min(threads_num, slave_eni_list.size());
+
+    // Prepare PDOs of all slaves (slaves are picked by subsequent threads one by one)
+    std::atomic<std::size_t> next_slave { 0 };
+    auto worker = [&]() {
+        for(auto i = next_slave++; i < slave_eni_list.size(); i = next_slave++)
+            prepare_slave_pdos(i);
+    };
+
+    std::vector<std::future<void>> jobs;
+    for(std::size_t i = 1; i < threads_num; ++i)
+        jobs.push_back(std::async(std::launch::async, worker));
+    worker();
+    for(auto &job : jobs)
+        job.get();
+
+    // Rethrow error of the first failed slave, if any occurred (errors are reported deterministically)
+    for(auto &error : errors) {
+        if(error)
+            std::rethrow_exception(error);
+    }
+
+    /*
+     * @brief Auxiliary function gathering entries of given PDOs of all slaves into a single table
+     *    (rows are sorted by offsets of entries in the PDI, so that entries covered by a cyclic
+     *    command occupy a contiguous range of rows)
+     * @param pdos
+     *    pointer to the member of SlavePdos holding PDOs of the target direction
+     */
+    auto gather_entries = [&slaves_pdos, resource](auto pdos) {
+
+        using EntryType = typename std::remove_reference_t<decltype(slaves_pdos[0].*pdos)>::value_type::Entry;
+
+        // Collect entries of all slaves (with indices of owning slaves)
+        std::vector<std::pair<EntryType*, std::size_t>> collected;
+        std::size_t bytes = 0;
+        for(std::size_t i = 0; i < slaves_pdos.size(); ++i) {
+            for(auto &pdo : slaves_pdos[i].*pdos) {
+                for(auto &entry : pdo.entries) {
+                    collected.emplace_back(&entry, i);
+                    bytes += entry.buffer.data().size();
+                }
+            }
+        }
+
+        // Sort entries by their offset in the PDI
+        std::stable_sort(collected.begin(), collected.end(), [](const auto &lentry, const auto &rentry) {
+            return lentry.first->buffer.bitoffset() < rentry.first->buffer.bitoffset();
+        });
+
+        // Move entries into the common table
+        auto table = std::make_unique<common::pdi::EntryTable>(resource);
+        table->reserve(collected.size(), bytes);
+        for(auto &[entry, owner] : collected)
+            entry->relocate(*table, owner);
+
+        return table;
+    };
+
+    entries.inputs  = gather_entries(&SlavePdos::inputs);
+    entries.outputs = gather_entries(&SlavePdos::outputs);
+
+    return slaves_pdos;
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+constexpr typename Master<ImplementationT, SlaveImplementationT>::SlaveT::State
+Master<ImplementationT, SlaveImplementationT>::to_slave_state(State state) {
+    switch(state) {
+        case State::Init:   return SlaveT::State::Init;
+        case State::Preop:  return SlaveT::State::Preop;
+        case State::Safeop: return SlaveT::State::Safeop;
+        default:            return SlaveT::State::Op;
+    }
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+constexpr eni::Cyclic::State Master<ImplementationT, SlaveImplementationT>::to_cyclic_state(State state) {
+    switch(state) {
+        case State::Init:   return eni::Cyclic::State::Init;
+        case State::Preop:  return eni::Cyclic::State::Preop;
+        case State::Safeop: return eni::Cyclic::State::Safeop;
+        default:            return eni::Cyclic::State::Op;
+    }
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+constexpr bool Master<ImplementationT, SlaveImplementationT>::supports_command_io() {
+    return requires(
+        ImplementationT &impl,
+        const eni::Cyclic::Command &command,
+        config::types::Span<uint8_t> inputs,
+        config::types::Span<const uint8_t> outputs,
+        std::chrono::milliseconds timeout
+    ) {
+        { impl.read_command_impl(command, inputs, timeout) } -> std::convertible_to<bool>;
+        impl.write_command_impl(command, outputs, timeout);
+    };
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+constexpr typename Master<ImplementationT, SlaveImplementationT>::State
+Master<ImplementationT, SlaveImplementationT>::next_state(State current, State target) {
+
+    // Downward transitions are performed directly
+    if(common::utilities::to_underlying(target) <= common::utilities::to_underlying(current))
+        return target;
 
-        // Get list of slave's mapped pdos
-        auto pdos_config = slave_config.get_pdos();
-        // Get list of slave-related PDI variables
-        auto variables_config = eni.get_process_image().get_slave_variables(slave_config.get_name());
+    // Upward transitions are performed step-by-step
+    return common::utilities::to_enum<State>(common::utilities::to_underlying(current) + 1);
+}
 
-        // Construct the slave
+/* =================================================== Private methods (setup) ==================================================== */
+
+template<typename ImplementationT,typename SlaveImplementationT>
+void Master<ImplementationT, SlaveImplementationT>::construct(PreparedConfiguration &&configuration) {
+
+    // Parse ENI configuration
+    bus_cycle = configuration.bus_cycle;
+    // Initialize PDI buffers with zeros
+    input_pdi.data.reset(configuration.input_pdi_size);
+    output_pdi.data.reset(configuration.output_pdi_size);
+    // Take over tables of entries
+    pdi_entries = std::move(configuration.entries);
+
+    // Prepare storage for Slave interfaces
+    slaves.reserve(configuration.slave_eni_list.size()); 
+
+    // Create interface object for each slave described in the ENI (in order of the ENI)
+    for(std::size_t i = 0; i < configuration.slave_eni_list.size(); ++i) {
         slaves.emplace_back(
-            slave_factory(slave_config, 
-                make_pdos( /* Input PDOs */
-                    std::integral_constant<typename SlaveT::PdoDirection, SlaveT::PdoDirection::Input>{},
-                    pdos_config.inputs,
-                    variables_config.inputs),
-                make_pdos( /* Output PDOs */
-                    std::integral_constant<typename SlaveT::PdoDirection, SlaveT::PdoDirection::Output>{},
-                    pdos_config.outputs,
-                    variables_config.outputs)
+            make_slave(configuration.slave_eni_list[i], 
+                std::move(configuration.slaves_pdos[i].inputs),
+                std::move(configuration.slaves_pdos[i].outputs)
             )
         );
+        // Intern name of the slave in the common pool
+        slaves.back().bind_names(names);
+    }
+
+    // Associate cyclic commands with entries of created slaves
+    auto cyclic_table = index_cyclic_commands(std::move(configuration.cyclic_frames), pdi_entries,
+        input_pdi.data.size(), output_pdi.data.size());
+    cyclic.swap(cyclic_table);
+    // Associate created slaves with cyclic groups
+    assign_cyclic_groups();
+
+    // All names are interned now (lookups performed at runtime take no lock)
+    names.freeze();
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+typename Master<ImplementationT, SlaveImplementationT>::CyclicTable
+Master<ImplementationT, SlaveImplementationT>::index_cyclic_commands(
+    std::vector<eni::Cyclic::Frame> &&frames,
+    const EntryTables &entries,
+    std::size_t input_pdi_size,
+    std::size_t output_pdi_size
+) const {
+
+    using namespace common::utilities::bit;
+
+    CyclicTable table{ resource };
+    table.frames = std::move(frames);
+
+    /*
+     * @brief Auxiliary function finding range of rows of the @p entries table (sorted by offsets 
+     *    of entries) overlapping with @p length bytes of the PDI starting at @p offset (entries 
+     *    do not overlap, so that the range is contiguous)
+     */
+    auto find_entries = [](const common::pdi::EntryTable &entries, std::size_t offset, std::size_t length) {
+
+        auto rows = std::views::iota(std::size_t{ 0 }, entries.size());
+
+        auto begin = std::ranges::partition_point(rows, [&entries, offset](std::size_t row) {
+            return entries.get_bitoffset(row) + entries.get_bitsize(row) <= offset * BITS_IN_BYTE;
+        });
+        auto end = std::ranges::partition_point(std::ranges::subrange(begin, rows.end()),
+            [&entries, offset, length](std::size_t row) {
+                return entries.get_bitoffset(row) < (offset + length) * BITS_IN_BYTE;
+            });
+
+        return std::pair{ 
+            static_cast<std::size_t>(begin - rows.begin()),
+            static_cast<std::size_t>(end - rows.begin())
+        };
+    };
+
+    // Associate subsequent commands with entries whose data they carry
+    for(const auto &frame : table.frames) {
+        for(const auto &command : frame.commands) {
+
+            auto &indexed = table.commands.emplace_back(typename CyclicTable::Command{ command });
+
+            // Commands whose data does not fit into the PDI are not exchanged
+            indexed.exchanges_inputs = command.reads_inputs() 
+                and (command.input_offset + command.data_length <= input_pdi_size);
+            indexed.exchanges_outputs = command.writes_outputs() 
+                and (command.output_offset + command.data_length <= output_pdi_size);
+
+            if(indexed.exchanges_inputs) {
+                std::tie(indexed.inputs_begin, indexed.inputs_end) = 
+                    find_entries(*entries.inputs, command.input_offset, command.data_length);
+            }
+            if(indexed.exchanges_outputs) {
+                std::tie(indexed.outputs_begin, indexed.outputs_end) = 
+                    find_entries(*entries.outputs, command.output_offset, command.data_length);
+            }
+        }
+    }
+
+    return table;
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+typename std::pmr::vector<typename Master<ImplementationT, SlaveImplementationT>::SlaveT>::iterator
+Master<ImplementationT, SlaveImplementationT>::find_slave(std::string_view name) {
+
+    // If name has not been interned, no slave can be named so
+    auto symbol = names.find(name);
+    if(not symbol.has_value())
+        return slaves.end();
+
+    return std::find_if(slaves.begin(), slaves.end(),
+        [&symbol](const auto &slave) { return (slave.name == *symbol); });
+}
+
+/* =============================================== Private methods (cyclic groups) ================================================ */
+
+template<typename ImplementationT,typename SlaveImplementationT>
+common::handlers::EventHandler &Master<ImplementationT, SlaveImplementationT>::select_handler(
+    Handlers &handlers,
+    Event event,
+    std::string_view context
+) {
+    switch(event) {
+        case Event::ReadBusStart:                 return handlers.at_read_bus_start;
+        case Event::ReadBusComplete:              return handlers.at_read_bus_complete;
+        case Event::ReadBusSlavesUpdateComplete:  return handlers.at_read_bus_slaves_update_complete;
+        case Event::WriteBusStart:                return handlers.at_write_bus_start;
+        case Event::WriteBusSlavesUpdateComplete: return handlers.at_write_bus_slaves_update_complete;
+        case Event::WriteBusComplete:             return handlers.at_write_bus_complete;
+        default:
+            using namespace std::literals::string_literals;
+            throw std::out_of_range{ 
+                "["s + std::string{ context } + "] Invalid event ID given " 
+                  "("s
+                + std::to_string(common::utilities::to_underlying(event))
+                + ")" 
+            };
+    }
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+typename Master<ImplementationT, SlaveImplementationT>::CyclicGroup &
+Master<ImplementationT, SlaveImplementationT>::get_cyclic_group(GroupId group, std::string_view context) {
+
+    // Check if group exists
+    if(group >= cyclic_groups.size()) {
+        using namespace std::literals::string_literals;
+        throw std::out_of_range{ 
+            "["s + std::string{ context } + "] Invalid cyclic group ID given (" + std::to_string(group) + ")" };
+    }
+
+    return cyclic_groups[group];
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+void Master<ImplementationT, SlaveImplementationT>::assign_cyclic_groups() {
+
+    // By default slaves are processed in every cycle
+    slave_groups.assign(slaves.size(), NoGroup);
+
+    // Assign slaves to groups by names (slaves that are not present on the bus anymore are skipped)
+    for(std::size_t group = 0; group < cyclic_groups.size(); ++group) {
+        for(const auto &name : cyclic_groups[group].slaves) {
+
+            auto slave = std::find_if(slaves.begin(), slaves.end(),
+                [&name](const auto &slave) { return (slave.name == name); });
+
+            if(slave != slaves.end())
+                slave_groups[slave - slaves.begin()] = group;
+        }
+    }
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+void Master<ImplementationT, SlaveImplementationT>::start_groups_cycle() {
+
+    // Select groups due in the cycle
+    for(auto &group : cyclic_groups)
+        group.due = (cycles_counter % group.rate_divisor == 0);
+
+    ++cycles_counter;
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+bool Master<ImplementationT, SlaveImplementationT>::is_slave_due(std::size_t slave) const {
+    return (slave_groups[slave] == NoGroup) or cyclic_groups[slave_groups[slave]].due;
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+bool Master<ImplementationT, SlaveImplementationT>::is_range_due(
+    const common::pdi::EntryTable &entries,
+    std::size_t begin,
+    std::size_t end
+) const {
+
+    // Ranges carrying no entries (e.g. status data of the bus) are always due
+    if(begin == end)
+        return true;
+
+    for(auto i = begin; i != end; ++i) {
+        if(is_slave_due(entries.get_owner(i)))
+            return true;
+    }
+
+    return false;
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+void Master<ImplementationT, SlaveImplementationT>::trigger_event(common::handlers::EventHandler Handlers::*handler) {
+
+    // Call master's handler
+    (handlers.*handler)();
+
+    // Call handlers of due groups
+    for(auto &group : cyclic_groups) {
+        if(group.due)
+            (group.handlers.*handler)();
+    }
+}
+
+/* =================================================== Private methods (mailbox) ================================================== */
+
+template<typename ImplementationT,typename SlaveImplementationT>
+void Master<ImplementationT, SlaveImplementationT>::serve_mailbox_tasks() {
+
+    using namespace std::chrono;
+
+    auto now = steady_clock::now();
+    auto cycle_start_rep = mailbox_scheduler.cycle_start.load(std::memory_order_relaxed);
+
+    // Slack is unlimited if no bus cycle has been started yet (read_bus() has not been called)
+    auto deadline = steady_clock::time_point::max();
+
+    // Otherwise, calculate deadline of the current cycle and measure its slack
+    if(cycle_start_rep != 0) {
+
+        auto cycle_start = steady_clock::time_point{ steady_clock::duration{ cycle_start_rep } };
+
+        deadline = cycle_start + bus_cycle - config::mailbox::SlackGuard;
+        mailbox_scheduler.last_slack.store(
+            duration_cast<microseconds>(cycle_start + bus_cycle - now).count(),
+            std::memory_order_relaxed
+        );
+    }
+
+    std::unique_lock guard{ mailbox_scheduler.lock };
+
+    // Serve tasks for as long as they fit into the slack
+    while(not mailbox_scheduler.tasks.empty()) {
+
+        auto &task = mailbox_scheduler.tasks.front();
+
+        // Get estimated execution time of the task
+        auto estimate = (task.estimate.count() != 0) ? task.estimate : mailbox_scheduler.average_task_time;
+
+        // If task does not fit into the slack, defer it (unless it has been deferred for too long)
+        if((deadline != steady_clock::time_point::max()) and (now + estimate > deadline)) {
+            if((config::mailbox::MaxDeferredCycles == 0) or (++task.deferred_cycles < config::mailbox::MaxDeferredCycles))
+                break;
+        }
+
+        // Dequeue the task
+        auto packaged_task = std::move(task.task);
+        mailbox_scheduler.tasks.pop_front();
+
+        // Execute task outside of the critical section (exception is passed to the associated future)
+        guard.unlock();
+        packaged_task();
+        auto end = steady_clock::now();
+        guard.lock();
+
+        // Update running average of tasks' execution time (with the weight of 1/8)
+        mailbox_scheduler.average_task_time += 
+            (duration_cast<microseconds>(end - now) - mailbox_scheduler.average_task_time) / 8;
+
+        now = end;
     }
 }
 
@@ -16,6 +16,8 @@
 
 /* =========================================================== Includes =========================================================== */
 
+// Standard includes
+#include <future>
 // Private includes
 #include "ethercat/master.hpp"
 
@@ -29,9 +31,10 @@ template<typename ImplementationT,typename SlaveImplementationT>
     template<typename SlaveFactoryT>
 Master<ImplementationT, SlaveImplementationT>::Master(
     const std::filesystem::path &eni_path,
-    SlaveFactoryT&& slave_factory
+    SlaveFactoryT&& slave_factory,
+    std::pmr::memory_resource *resource
 ) :
-    Master{ eni::configruation_from_file(eni_path), std::forward<SlaveFactoryT>(slave_factory) }
+    Master{ load_eni(eni_path), std::forward<SlaveFactoryT>(slave_factory), resource }
 { }
 
 
@@ -39,9 +42,10 @@ template<typename ImplementationT,typename SlaveImplementationT>
     template<typename SlaveFactoryT>
 Master<ImplementationT, SlaveImplementationT>::Master(
     const std::string &eni,
-    SlaveFactoryT&& slave_factory
+    SlaveFactoryT&& slave_factory,
+    std::pmr::memory_resource *resource
 ) :
-    Master{ eni::configruation_from_string(eni), std::forward<SlaveFactoryT>(slave_factory) }
+    Master{ eni::configruation_from_string(eni), std::forward<SlaveFactoryT>(slave_factory), resource }
 { }
 
 
@@ -49,11 +53,47 @@ template<typename ImplementationT,typename SlaveImplementationT>
     template<typename SlaveFactoryT>
 Master<ImplementationT, SlaveImplementationT>::Master(
     std::basic_istream<char> &stream,
-    SlaveFactoryT&& slave_factory
+    SlaveFactoryT&& slave_factory,
+    std::pmr::memory_resource *resource
 ) :
-    Master{ eni::configruation_from_stream(stream), std::forward<SlaveFactoryT>(slave_factory) }
+    Master{ eni::configruation_from_stream(stream), std::forward<SlaveFactoryT>(slave_factory), resource }
 { }
 
+
+template<typename ImplementationT,typename SlaveImplementationT>
+    template<typename SlaveFactoryT>
+Master<ImplementationT, SlaveImplementationT>::Master(
+    const std::filesystem::path &eni_path,
+    SlaveFactoryT&& slave_factory,
+    Deferred,
+    std::pmr::memory_resource *resource
+) :
+    // Allocate cycle-critical data from the given resource
+    resource{ resource },
+    slaves{ resource },
+    // Keep the factory to create slaves when construction is finished
+    make_slave{ make_slave_factory(std::forward<SlaveFactoryT>(slave_factory)) },
+    cyclic{ resource },
+    slave_groups{ resource },
+    // Load the ENI in background (overlapped with the implementation's bring-up)
+    pending_configuration{ std::async(std::launch::async, [this, eni_path = std::filesystem::path{ eni_path }]() {
+        return prepare_configuration(load_eni(eni_path), names, this->resource, "ethercat::Master::Master");
+    }) }
+{ }
+
+/* ====================================================== Protected methods ======================================================= */
+
+template<typename ImplementationT,typename SlaveImplementationT>
+void Master<ImplementationT, SlaveImplementationT>::finish_construction() {
+
+    // If construction has not been deferred (or has been already finished), do nothing
+    if(not pending_configuration.valid())
+        return;
+
+    // Wait for the ENI and build the master
+    construct(pending_configuration.get());
+}
+
 /* ================================================================================================================================ */
 
 } // End namespace ethercat
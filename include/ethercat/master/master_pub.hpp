@@ -18,6 +18,11 @@
 
 // Standard includes
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <optional>
+#include <thread>
 // Private includes
 #include "ethercat/master.hpp"
 
@@ -67,8 +72,7 @@ typename Master<ImplementationT, SlaveImplementationT>::SlaveT &
 Master<ImplementationT, SlaveImplementationT>::get_slave(std::string_view name) {
     
     // Find slave on the list registered devices
-    auto slave = std::find_if(slaves.begin(), slaves.end(), 
-        [name](const auto &slave) { return (slave.get_name() == name); });
+    auto slave = find_slave(name);
     
     // If slave not found, throw
     if(slave == slaves.end()) {
@@ -95,30 +99,13 @@ void Master<ImplementationT, SlaveImplementationT>::register_event_handler(
     Event event,
     HandlerT &&handler
 ) {
-    common::handlers::EventHandler *phandler;
-    
     // Select requested handler
-    switch(event) {
-        case Event::ReadBusStart:                 phandler = &handlers.at_read_bus_start;                   break;
-        case Event::ReadBusComplete:              phandler = &handlers.at_read_bus_complete;                break;
-        case Event::ReadBusSlavesUpdateComplete:  phandler = &handlers.at_read_bus_slaves_update_complete;  break;
-        case Event::WriteBusStart:                phandler = &handlers.at_write_bus_start;                  break;
-        case Event::WriteBusSlavesUpdateComplete: phandler = &handlers.at_write_bus_slaves_update_complete; break;
-        case Event::WriteBusComplete:             phandler = &handlers.at_write_bus_complete;               break;
-        default:
-            using namespace std::literals::string_literals;
-            throw std::out_of_range{ 
-                "[ethercat::Master::register_event_handler] Invalid event ID given " 
-                  "("s
-                + std::to_string(common::utilities::to_underlying(event))
-                + ")" 
-            };
-    }
+    auto &handler_slot = select_handler(handlers, event, "ethercat::Master::register_event_handler");
 
     // Lock the handler
-    std::lock_guard guard{ phandler->lock };
+    std::lock_guard guard{ handler_slot.lock };
     // Set the new handler
-    phandler->handler = handler;
+    handler_slot.handler = handler;
 }
 
 
@@ -126,30 +113,13 @@ template<typename ImplementationT,typename SlaveImplementationT>
 void Master<ImplementationT, SlaveImplementationT>::unregister_event_handler(
     Event event
 ) {
-    common::handlers::EventHandler *phandler;
-
     // Select requested handler
-    switch(event) {
-        case Event::ReadBusStart:                 phandler = &handlers.at_read_bus_start;                   break;
-        case Event::ReadBusComplete:              phandler = &handlers.at_read_bus_complete;                break;
-        case Event::ReadBusSlavesUpdateComplete:  phandler = &handlers.at_read_bus_slaves_update_complete;  break;
-        case Event::WriteBusStart:                phandler = &handlers.at_write_bus_start;                  break;
-        case Event::WriteBusSlavesUpdateComplete: phandler = &handlers.at_write_bus_slaves_update_complete; break;
-        case Event::WriteBusComplete:             phandler = &handlers.at_write_bus_complete;               break;
-        default:
-            using namespace std::literals::string_literals;
-            throw std::out_of_range{ 
-                "[ethercat::Master::unregister_event_handler] Invalid event ID given " 
-                  "("s
-                + std::to_string(common::utilities::to_underlying(event))
-                + ")" 
-            };
-    }
+    auto &handler_slot = select_handler(handlers, event, "ethercat::Master::unregister_event_handler");
 
     // Lock the handler
-    std::lock_guard guard{ phandler->lock };
+    std::lock_guard guard{ handler_slot.lock };
     // Reset the handler
-    phandler->handler = nullptr;
+    handler_slot.handler = nullptr;
 }
 
 /* ================================================ Public EtherCAT common methods ================================================ */
@@ -160,6 +130,12 @@ std::chrono::microseconds Master<ImplementationT, SlaveImplementationT>::get_bus
 }
 
 
+template<typename ImplementationT,typename SlaveImplementationT>
+const std::vector<eni::Cyclic::Frame> &Master<ImplementationT, SlaveImplementationT>::get_cyclic_frames() const {
+    return cyclic.frames;
+}
+
+
 template<typename ImplementationT,typename SlaveImplementationT>
 typename Master<ImplementationT, SlaveImplementationT>::State 
 Master<ImplementationT, SlaveImplementationT>::get_state(
@@ -174,31 +150,431 @@ void Master<ImplementationT, SlaveImplementationT>::set_state(
     State state,
     std::chrono::milliseconds timeout
 ) {
-    impl().set_state_impl(state, timeout);
+    // If init commands are not executed by the library, simply request state change
+    if constexpr(not config::init_cmds::ExecuteAtStateChange) {
+        impl().set_state_impl(state, timeout);
+        cyclic_state.store(state, std::memory_order_relaxed);
+
+    // Otherwise, go through the ESM step-by-step executing init commands of subsequent transitions
+    } else {
+
+        auto current = get_state(timeout);
+
+        // If bus is already in the target state, simply request state change
+        if(current == state) {
+            impl().set_state_impl(state, timeout);
+            cyclic_state.store(state, std::memory_order_relaxed);
+            return;
+        }
+
+        // Iterate over subsequent transitions
+        while(current != state) {
+
+            auto next = next_state(current, state);
+
+            // Mailbox communication is not available before slaves leave INIT state
+            if(current == State::Init) {
+                impl().set_state_impl(next, timeout);
+                execute_init_cmds(current, next, timeout);
+            } else {
+                execute_init_cmds(current, next, timeout);
+                impl().set_state_impl(next, timeout);
+            }
+
+            cyclic_state.store(next, std::memory_order_relaxed);
+
+            current = next;
+        }
+    }
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+void Master<ImplementationT, SlaveImplementationT>::execute_init_cmds(
+    State from,
+    State to,
+    std::chrono::milliseconds timeout
+) {
+    auto slave_from = to_slave_state(from);
+    auto slave_to   = to_slave_state(to);
+
+    // Select slaves that have commands associated with the transition
+    std::vector<SlaveT*> pending;
+    for(auto &slave : slaves) {
+        if(slave.get_init_cmds_num(slave_from, slave_to) != 0)
+            pending.push_back(&slave);
+    }
+
+    // Limit number of threads used to execute commands
+    std::size_t threads_num = config::init_cmds::ExecutionThreadsNum;
+    if(threads_num == 0)
+        threads_num = std::max(std::thread::hardware_concurrency(), 1U);
+    threads_num = std::min(threads_num, pending.size());
+
+    std::vector<std::exception_ptr> errors(pending.size());
+
+    // Execute commands of all slaves (slaves are picked by subsequent threads one by one)
+    std::atomic<std::size_t> next_slave { 0 };
+    auto worker = [&]() {
+        for(auto i = next_slave++; i < pending.size(); i = next_slave++) {
+            try {
+                pending[i]->execute_init_cmds(slave_from, slave_to, timeout);
+            } catch(...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::future<void>> jobs;
+    for(std::size_t i = 1; i < threads_num; ++i)
+        jobs.push_back(std::async(std::launch::async, worker));
+    worker();
+    for(auto &job : jobs)
+        job.get();
+
+    // Keep the error of the first failed slave
+    std::exception_ptr error;
+    for(auto &slave_error : errors) {
+        if(slave_error) {
+            error = slave_error;
+            break;
+        }
+    }
+
+    // Rethrow error, if any occurred
+    if(error)
+        std::rethrow_exception(error);
+}
+
+/* =============================================== Public mailbox scheduling methods ============================================== */
+
+template<typename ImplementationT,typename SlaveImplementationT>
+std::future<void> Master<ImplementationT, SlaveImplementationT>::schedule_mailbox_task(
+    std::function<void()> task,
+    std::chrono::microseconds estimate
+) {
+    std::packaged_task<void()> packaged_task{ std::move(task) };
+
+    // Get future of the task
+    auto ret = packaged_task.get_future();
+
+    // Enqueue the task
+    std::lock_guard guard{ mailbox_scheduler.lock };
+    mailbox_scheduler.tasks.push_back(typename MailboxScheduler::Task{ std::move(packaged_task), estimate });
+
+    return ret;
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+std::size_t Master<ImplementationT, SlaveImplementationT>::get_pending_mailbox_tasks_num() const {
+    std::lock_guard guard{ mailbox_scheduler.lock };
+    return mailbox_scheduler.tasks.size();
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+std::chrono::microseconds Master<ImplementationT, SlaveImplementationT>::get_last_cycle_slack() const {
+    return std::chrono::microseconds{ mailbox_scheduler.last_slack.load(std::memory_order_relaxed) };
+}
+
+/* ================================================= Public cyclic groups methods ================================================= */
+
+template<typename ImplementationT,typename SlaveImplementationT>
+typename Master<ImplementationT, SlaveImplementationT>::GroupId
+Master<ImplementationT, SlaveImplementationT>::add_cyclic_group(
+    const std::vector<std::string_view> &slave_names,
+    std::size_t rate_divisor
+) {
+    using namespace std::literals::string_literals;
+
+    // Verify rate of the group
+    if(rate_divisor == 0)
+        throw std::runtime_error{ "[ethercat::Master::add_cyclic_group] Rate divisor of the group must not be zero" };
+
+    // Verify slaves of the group
+    for(const auto &name : slave_names) {
+
+        auto slave = find_slave(name);
+
+        if(slave == slaves.end()) {
+            throw std::out_of_range{ 
+                "[ethercat::Master::add_cyclic_group] No slave named '"s + std::string{ name } + "' is present on the bus" };
+        }
+        if(slave_groups[slave - slaves.begin()] != NoGroup) {
+            throw std::runtime_error{ 
+                "[ethercat::Master::add_cyclic_group] Slave '"s + std::string{ name } + "' already belongs to a cyclic group" };
+        }
+    }
+
+    // Create the group
+    auto &group = cyclic_groups.emplace_back();
+    group.rate_divisor = rate_divisor;
+    for(const auto &name : slave_names)
+        group.slaves.push_back(*names.find(name));
+
+    // Associate slaves with the group
+    assign_cyclic_groups();
+
+    return cyclic_groups.size() - 1;
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+bool Master<ImplementationT, SlaveImplementationT>::is_cyclic_group_due(GroupId group) const {
+    return const_cast<Master*>(this)->get_cyclic_group(group, "ethercat::Master::is_cyclic_group_due").due;
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+template<typename HandlerT>
+void Master<ImplementationT, SlaveImplementationT>::register_group_event_handler(
+    GroupId group,
+    Event event,
+    HandlerT &&handler
+) {
+    constexpr std::string_view context { "ethercat::Master::register_group_event_handler" };
+
+    // Select requested handler
+    auto &handler_slot = select_handler(get_cyclic_group(group, context).handlers, event, context);
+
+    // Lock the handler
+    std::lock_guard guard{ handler_slot.lock };
+    // Set the new handler
+    handler_slot.handler = handler;
+}
+
+
+template<typename ImplementationT,typename SlaveImplementationT>
+void Master<ImplementationT, SlaveImplementationT>::unregister_group_event_handler(
+    GroupId group,
+    Event event
+) {
+    constexpr std::string_view context { "ethercat::Master::unregister_group_event_handler" };
+
+    // Select requested handler
+    auto &handler_slot = select_handler(get_cyclic_group(group, context).handlers, event, context);
+
+    // Lock the handler
+    std::lock_guard guard{ handler_slot.lock };
+    // Reset the handler
+    handler_slot.handler = nullptr;
+}
+
+/* ================================================ Public reconfiguration methods ================================================ */
+
+template<typename ImplementationT,typename SlaveImplementationT>
+typename Master<ImplementationT, SlaveImplementationT>::ReloadSummary
+Master<ImplementationT, SlaveImplementationT>::reload(eni::Configuration eni) {
+
+    ReloadSummary summary;
+
+    // Let names of new slaves, PDOs and entries be interned (pool stays unfrozen, i.e. locked, if reload fails)
+    names.thaw();
+
+    // Verify consistency of the new ENI and prepare PDOs of slaves described by it
+    auto configuration = prepare_configuration(std::move(eni), names, resource, "ethercat::Master::reload");
+
+    const auto &slave_eni_list = configuration.slave_eni_list;
+    auto &slaves_pdos = configuration.slaves_pdos;
+
+    // Auxiliary function checking whether lists of PDOs have the same layout
+    auto same_layout = [](const auto &pdos, const auto &rpdos) {
+        return std::equal(pdos.begin(), pdos.end(), rpdos.begin(), rpdos.end(),
+            [](const auto &pdo, const auto &rpdo) { return pdo.has_layout_of(rpdo); });
+    };
+
+    /**
+     * @brief Plan of the reconfiguration of the single slave
+     */
+    struct SlavePlan {
+
+        /// Interface of the slave with the same name in the current configuration (if any)
+        SlaveT *previous { nullptr };
+        /// @c true if @a previous interface is kept
+        bool kept { false };
+        /// Interface rebuilt from the new description (if not kept)
+        std::optional<SlaveT> rebuilt;
+        /// Recompiled CoE init commands of the kept interface
+        typename SlaveT::InitCmds init_cmds;
+        /// Loader of the new ENI description of the kept interface
+        std::function<eni::Slave()> eni_loader;
+
+    };
+
+    std::vector<SlavePlan> plans(slave_eni_list.size());
+
+    // Plan reconfiguration of subsequent slaves (current configuration is not modified yet)
+    for(std::size_t i = 0; i < slave_eni_list.size(); ++i) {
+
+        const auto &slave_eni = slave_eni_list[i];
+        auto &plan = plans[i];
+
+        // Find previous incarnation of the slave
+        auto previous = find_slave(slave_eni.get_name());
+        if(previous != slaves.end())
+            plan.previous = &*previous;
+
+        // Check whether slave can be kept as is
+        plan.kept = (plan.previous != nullptr)
+            and (plan.previous->fixed_addr == slave_eni.get_physical_addr())
+            and (plan.previous->auto_increment_addr == slave_eni.get_auto_increment_addr())
+            and (plan.previous->object_dictionary.get_identity() == descriptors::ObjectDictionary::Identity{
+                    static_cast<uint32_t>(slave_eni.get_vendor_id()),
+                    static_cast<uint32_t>(slave_eni.get_product_code()),
+                    static_cast<uint32_t>(slave_eni.get_revision_no())
+                })
+            and same_layout(plan.previous->inputs, slaves_pdos[i].inputs)
+            and same_layout(plan.previous->outputs, slaves_pdos[i].outputs);
+
+        // If slave is kept, refresh only its init commands and ENI description
+        if(plan.kept) {
+            plan.init_cmds  = plan.previous->compile_init_cmds(slave_eni.get_init_cmds());
+            plan.eni_loader = SlaveT::make_eni_loader(slave_eni);
+        // Otherwise, create a new interface
+        } else {
+            plan.rebuilt.emplace(make_slave(slave_eni,
+                std::move(slaves_pdos[i].inputs),
+                std::move(slaves_pdos[i].outputs)
+            ));
+            plan.rebuilt->bind_names(names);
+        }
+    }
+
+    // Allocate (zeroed) PDI buffers of the new configuration (current buffers are kept if it fails)
+    common::pdi::ImageBuffer input_buffer{ configuration.input_pdi_size };
+    common::pdi::ImageBuffer output_buffer{ configuration.output_pdi_size };
+    // Associate new cyclic commands with entries of the new configuration
+    auto cyclic_table = index_cyclic_commands(std::move(configuration.cyclic_frames), configuration.entries,
+        configuration.input_pdi_size, configuration.output_pdi_size);
+    // Make sure that associating slaves with cyclic groups does not allocate
+    slave_groups.reserve(plans.size());
+
+    // Apply new configuration to the backend
+    impl().reload_impl(const_cast<const eni::Configuration&>(configuration.eni));
+
+    /**
+     * @brief Auxiliary function carrying PDOs of the @p previous list over to the @p rebuilt list
+     *    (PDOs are matched by names and layouts; carried-over PDOs are remapped to the new layout)
+     */
+    auto carry_over_pdos = [&summary](auto &previous, auto &rebuilt) {
+
+        std::vector<bool> taken(previous.size(), false);
+
+        for(auto &pdo : rebuilt) {
+            for(std::size_t i = 0; i < previous.size(); ++i) {
+                if(not taken[i] and previous[i].has_layout_of(pdo)) {
+
+                    // Remap entries of the previous PDO and swap it into the rebuilt slave
+                    summary.remapped_entries += previous[i].remap(pdo);
+                    std::swap(previous[i], pdo);
+                    taken[i] = true;
+
+                    ++summary.kept_pdos;
+                    break;
+                }
+            }
+        }
+    };
+
+    // Acquire both PDIs
+    std::scoped_lock guard{ input_pdi.lock, output_pdi.lock };
+
+    std::pmr::vector<SlaveT> new_slaves{ resource };
+    new_slaves.reserve(plans.size());
+
+    // Reconfigure subsequent slaves
+    std::size_t previous_num = 0;
+    for(std::size_t i = 0; i < plans.size(); ++i) {
+
+        auto &plan = plans[i];
+
+        if(plan.previous != nullptr)
+            ++previous_num;
+
+        // Kept slaves: remap entries and move the slave to the new list
+        if(plan.kept) {
+
+            auto &slave = *plan.previous;
+
+            for(std::size_t j = 0; j < slave.inputs.size(); ++j)
+                summary.remapped_entries += slave.inputs[j].remap(slaves_pdos[i].inputs[j]);
+            for(std::size_t j = 0; j < slave.outputs.size(); ++j)
+                summary.remapped_entries += slave.outputs[j].remap(slaves_pdos[i].outputs[j]);
+
+            slave.init_cmds  = std::move(plan.init_cmds);
+            slave.eni_loader = std::move(plan.eni_loader);
+
+            summary.kept_pdos += slave.inputs.size() + slave.outputs.size();
+            ++summary.kept_slaves;
+
+            new_slaves.push_back(std::move(slave));
+
+        // Rebuilt slaves: carry over PDOs of the previous incarnation
+        } else {
+
+            auto &slave = *plan.rebuilt;
+
+            if(plan.previous != nullptr) {
+                carry_over_pdos(plan.previous->inputs, slave.inputs);
+                carry_over_pdos(plan.previous->outputs, slave.outputs);
+            }
+
+            ++summary.rebuilt_slaves;
+
+            new_slaves.push_back(std::move(slave));
+        }
+    }
+
+    summary.removed_slaves = slaves.size() - previous_num;
+
+    // Replace list of slaves (both lists use the same resource, so they can be swapped; slaves 
+    // that are not described anymore are destroyed)
+    slaves.swap(new_slaves);
+    new_slaves.clear();
+    // Replace tables of entries (all remaining entries refer to new tables now)
+    pdi_entries = std::move(configuration.entries);
+
+    // Replace PDI buffers
+    input_pdi.data  = std::move(input_buffer);
+    output_pdi.data = std::move(output_buffer);
+
+    // Replace table of cyclic commands
+    cyclic.swap(cyclic_table);
+    // Associate the new set of slaves with cyclic groups
+    assign_cyclic_groups();
+
+    // Update bus cycle
+    bus_cycle = configuration.bus_cycle;
+
+    // All names of the new configuration are interned now
+    names.freeze();
+
+    return summary;
 }
 
 /* ================================================== Public EtherCAT I/O methods ================================================= */
 
 template<typename ImplementationT,typename SlaveImplementationT>
-std::vector<uint8_t> &Master<ImplementationT, SlaveImplementationT>::_get_input_buffer() {
+common::pdi::ImageBuffer &Master<ImplementationT, SlaveImplementationT>::_get_input_buffer() {
     return input_pdi.data;
 }
 
 
 template<typename ImplementationT,typename SlaveImplementationT>
-const std::vector<uint8_t> &Master<ImplementationT, SlaveImplementationT>::_get_input_buffer() const {
+const common::pdi::ImageBuffer &Master<ImplementationT, SlaveImplementationT>::_get_input_buffer() const {
     return input_pdi.data;
 }
 
 
 template<typename ImplementationT,typename SlaveImplementationT>
-std::vector<uint8_t> &Master<ImplementationT, SlaveImplementationT>::_get_output_buffer() {
+common::pdi::ImageBuffer &Master<ImplementationT, SlaveImplementationT>::_get_output_buffer() {
     return output_pdi.data;
 }
 
 
 template<typename ImplementationT,typename SlaveImplementationT>
-const std::vector<uint8_t> &Master<ImplementationT, SlaveImplementationT>::_get_output_buffer() const {
+const common::pdi::ImageBuffer &Master<ImplementationT, SlaveImplementationT>::_get_output_buffer() const {
     return output_pdi.data;
 }
 
@@ -206,36 +582,75 @@ const std::vector<uint8_t> &Master<ImplementationT, SlaveImplementationT>::_get_
 template<typename ImplementationT,typename SlaveImplementationT>
 void Master<ImplementationT, SlaveImplementationT>::read_bus(std::chrono::milliseconds timeout) {
 
+    // Mark start of the bus cycle for the mailbox scheduler
+    mailbox_scheduler.cycle_start.store(
+        std::chrono::steady_clock::now().time_since_epoch().count(),
+        std::memory_order_relaxed
+    );
+
+    // Select cyclic groups processed in the cycle
+    start_groups_cycle();
+
     // Call 'start' handler
-    handlers.at_read_bus_start();
+    trigger_event(&Handlers::at_read_bus_start);
     
     {
         // Acquire input PDI
         std::scoped_lock guard{ input_pdi.lock };
         
-        // Perform I/O
-        impl().read_bus_impl(input_pdi.data, timeout);
-        
-        // Update input PDO entries of all slaves with incoming PDI
-        for(auto &slave : slaves) {
-
-            // Update all input PDO entries of the slave
-            for(auto &pdo : slave.template get_pdos<SlaveT::PdoDirection::Input>())
-                for(auto &entry : pdo.get_entries())
-                    entry.update(input_pdi.data);
-
+        // If implementation supports per-command I/O, read data of subsequent commands
+        if constexpr(supports_command_io()) {
+
+            auto state = to_cyclic_state(cyclic_state.load(std::memory_order_relaxed));
+
+            for(const auto &indexed : cyclic.commands) {
+
+                // Skip commands that carry no inputs or are not sent in the current state
+                if(not indexed.exchanges_inputs or not indexed.command.is_active_in(state))
+                    continue;
+                // Skip commands carrying only entries of slaves that are not due in the cycle
+                if(not is_range_due(*pdi_entries.inputs, indexed.inputs_begin, indexed.inputs_end))
+                    continue;
+
+                // Perform I/O
+                auto data = config::types::Span<uint8_t>{ input_pdi.data }.subspan(
+                    indexed.command.input_offset, indexed.command.data_length);
+                if(not impl().read_command_impl(indexed.command, data, timeout))
+                    continue;
+
+                // Update input PDO entries covered by the completed command
+                for(auto i = indexed.inputs_begin; i != indexed.inputs_end; ++i) {
+                    if(is_slave_due(pdi_entries.inputs->get_owner(i)))
+                        pdi_entries.inputs->read(i, input_pdi.data);
+                }
+            }
+
+        // Otherwise, read the whole PDI
+        } else {
+
+            // Perform I/O
+            impl().read_bus_impl(input_pdi.data, timeout);
+            
+            // Update input PDO entries of all slaves due in the cycle with incoming PDI
+            auto &entries = *pdi_entries.inputs;
+            for(std::size_t i = 0; i < entries.size(); ++i) {
+                if(is_slave_due(entries.get_owner(i)))
+                    entries.read(i, input_pdi.data);
+            }
         }
     }
 
     // Call 'I/O end' handler
-    handlers.at_read_bus_complete();
+    trigger_event(&Handlers::at_read_bus_complete);
 
-    // Notify slaves that their Input PDOs has been updated
-    for(auto &slave : slaves)
-        slave.template notify<SlaveT::PdoDirection::Input>();
+    // Notify slaves due in the cycle that their Input PDOs has been updated
+    for(std::size_t i = 0; i < slaves.size(); ++i) {
+        if(is_slave_due(i))
+            slaves[i].template notify<SlaveT::PdoDirection::Input>();
+    }
         
     // Call 'Slaves update end' handler
-    handlers.at_read_bus_slaves_update_complete();
+    trigger_event(&Handlers::at_read_bus_slaves_update_complete);
 }
 
 
@@ -243,39 +658,70 @@ template<typename ImplementationT,typename SlaveImplementationT>
 void Master<ImplementationT, SlaveImplementationT>::write_bus(std::chrono::milliseconds timeout) {
 
     // Call 'start' handler
-    handlers.at_write_bus_start();
+    trigger_event(&Handlers::at_write_bus_start);
         
-    // Notify all slave's that their Output PDOs will be written to the bus
-    for(auto &slave : slaves)
-        slave.template notify<SlaveT::PdoDirection::Output>();
+    // Notify all slave's due in the cycle that their Output PDOs will be written to the bus
+    for(std::size_t i = 0; i < slaves.size(); ++i) {
+        if(is_slave_due(i))
+            slaves[i].template notify<SlaveT::PdoDirection::Output>();
+    }
 
     // Call 'Slaves update end' handler
-    handlers.at_write_bus_slaves_update_complete();
+    trigger_event(&Handlers::at_write_bus_slaves_update_complete);
     
     {
         // Acquire output PDI
         std::scoped_lock guard{ output_pdi.lock };
 
-        // Update outgoing PDI with output PDO entries of all slaves
-        for(auto &slave : slaves) {
-
-            // Update all input PDO entries of the slave
-            for(auto &pdo : slave.template get_pdos<SlaveT::PdoDirection::Output>())
-                for(auto &entry : pdo.get_entries())
-                    entry.update(output_pdi.data);
-
+        // If implementation supports per-command I/O, write data of subsequent commands
+        if constexpr(supports_command_io()) {
+
+            auto state = to_cyclic_state(cyclic_state.load(std::memory_order_relaxed));
+
+            for(const auto &indexed : cyclic.commands) {
+
+                // Skip commands that carry no outputs or are not sent in the current state
+                if(not indexed.exchanges_outputs or not indexed.command.is_active_in(state))
+                    continue;
+                // Skip commands carrying only entries of slaves that are not due in the cycle
+                if(not is_range_due(*pdi_entries.outputs, indexed.outputs_begin, indexed.outputs_end))
+                    continue;
+
+                // Update outgoing PDI with output PDO entries covered by the command
+                for(auto i = indexed.outputs_begin; i != indexed.outputs_end; ++i) {
+                    if(is_slave_due(pdi_entries.outputs->get_owner(i)))
+                        pdi_entries.outputs->write(i, output_pdi.data);
+                }
+
+                // Perform I/O
+                auto data = config::types::Span<const uint8_t>{ output_pdi.data }.subspan(
+                    indexed.command.output_offset, indexed.command.data_length);
+                impl().write_command_impl(indexed.command, data, timeout);
+            }
+
+        // Otherwise, write the whole PDI
+        } else {
+
+            // Update outgoing PDI with output PDO entries of all slaves due in the cycle
+            const auto &entries = *pdi_entries.outputs;
+            for(std::size_t i = 0; i < entries.size(); ++i) {
+                if(is_slave_due(entries.get_owner(i)))
+                    entries.write(i, output_pdi.data);
+            }
+            
+            // Perform I/O
+            impl().write_bus_impl(
+                config::types::Span<const uint8_t>{ output_pdi.data },
+                timeout
+            );
         }
-        
-        // Perform I/O
-        impl().write_bus_impl(
-            const_cast<const std::vector<uint8_t>&>(output_pdi.data),
-            timeout
-        );
     }
 
     // Call 'I/O end' handler
-    handlers.at_write_bus_complete();
+    trigger_event(&Handlers::at_write_bus_complete);
 
+    // Use remaining slack of the cycle to serve mailbox tasks
+    serve_mailbox_tasks();
 }
 
 /* ================================================================================================================================ */
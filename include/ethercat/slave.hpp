@@ -17,11 +17,17 @@
 /* =========================================================== Includes =========================================================== */
 
 // Standard includes
+#include <array>
 #include <chrono>
+#include <filesystem>
+#include <functional>
 // Private includes
+#include "ethercat/config.hpp"
 #include "ethercat/common/utilities/crtp.hpp"
+#include "ethercat/common/utilities/string_pool.hpp"
 #include "ethercat/common/handlers/event_handler.hpp"
 #include "ethercat/eni.hpp"
+#include "ethercat/descriptors/object_dictionary.hpp"
 #include "ethercat/slave/translators_traits.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
@@ -111,6 +117,31 @@ public: /* ---------------------------------------------------- Public types ---
     template<SdoDirection dir, types::BuiltinType::ID type_id, std::size_t arity = 0>
     using BuiltinTypeSdo = 
         DefaultTranslatedSdo<dir, common::types::traits::TypeRepresentation<type_id, arity>>;
+
+    /**
+     * @brief Auxiliary class providing streaming (segmented) access to large SDO objects 
+     *    of the slave without translating them into app-domain entities
+     */
+    class SdoStream;
+
+    /**
+     * @brief Type of the functor consuming subsequent chunks of the streamed SDO upload
+     * @details Functor is given the chunk of data and the total size of the object (@c 0
+     *    if not known). It should return @c false to abort the transfer.
+     */
+    using SdoChunkConsumer = std::function<bool(config::types::Span<const uint8_t> chunk, std::size_t total_size)>;
+
+    /**
+     * @brief Type of the functor producing subsequent chunks of the streamed SDO download
+     * @details Functor is required to fill the whole @p chunk with data. It should return 
+     *    @c false to abort the transfer.
+     */
+    using SdoChunkProducer = std::function<bool(config::types::Span<uint8_t> chunk)>;
+
+    /**
+     * @brief Auxiliary class collecting latency and error statistics of SDO accesses
+     */
+    class SdoStatistics;
     
     /**
      * @brief Enumeration identifying direction of PDO objects
@@ -199,12 +230,25 @@ public: /* -------------------------------------------- Public EtherCAT common m
     /**
      * @returns 
      *    ENI configuration of the slave
+     * 
+     * @throws eni::Error
+     *    if the ENI file describing the slave could not be loaded or has been modified since
+     *    the slave has been configured (i.e. it may not describe the running configuration)
+     * @throws std::out_of_range
+     *    if the slave is no longer described in the ENI file
+     * 
+     * @note If the slave has been described by the ENI file, the file is loaded on the first
+     *    call (see @ref eni_loader ), which may take considerable time. Subsequent calls return
+     *    the description kept by the slave.
      */
     inline eni::Slave get_eni() const;
 
     /**
      * @returns 
      *    name of the slave
+     * 
+     * @note Name is interned in the pool of the Master when the slave is registered in it, so
+     *    that it is not available in constructors of slave implementations yet
      */
     inline std::string_view get_name() const;
     
@@ -256,6 +300,125 @@ public: /* -------------------------------------------- Public EtherCAT common m
      */
     inline void set_state(State state, std::chrono::milliseconds timeout = std::chrono::milliseconds{ 100 });
 
+public: /* --------------------------------------------- Public init commands methods --------------------------------------------- */
+
+    /**
+     * @param from 
+     *    source state of the transition
+     * @param to 
+     *    target state of the transition
+     * @returns 
+     *    number of (compiled) CoE init commands associated with the @p from -> @p to transition
+     */
+    inline std::size_t get_init_cmds_num(State from, State to) const;
+
+    /**
+     * @brief Executes CoE init commands described in the ENI for the @p from -> @p to transition
+     * @details Commands are executed in order of appearance in the ENI file after being compiled
+     *    into compact per-transition lists at construction. If enabled with 
+     *    @ref config::init_cmds::CoalesceCompleteAccess , sequences of downloads into subsequent
+     *    subindices of a single object are performed as a single Complete Access download (for 
+     *    slaves whose ENI description uses Complete Access)
+     * 
+     * @param from 
+     *    source state of the transition
+     * @param to 
+     *    target state of the transition
+     * @param timeout 
+     *    access timeout used for commands that do not define timeout on their own
+     * 
+     * @throws error 
+     *    whatever error thrown by the underlying implementation
+     * 
+     * @note This method is called automatically by @ref set_state() (and Master::set_state() ) if 
+     *    @ref config::init_cmds::ExecuteAtStateChange is enabled
+     */
+    inline void execute_init_cmds(
+        State from,
+        State to,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds{ 100 }
+    );
+
+public: /* ------------------------------------------- Public object dictionary methods ------------------------------------------- */
+
+    /**
+     * @returns 
+     *    run-time mirror of the Objects Dictionary of the slave
+     */
+    inline descriptors::ObjectDictionary &get_object_dictionary();
+
+    /**
+     * @returns 
+     *    run-time mirror of the Objects Dictionary of the slave
+     */
+    inline const descriptors::ObjectDictionary &get_object_dictionary() const;
+
+    /**
+     * @brief Verifies that the given entry of the object is present in the Objects Dictionary 
+     *    of the device (by uploading its value via SDO) and, on success, stores its description
+     *    in the run-time mirror of the dictionary
+     * @details Entry is uploaded with the streaming SDO interface (see @ref SdoStream ), as the
+     *    size of the uploaded data is compared against the declared @p type . If the implementation
+     *    does not provide @a upload_sdo_segmented(...) , the entry is uploaded with @a upload_sdo(...)
+     *    into the buffer sized after the @p type instead (in such a case the size mismatch is 
+     *    detected only if the implementation reports it on its own). Bitoffsets of all
+     *    scanned entries of the object (as seen with Complete Access) are recomputed from sizes
+     *    of entries preceding them, so subsequent subindices of the object should be scanned 
+     *    for offsets to be meaningful.
+     * 
+     * @param index 
+     *    index of the object
+     * @param subindex 
+     *    subindex of the entry
+     * @param type 
+     *    type of the entry
+     * @param name 
+     *    name of the entry
+     * @param timeout 
+     *    access timeout
+     * 
+     * @throws std::runtime_error 
+     *    if size of the uploaded entry does not match size of the @p type
+     * @throws error 
+     *    whatever error thrown by the underlying implementation
+     */
+    inline void scan_object_entry(
+        uint16_t index,
+        uint8_t subindex,
+        const types::Type &type,
+        std::string_view name,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds{ 100 }
+    );
+
+    /**
+     * @brief Loads run-time mirror of the Objects Dictionary of the slave from the @p directory
+     *    (file name is given by the descriptors::ObjectDictionary::make_file_name() )
+     * 
+     * @param directory 
+     *    directory containing stored dictionaries
+     * @returns 
+     *    @retval @c true if dictionary has been loaded
+     *    @retval @c false if no dictionary matching the device's identity has been found
+     * 
+     * @throws std::ios_base::failure
+     *    if file could not be read
+     * @throws std::runtime_error
+     *    if stored dictionary is invalid
+     */
+    inline bool load_object_dictionary(const std::filesystem::path &directory);
+
+    /**
+     * @brief Saves run-time mirror of the Objects Dictionary of the slave into the @p directory
+     *    (file name is given by the descriptors::ObjectDictionary::make_file_name() )
+     * 
+     * @param directory 
+     *    target directory
+     * 
+     * @throws std::ios_base::failure
+     *    if file could not be written
+     */
+    inline void save_object_dictionary(const std::filesystem::path &directory) const;
+
 public: /* --------------------------------------------- Public access methods (SDO) ---------------------------------------------- */
 
     /**
@@ -387,6 +550,42 @@ public: /* --------------------------------------------- Public access methods (
         uint16_t subindex = 0
     ) const;
     
+    /**
+     * @brief Constructs a streaming SDO proxy object associated with @p this slave that can be 
+     *    used to transfer large objects from/to the device in chunks of bounded size
+     * 
+     * @param index 
+     *    index of the object
+     * @param subindex 
+     *    subindex of the object
+     * @param chunk_size 
+     *    maximal size of the chunk passed to/from the user code at once
+     * @returns 
+     *    streaming SDO proxy object associated with @p this slave
+     * 
+     * @see See description of SdoStream 
+     */
+    inline SdoStream get_sdo_stream(
+        uint16_t index,
+        uint16_t subindex = 0,
+        std::size_t chunk_size = config::sdo::DefaultStreamChunkSize
+    );
+    
+public: /* -------------------------------------------- Public SDO statistics methods --------------------------------------------- */
+
+    /**
+     * @returns 
+     *    latency and error statistics of SDO accesses performed on the slave
+     * 
+     * @note Statistics are collected only if @ref config::sdo::CollectStatistics is enabled. 
+     *    Accesses that failed with std::system_error carrying std::errc::timed_out code are 
+     *    classified as timeouts; all other failures are classified as aborts
+     */
+    inline SdoStatistics &get_sdo_statistics();
+
+    /// @overload SdoStatistics &get_sdo_statistics()
+    inline const SdoStatistics &get_sdo_statistics() const;
+
 public: /* --------------------------------------------- Public access methods (PDO) ---------------------------------------------- */
 
     /**
@@ -508,18 +707,21 @@ protected: /* --------------------------------------------- Protected ctors & dt
 protected: /* ------------------------------------------------ Protected data ----------------------------------------------------- */
 
     /**
-     * @brief ENI description of the Slave device
-     * @performance Currently the ENI description of the slave is sored entirely in the memory 
-     *    for entire lifetime of the Slave driver. It MAY be unnecesary performance hit in 
-     *    memory-constained environments. An alternative is to make Master pass to the Slave's 
-     *    constructor a functor object that would load slave-specific ENI element on-demand.
-     *    This however would require per-access I/O operation that would affect performance
-     *    in different way.
+     * @brief Loader of the ENI description of the Slave device
+     * @details Only data required at runtime (name, addresses, identity, PDOs and compiled init
+     *    commands) is extracted from the ENI when the slave is constructed, so that the ENI tree
+     *    can be released afterwards. If the slave has been described by the ENI file, its full 
+     *    description is re-loaded from the file (or from its compiled cache, if enabled with 
+     *    @ref config::eni::UseCompiledCache ) when it is requested with get_eni() for the first
+     *    time and the slave's subtree is kept for subsequent requests. Otherwise the loader holds
+     *    an autonomized copy of the slave's subtree of the ENI.
      */
-    eni::Slave eni_description;
+    std::function<eni::Slave()> eni_loader;
 
-    /// Slave's name
-    std::string name;
+    /// Pool of names of slaves that have not been bound to the pool of the Master (see bind_names())
+    static inline common::utilities::StringPool unbound_names;
+    /// Slave's name (interned in the pool of the Master once the slave is bound to it)
+    common::utilities::Symbol name;
 
     /// Slave's fixed adress (physical address)
     uint16_t fixed_addr;
@@ -528,6 +730,128 @@ protected: /* ------------------------------------------------ Protected data --
     /// Slave's topological adress
     uint16_t topological_addr;
 
+    /// Run-time mirror of the slave's Objects Dictionary
+    descriptors::ObjectDictionary object_dictionary;
+
+private: /* -------------------------------------------- Private types (init commands) -------------------------------------------- */
+
+    /// Number of states of the ESM (EtherCAT State Machine)
+    static constexpr std::size_t StatesNum = 5;
+
+    /**
+     * @brief Compiled form of the CoE init command
+     */
+    struct InitCmd {
+
+        /// Index of the target object
+        uint16_t index;
+        /// Subindex of the target object
+        uint8_t subindex;
+        /// @c true if command is an SDO download (upload otherwise)
+        bool download;
+        /// @c true if command is performed with Complete Access
+        bool complete_access;
+        /// Timeout of the command (zero if default timeout should be used)
+        std::chrono::milliseconds timeout;
+        /// Offset of the command's data in the common data buffer
+        std::size_t data_offset;
+        /// Size of the command's data
+        std::size_t data_size;
+
+    };
+
+    /**
+     * @brief Compact set of CoE init commands of the slave grouped by ESM transitions
+     */
+    struct InitCmds {
+
+        /// Compiled commands (commands of subsequent transitions are stored contiguously)
+        std::vector<InitCmd> cmds;
+        /// Common buffer for data of all commands
+        std::vector<uint8_t> data;
+        /// Offsets of the first command of the subsequent transitions in @a cmds (indexed with @ref transition_id )
+        std::array<std::size_t, StatesNum * StatesNum + 1> offsets { };
+
+    };
+
+private: /* ------------------------------------------------ Private methods (ENI) ------------------------------------------------ */
+
+    /**
+     * @param slave_eni 
+     *    ENI description of the slave
+     * @returns 
+     *    functor loading ENI description of the slave on demand
+     */
+    static inline std::function<eni::Slave()> make_eni_loader(eni::Slave slave_eni);
+
+private: /* ------------------------------------------- Private methods (init commands) ------------------------------------------- */
+
+    /**
+     * @returns 
+     *    numerical identifier of the @p from -> @p to transition
+     */
+    static constexpr std::size_t transition_id(State from, State to);
+
+    /**
+     * @returns 
+     *    next state that the slave should be transitioned to on the way from the @p current
+     *    to the @p target state when ESM transitions are performed step-by-step
+     */
+    static constexpr State next_state(State current, State target);
+
+    /**
+     * @brief Compiles CoE init commands described in the ENI into the compact per-transition
+     *    lists (as stored in @ref init_cmds )
+     * 
+     * @param cmds_description 
+     *    ENI description of CoE init commands of the slave
+     * @returns 
+     *    compiled commands
+     * 
+     * @throws eni::Error
+     *    if invalid description is given
+     */
+    inline InitCmds compile_init_cmds(const eni::Slave::InitCmdsList &cmds_description) const;
+
+private: /* -------------------------------------------- Private data (init commands) --------------------------------------------- */
+
+    /// CoE init commands of the slave
+    InitCmds init_cmds;
+
+private: /* ------------------------------------------------ Private methods (SDO) ------------------------------------------------ */
+
+    /**
+     * @brief Performs SDO @p access collecting its latency and outcome in the slave's SDO 
+     *    statistics (if enabled with @ref config::sdo::CollectStatistics )
+     * 
+     * @param index 
+     *    index of the accessed object
+     * @param subindex 
+     *    subindex of the accessed object
+     * @param dir 
+     *    direction of the access ( Upload or Download )
+     * @param access 
+     *    functor performing the actual access
+     * 
+     * @throws error 
+     *    whatever error thrown by the @p access
+     */
+    template<typename AccessT>
+    inline void access_sdo(uint16_t index, uint16_t subindex, SdoDirection dir, AccessT &&access);
+
+    /**
+     * @returns 
+     *    @retval @c true if the implementation provides the streaming upload method 
+     *       (@a upload_sdo_segmented() )
+     *    @retval @c false otherwise
+     */
+    static constexpr bool supports_segmented_upload();
+
+private: /* ------------------------------------------------- Private data (SDO) -------------------------------------------------- */
+
+    /// Statistics of SDO accesses
+    SdoStatistics sdo_statistics;
+
 private: /* ----------------------------------------------- Private methods (PDO) ------------------------------------------------- */
 
     /**
@@ -543,26 +867,43 @@ private: /* ----------------------------------------------- Private methods (PDO
     template<PdoDirection dir>
     inline void notify();
 
+    /**
+     * @param name 
+     *    name of the PDO
+     * @returns 
+     *    pointer to the PDO with the given @p name or @c nullptr if there is no such PDO
+     *    (PDOs are compared by symbols of their interned names)
+     */
+    template<PdoDirection dir>
+    inline Pdo<dir> *find_pdo(std::string_view name);
+
+    /**
+     * @brief Interns name of the slave in the @p names pool that names of slave's PDOs
+     *    have been interned in
+     * @details This method is called by the Master right after the slave is created. Before
+     *    that, the name refers to the pool shared by all unbound slaves.
+     */
+    inline void bind_names(common::utilities::StringPool &names);
+
 private: /* ------------------------------------------------ Private data (PDO) --------------------------------------------------- */
 
     /**
-     * @brief Input PDO entries
-     * @performance This vector is accessed on the critical path of the bus I/O loop. 
-     *    switching implementation to statically-allocated container (e.g. 
-     *    boost::static_vector can improve reference-locality and so cache 
-     *    performance)
+     * @brief Input PDOs
+     * @note Data of PDO entries is kept in tables of the Master (see common::pdi::EntryTable)
+     *    that the bus I/O loop walks, so that this vector is not accessed by the cycle
      */
     std::vector<Pdo<PdoDirection::Input>> inputs;
 
     /**
-     * @brief Output PDO entries
-     * @performance This vector is accessed on the critical path of the bus I/O loop. 
-     *    switching implementation to statically-allocated container (e.g. 
-     *    boost::static_vector can improve reference-locality and so cache 
-     *    performance)
+     * @brief Output PDOs
+     * @note Data of PDO entries is kept in tables of the Master (see common::pdi::EntryTable)
+     *    that the bus I/O loop walks, so that this vector is not accessed by the cycle
      */
     std::vector<Pdo<PdoDirection::Output>> outputs;
 
+    /// Pool that names of the slave and its PDOs are interned in
+    const common::utilities::StringPool *names { nullptr };
+
     /**
      * @brief Set of handlers for slave-related events
      */
@@ -584,6 +925,8 @@ private: /* ------------------------------------------------ Private data (PDO)
 /* ==================================================== Implementation includes =================================================== */
 
 #include "ethercat/slave/sdo.hpp"
+#include "ethercat/slave/sdo_stream.hpp"
+#include "ethercat/slave/sdo_statistics.hpp"
 #include "ethercat/slave/pdo.hpp"
 #include "ethercat/slave/slave_priv.hpp"
 #include "ethercat/slave/slave_prot.hpp"
@@ -94,6 +94,16 @@ protected: /* --------------------------------------------- Protected ctors & dt
 
 protected: /* -------------------------------------- Protected implementation methods (SDO) --------------------------------------- */
 
+    /**
+     * @note SDO methods are expected to report expired timeouts by throwing std::system_error 
+     *    carrying std::errc::timed_out code so that they are distinguished from other failures
+     *    in the SDO statistics (see Slave::SdoStatistics). Implementations retrying accesses
+     *    on their own can report retries with get_sdo_statistics().record_retry(...)
+     * @note If @ref config::init_cmds::ExecutionThreadsNum is other than @c 1 , the Master calls
+     *    download_sdo(...) and upload_sdo(...) of distinct slaves concurrently while executing
+     *    CoE init commands. In such a case these methods need to be thread-safe across slaves.
+     */
+
     /**
      * @brief Type-independent implementation of the @ref download_sdo(...) method template
      *
@@ -138,6 +148,73 @@ protected: /* -------------------------------------- Protected implementation me
         bool complete_access
     );
 
+protected: /* --------------------------------- Protected implementation methods (segmented SDO) ---------------------------------- */
+
+    /**
+     * @brief Implementation of the streaming upload used by the @ref SdoStream (optional; required
+     *    only if the streaming interface is used). If provided, it is also used by 
+     *    @ref scan_object_entry() to measure sizes of entries (otherwise upload_sdo(...) is used)
+     * @details Implementation is expected to call @p consumer for subsequent chunks of data (of size
+     *    not greater than @p chunk_size ) as they are received from the slave. Buffers holding the 
+     *    data are owned by the implementation, which is free to request subsequent segments from
+     *    the slave while the @p consumer processes the current one. If @p consumer returns @c false 
+     *    the transfer should be aborted.
+     *
+     * @param index
+     *    index of the object
+     * @param subindex
+     *    subindex of the object
+     * @param chunk_size
+     *    maximal size of the chunk passed to the @p consumer at once
+     * @param consumer
+     *    functor consuming subsequent chunks of data
+     * @param timeout
+     *    access timeout of a single segment's exchange
+     * @param complete_access
+     *    @c true if complete access is to be performed
+     */
+    void upload_sdo_segmented(
+        uint16_t index,
+        uint16_t subindex,
+        std::size_t chunk_size,
+        const SdoChunkConsumer &consumer,
+        std::chrono::milliseconds timeout,
+        bool complete_access
+    );
+
+    /**
+     * @brief Implementation of the streaming download used by the @ref SdoStream (optional; required
+     *    only if the streaming interface is used)
+     * @details Implementation is expected to call @p producer to obtain subsequent chunks of data (of
+     *    size not greater than @p chunk_size ) to be sent to the slave. Buffers holding the data are 
+     *    owned by the implementation, which is free to request next chunk from the @p producer while 
+     *    the previous one is being sent. If @p producer returns @c false the transfer should be aborted.
+     *
+     * @param index
+     *    index of the object
+     * @param subindex
+     *    subindex of the object
+     * @param size
+     *    total size of the object
+     * @param chunk_size
+     *    maximal size of the chunk requested from the @p producer at once
+     * @param producer
+     *    functor producing subsequent chunks of data
+     * @param timeout
+     *    access timeout of a single segment's exchange
+     * @param complete_access
+     *    @c true if complete access is to be performed
+     */
+    void download_sdo_segmented(
+        uint16_t index,
+        uint16_t subindex,
+        std::size_t size,
+        std::size_t chunk_size,
+        const SdoChunkProducer &producer,
+        std::chrono::milliseconds timeout,
+        bool complete_access
+    );
+
 };
 
 /* ================================================================================================================================ */
@@ -17,6 +17,8 @@
 /* =========================================================== Includes =========================================================== */
 
 // Private includes
+#include "ethercat/common/pdi/entry_table.hpp"
+#include "ethercat/common/utilities/string_pool.hpp"
 #include "ethercat/eni.hpp"
 #include "ethercat/slave.hpp"
 #include "ethercat/types.hpp"
@@ -117,19 +119,75 @@ protected: /* ------------------------------------------------ Protected ctors -
      *    ENI description of the PDO
      * @param pdi_variables 
      *    ENI description of PDI variables corresponding to PDO's entries
+     * @param names
+     *    pool that names of the PDO and its entries are interned in
+     * @param table
+     *    table that data of PDO's entries is allocated in
      * 
      * @throws eni::Error 
      *    if inconsistency between @p pdo_description and @p pdi_variables has been detected
      */
     Pdo(
         eni::Slave::Pdo pdo_description,
-        const eni::ProcessImage::VariablesList &pdi_variables
+        const eni::ProcessImage::VariablesList &pdi_variables,
+        common::utilities::StringPool &names,
+        common::pdi::EntryTable &table
     );
 
+private: /* ------------------------------------------------- Private friends ----------------------------------------------------- */
+
+    /// Make Slave a friend to let it look PDOs up by symbols
+    friend class Slave;
+
+private: /* ------------------------------------------------- Private methods ----------------------------------------------------- */
+
+    /**
+     * @param name 
+     *    name of the PDO entry
+     * @returns 
+     *    iterator to the entry with the given @p name or past-the-end iterator if there is no
+     *    such entry (entries are compared by symbols of their interned names)
+     */
+    inline typename std::vector<Entry>::iterator find_entry(std::string_view name);
+
+    /**
+     * @param name 
+     *    symbol of the name of the PDO entry
+     * @returns 
+     *    iterator to the entry with the given @p name or past-the-end iterator if there is no
+     *    such entry
+     */
+    inline typename std::vector<Entry>::iterator find_entry(common::utilities::Symbol name);
+
+    /**
+     * @param rpdo 
+     *    PDO to be compared
+     * 
+     * @retval true 
+     *    if @p rpdo has the same name and maps entries of the same layout (in the same order)
+     *    as the PDO (i.e. PDOs may differ only with offsets of their entries in the PDI)
+     * @retval false 
+     *    otherwise
+     */
+    inline bool has_layout_of(const Pdo &rpdo) const;
+
+    /**
+     * @brief Moves entries of the PDO to rows of the table that corresponding entries of the
+     *    @p rpdo (having the same layout) are stored in
+     * 
+     * @param rpdo 
+     *    PDO describing the new layout
+     * @returns 
+     *    number of entries whose offsets have changed
+     */
+    inline std::size_t remap(const Pdo &rpdo);
+
 private: /* --------------------------------------------------- Private data ------------------------------------------------------ */
 
-    /// Name of the Entry
-    std::string name;
+    /// Pool that names of the PDO and its entries are interned in
+    const common::utilities::StringPool *names;
+    /// Name of the PDO (interned in the @a names pool)
+    common::utilities::Symbol name;
     /// Entries mapped into the PDO
     std::vector<Entry> entries;
     
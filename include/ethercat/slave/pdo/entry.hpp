@@ -220,53 +220,69 @@ protected: /* ------------------------------------------------ Protected ctors -
      *    ENI description of the Entry
      * @param pdi_variable
      *    ENI description of PDI variable corresponding to the entry
+     * @param names
+     *    pool that the name of the entry is interned in
+     * @param table
+     *    table that the data of the entry is allocated in
      * 
      * @throws eni::Error 
      *    if inconsistency between @p entry_description and @p pdi_variable has been detected
      */
     Entry(
         eni::Slave::Pdo::Entry entry_description,
-        eni::ProcessImage::Variable pdi_variable
+        eni::ProcessImage::Variable pdi_variable,
+        common::utilities::StringPool &names,
+        common::pdi::EntryTable &table
     );
     
 private: /* ------------------------------------------------- Private methods ----------------------------------------------------- */
 
-    /// Make Master a friend to let it access update method
+    /// Make Master a friend to let it access private methods
     template<typename MasterImplementationT,typename SlaveImplementationT>
     friend class Master;
-    
+
     /**
-     * @brief Updates internal buffer of the entry from the current Process Data Image @p pdi buffer
-     * @details This method is called by the Master driver each time Input Process Data Image is
-     *    updated with data from the bus
-     * 
-     * @param pdi 
-     *   reference to the current PDI buffer
+     * @brief Moves data of the entry into a new row of the @p table
+     * @details This method is called by the Master driver when entries of all slaves are gathered
+     *    into a single table associated with the PDI
      * 
-     * @note This overload is enabled only for Input entries 
+     * @param table 
+     *    target table
+     * @param owner 
+     *    index of the slave owning the entry
      */
-    template<bool enable = common::translation::is_input_dir_v<dir>,
-        std::enable_if_t<enable, bool> = true>
-    inline void update(config::types::Span<const uint8_t> pdi);
+    inline void relocate(common::pdi::EntryTable &table, std::size_t owner);
 
     /**
-     * @brief Updates current Process Data Image @p pdi buffer with data stored in the entrie's internal buffer
-     * @details This method is called by the Master driver each time Output Process Data Image needs to be
-     *    updated before sending new data to the bus
+     * @param rentry 
+     *    entry to be compared
      * 
-     * @param pdi 
-     *   reference to the current PDI buffer
+     * @retval true 
+     *    if @p rentry has the same name, type and bitsize as the entry (i.e. entries may 
+     *    differ only with their offsets in the PDI)
+     * @retval false 
+     *    otherwise
+     */
+    inline bool has_layout_of(const Entry &rentry) const;
+
+    /**
+     * @brief Moves the entry to the row of the table that the @p rentry (having the same layout) 
+     *    is stored in
+     * @details This method is called by the Master driver when the ENI is reloaded, so that
+     *    the entry (and so all References to it) survives reconfiguration of the bus. Current
+     *    data of the entry is copied into the new row.
      * 
-     * @note This overload is enabled only for Output entries 
+     * @param rentry 
+     *    entry describing the new layout
+     * @returns 
+     *    @c true if offset of the entry in the PDI has changed
      */
-    template<bool enable = common::translation::is_output_dir_v<dir>,
-        std::enable_if_t<enable, bool> = true>
-    inline void update(config::types::Span<uint8_t> pdi) const;
+    inline bool remap(const Entry &rentry);
 
 private: /* -------------------------------------------------- Private types ------------------------------------------------------ */
 
     /**
-     * @brief Class wrapping a binary-image buffer storing copy of the current content of 
+     * @brief Class referring to the binary-image buffer storing copy of the current content of 
      *    the Entry in the PDI
      */
     class Buffer;
@@ -276,12 +292,12 @@ private: /* --------------------------------------------------- Private data ---
     /// Make referene class a friend to let it access internal buffer
     friend class Pdo;
     
-    /// Name of the PDO
-    std::string name;
-    /// Type descriptor of the entry
-    types::Type type;
+    /// Name of the entry (interned in the pool of the Master)
+    common::utilities::Symbol name;
+    /// Handle of the (interned) type descriptor of the entry
+    types::TypeHandle type;
 
-    /// Binary-image buffer of the entry
+    /// Handle of the binary-image buffer of the entry
     Buffer buffer;
     
 };
@@ -18,6 +18,7 @@
 
 // Private includes
 #include "ethercat/config.hpp"
+#include "ethercat/common/pdi/entry_table.hpp"
 #include "ethercat/slave/pdo/entry.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
@@ -27,8 +28,8 @@ namespace ethercat {
 /* ============================================================= Class ============================================================ */
 
 /**
- * @brief A wrapper class managing byte-image buffer holding copy of current data associated
- *    witht he entry in the Process Data Image (PDI)
+ * @brief A handle of the row of the master-owned EntryTable holding copy of current data 
+ *    associated with the entry in the Process Data Image (PDI)
  * 
  * @tparam ImplementationT 
  *    type implementing hardware-specific part of the Slave driver
@@ -38,17 +39,6 @@ namespace ethercat {
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 class Slave<ImplementationT>::template Pdo<dir>::Entry::Buffer {
-    
-public: /* ----------------------------------------------------- Public data ------------------------------------------------------ */
-
-    // Lock used to synchronise the buffer
-    mutable ethercat::config::types::QuickLock lock;
-
-    // Actual data buffer
-    std::vector<uint8_t> buffer;
-    
-    // Bitsize of the entry
-    std::size_t bitsize;
 
 public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
 
@@ -58,35 +48,23 @@ public: /* ----------------------------------------------------- Public ctors --
     inline Buffer &operator=(const Buffer &rbuffer) = delete;
 
     /// Enable move-construction (to enable storing slave in relocatable containers)
-    inline Buffer(Buffer &&rbuffer);
+    inline Buffer(Buffer &&rbuffer) = default;
     /// Enable move-asignment (to enable storing slave in relocatable containers)
-    inline Buffer &operator=(Buffer &&rbuffer);
+    inline Buffer &operator=(Buffer &&rbuffer) = default;
 
-public: /* ------------------------------------------------ Public helper methods ------------------------------------------------- */
-    
-    /**
-     * @brief Updates buffer from the current Process Data Image @p pdi buffer
-     * 
-     * @param pdi 
-     *   reference to the current PDI buffer
-     * 
-     * @note This overload is enabled only for Input entries 
-     */
-    template<bool enable = common::translation::is_input_dir_v<dir>,
-        std::enable_if_t<enable, bool> = true>
-    inline void update(config::types::Span<const uint8_t> pdi);
+public: /* ---------------------------------------------------- Public getters ---------------------------------------------------- */
 
-    /**
-     * @brief Updates current Process Data Image @p pdi buffer with data stored in the buffer
-     * 
-     * @param pdi 
-     *   reference to the current PDI buffer
-     * 
-     * @note This overload is enabled only for Output entries 
-     */
-    template<bool enable = common::translation::is_output_dir_v<dir>,
-        std::enable_if_t<enable, bool> = true>
-    inline void update(config::types::Span<uint8_t> pdi) const;
+    /// @returns lock used to synchronise the buffer
+    inline config::types::QuickLock &lock() const;
+
+    /// @returns data of the buffer (stored in the arena of the table)
+    inline config::types::Span<uint8_t> data() const;
+
+    /// @returns bitsize of the entry
+    inline std::size_t bitsize() const;
+
+    /// @returns bitoffset of the entry in the Process Data Image
+    inline std::size_t bitoffset() const;
 
 protected: /* ------------------------------------------------ Protected ctors ---------------------------------------------------- */
 
@@ -94,22 +72,24 @@ protected: /* ------------------------------------------------ Protected ctors -
     friend class Entry;
     
     /**
-     * @brief Construct a new Buffer with given parameters
+     * @brief Construct a new Buffer referring to the given row of the table
      * 
-     * @param bitsize 
-     *    bitsize of the entry
-     * @param bitoffset 
-     *    bitoffset of the entry in the PDI image
+     * @param table 
+     *    table holding the entry
+     * @param index 
+     *    row of the entry in the @p table
      */
     inline Buffer(
-        std::size_t bitsize,
-        std::size_t bitoffset
+        common::pdi::EntryTable &table,
+        common::pdi::EntryTable::Index index
     );
     
 private: /* --------------------------------------------------- Private data ------------------------------------------------------ */
 
-    // Bitoffset of the entry in the Process Data Image
-    std::size_t bitoffset;
+    // Table holding the entry
+    common::pdi::EntryTable *table;
+    // Row of the entry in the table
+    common::pdi::EntryTable::Index index;
 
 };
 
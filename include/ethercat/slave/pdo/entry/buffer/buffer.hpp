@@ -17,73 +17,51 @@
 /* =========================================================== Includes =========================================================== */
 
 // Private includes
-#include "ethercat/common/utilities/bit.hpp"
 #include "ethercat/slave/pdo/entry/buffer.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
 
 namespace ethercat {
 
-/* ================================================ Public EtherCAT common methods ================================================ */
+/* ======================================================== Public getters ======================================================== */
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
-Slave<ImplementationT>::template Pdo<dir>::Entry::Buffer::Buffer(Buffer &&rbuffer) :
-    buffer{ std::move(rbuffer.buffer) },
-    bitsize{ std::move(rbuffer.bitsize) },
-    bitoffset{ std::move(rbuffer.bitoffset) }
-{ }
+config::types::QuickLock &Slave<ImplementationT>::template Pdo<dir>::Entry::Buffer::lock() const {
+    return table->get_lock(index);
+}
 
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
-typename Slave<ImplementationT>::template Pdo<dir>::Entry::Buffer &
-Slave<ImplementationT>::template Pdo<dir>::Entry::Buffer::operator=(Buffer &&rbuffer) {
-    buffer    = std::move(rbuffer.buffer);
-    bitsize   = std::move(rbuffer.bitsize);
-    bitoffset = std::move(rbuffer.bitoffset);
-    return *this;
+config::types::Span<uint8_t> Slave<ImplementationT>::template Pdo<dir>::Entry::Buffer::data() const {
+    return table->get_data(index);
 }
 
-/* ===================================================== Public helper methods ==================================================== */
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
-template<bool enable,
-    std::enable_if_t<enable, bool>>
-void Slave<ImplementationT>::template Pdo<dir>::Entry::Entry::Buffer::update(config::types::Span<uint8_t> pdi) const {
-    std::scoped_lock guard{ lock };
-    common::utilities::bit::copy_bits_to_bitshifted(buffer.data(), pdi.data(), bitsize, bitoffset);
+std::size_t Slave<ImplementationT>::template Pdo<dir>::Entry::Buffer::bitsize() const {
+    return table->get_bitsize(index);
 }
 
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
-template<bool enable,
-    std::enable_if_t<enable, bool>>
-void Slave<ImplementationT>::template Pdo<dir>::Entry::Entry::Buffer::update(config::types::Span<const uint8_t> pdi) {
-    std::scoped_lock guard{ lock };
-    common::utilities::bit::copy_bits_from_bitshifted(pdi.data(), buffer.data(), bitsize, bitoffset);
+std::size_t Slave<ImplementationT>::template Pdo<dir>::Entry::Buffer::bitoffset() const {
+    return table->get_bitoffset(index);
 }
 
 /* ======================================================== Protected ctors ======================================================= */
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
-Slave<ImplementationT>::template Pdo<dir>::Entry::Entry::Buffer::Buffer(
-    std::size_t bitsize,
-    std::size_t bitoffset
+Slave<ImplementationT>::template Pdo<dir>::Entry::Buffer::Buffer(
+    common::pdi::EntryTable &table,
+    common::pdi::EntryTable::Index index
 ) :
-    // Keep entry parameters
-    bitsize{ bitsize },
-    bitoffset{ bitoffset },
-    // Prepare entry buffer (zero-initialize)
-    buffer(
-        ((bitsize % common::utilities::bit::BITS_IN_BYTE) == 0) ?
-            bitsize / common::utilities::bit::BITS_IN_BYTE :
-            bitsize / common::utilities::bit::BITS_IN_BYTE + 1,
-        static_cast<uint8_t>(0)
-    )
+    table{ &table },
+    index{ index }
 { }
 
 /* ================================================================================================================================ */
@@ -36,7 +36,7 @@ std::string_view Slave<ImplementationT>::template Pdo<dir>::Entry::get_name() co
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 const types::Type &Slave<ImplementationT>::template Pdo<dir>::Entry::get_type() const {
-    return type;
+    return *type;
 }
 
 /* ============================================== Public methods (entry-referencing) ============================================== */
@@ -49,7 +49,7 @@ typename Slave<ImplementationT>::template Pdo<dir>::Entry::template Reference<Tr
 Slave<ImplementationT>::template Pdo<dir>::Entry::get_reference(
     ArgsT&&... args
 ) {
-    return Reference<TranslatorT>{ type, buffer, args... };
+    return Reference<TranslatorT>{ *type, buffer, args... };
 }
 
 
@@ -61,7 +61,7 @@ const typename Slave<ImplementationT>::template Pdo<dir>::Entry::template Refere
 Slave<ImplementationT>::template Pdo<dir>::Entry::get_reference(
     ArgsT&&... args
 ) const {
-    return Reference<TranslatorT>{ type, const_cast<Buffer&>(buffer), args... };
+    return Reference<TranslatorT>{ *type, const_cast<Buffer&>(buffer), args... };
 }
 
 
@@ -73,7 +73,7 @@ typename Slave<ImplementationT>::template Pdo<dir>::Entry::template Reference<Tr
 Slave<ImplementationT>::template Pdo<dir>::Entry::get_reference(
     ArgsT&&... args
 ) {
-    return Reference<TranslatorT, T>{ type, buffer, args... };
+    return Reference<TranslatorT, T>{ *type, buffer, args... };
 }
 
 
@@ -85,7 +85,7 @@ const typename Slave<ImplementationT>::template Pdo<dir>::Entry::template Refere
 Slave<ImplementationT>::template Pdo<dir>::Entry::get_reference(
     ArgsT&&... args
 ) const {
-    return Reference<TranslatorT, T>{ type, const_cast<Buffer&>(buffer), args... };
+    return Reference<TranslatorT, T>{ *type, const_cast<Buffer&>(buffer), args... };
 }
 
 
@@ -95,7 +95,7 @@ template<typename T,
     slave::traits::enable_if_default_translatable_t<T>>
 typename Slave<ImplementationT>::template Pdo<dir>::Entry::template DefaultTranslatedReference<T>
 Slave<ImplementationT>::template Pdo<dir>::Entry::get_reference() {
-    return DefaultTranslatedReference<T>{ type, buffer };
+    return DefaultTranslatedReference<T>{ *type, buffer };
 }
 
 
@@ -105,7 +105,7 @@ template<typename T,
     slave::traits::enable_if_default_translatable_t<T>>
 const typename Slave<ImplementationT>::template Pdo<dir>::Entry::template DefaultTranslatedReference<T>
 Slave<ImplementationT>::template Pdo<dir>::Entry::get_reference() const {
-    return DefaultTranslatedReference<T>{ type, const_cast<Buffer&>(buffer) };
+    return DefaultTranslatedReference<T>{ *type, const_cast<Buffer&>(buffer) };
 }
 
 
@@ -115,7 +115,7 @@ template<types::BuiltinType::ID type_id, std::size_t arity,
     slave::traits::enable_if_builtin_default_translatable_t<type_id, arity>>
 typename Slave<ImplementationT>::template Pdo<dir>::Entry::template BuiltinDefaultTranslatedReference<type_id, arity>
 Slave<ImplementationT>::template Pdo<dir>::Entry::get_reference() {
-    return BuiltinDefaultTranslatedReference<type_id, arity>{ type, buffer };
+    return BuiltinDefaultTranslatedReference<type_id, arity>{ *type, buffer };
 }
 
 
@@ -125,7 +125,7 @@ template<types::BuiltinType::ID type_id, std::size_t arity,
     slave::traits::enable_if_builtin_default_translatable_t<type_id, arity>>
 const typename Slave<ImplementationT>::template Pdo<dir>::Entry::template BuiltinDefaultTranslatedReference<type_id, arity>
 Slave<ImplementationT>::template Pdo<dir>::Entry::get_reference() const {
-    return BuiltinDefaultTranslatedReference<type_id, arity>{ type, const_cast<Buffer&>(buffer) };
+    return BuiltinDefaultTranslatedReference<type_id, arity>{ *type, const_cast<Buffer&>(buffer) };
 }
 
 
@@ -160,19 +160,21 @@ template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 Slave<ImplementationT>::template Pdo<dir>::Entry::Entry(
     eni::Slave::Pdo::Entry entry_description,
-    eni::ProcessImage::Variable pdi_variable
+    eni::ProcessImage::Variable pdi_variable,
+    common::utilities::StringPool &names,
+    common::pdi::EntryTable &table
 ) :
-    name{ entry_description.get_name() },
-    type{ entry_description.get_data_type() },
-    buffer{ pdi_variable.get_bit_size() , pdi_variable.get_bit_offset() }
+    name{ names.intern(entry_description.get_name()) },
+    type{ types::TypeRegistry::intern(entry_description.get_data_type()) },
+    buffer{ table, table.add(pdi_variable.get_bit_offset(), pdi_variable.get_bit_size()) }
 {
     // Check if data types match
-    if(entry_description.get_data_type() != pdi_variable.get_data_type()) {
+    if(*type != pdi_variable.get_data_type()) {
 
         std::stringstream ss;
         ss << "[ethercat::Slave::Pdo::Entry::Entry] PDO Entry "
             << "'" << entry_description.get_name() << "' "
-            << "has different type in <Slave> description (" << entry_description.get_data_type().get_name() << ")' "
+            << "has different type in <Slave> description (" << type->get_name() << ")' "
             << "and in <ProcessImage> description (" << pdi_variable.get_data_type().get_name() << ")";
         throw eni::Error{ ss.str() };
 
@@ -219,19 +221,32 @@ Slave<ImplementationT>::template Pdo<dir>::Entry::Entry(
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
-template<bool enable,
-    std::enable_if_t<enable, bool>>
-void Slave<ImplementationT>::template Pdo<dir>::Entry::Entry::update(config::types::Span<const uint8_t> pdi) {
-    buffer.update(pdi);
+void Slave<ImplementationT>::template Pdo<dir>::Entry::relocate(common::pdi::EntryTable &table, std::size_t owner) {
+    buffer = Buffer{ table, table.add(*buffer.table, buffer.index, owner) };
 }
 
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
-template<bool enable,
-    std::enable_if_t<enable, bool>>
-void Slave<ImplementationT>::template Pdo<dir>::Entry::Entry::update(config::types::Span<uint8_t> pdi) const {
-    buffer.update(pdi);
+bool Slave<ImplementationT>::template Pdo<dir>::Entry::has_layout_of(const Entry &rentry) const {
+    return (name == rentry.name) and (type == rentry.type) and (buffer.bitsize() == rentry.buffer.bitsize());
+}
+
+
+template<typename ImplementationT>
+template<typename Slave<ImplementationT>::PdoDirection dir>
+bool Slave<ImplementationT>::template Pdo<dir>::Entry::remap(const Entry &rentry) {
+
+    // Check whether offset of the entry changed
+    bool moved = (buffer.bitoffset() != rentry.buffer.bitoffset());
+
+    // Carry current data of the entry over to the new row
+    rentry.buffer.table->copy_data(rentry.buffer.index, *buffer.table, buffer.index);
+
+    buffer.table = rentry.buffer.table;
+    buffer.index = rentry.buffer.index;
+
+    return moved;
 }
 
 /* ================================================================================================================================ */
@@ -32,9 +32,9 @@ template<bool enable,
     std::enable_if_t<enable, bool>>
 typename Slave<ImplementationT>::template Pdo<dir>::Entry::template Reference<TranslatorT, T>::Type 
 Slave<ImplementationT>::template Pdo<dir>::Entry::template Reference<TranslatorT, T>::get() const {
-    std::scoped_lock guard{ buffer->lock };
+    std::scoped_lock guard{ buffer->lock() };
     Type object;
-    WrapperType::translate_to(buffer->buffer, object);
+    WrapperType::translate_to(buffer->data(), object);
     return object;
 }
 
@@ -45,8 +45,8 @@ template<typename TranslatorT, typename T>
 template<bool enable, 
     std::enable_if_t<enable, bool>>
 void Slave<ImplementationT>::template Pdo<dir>::Entry::template Reference<TranslatorT, T>::get(Type &object) const {
-    std::scoped_lock guard{ buffer->lock };
-    WrapperType::translate_to(buffer->buffer, object);
+    std::scoped_lock guard{ buffer->lock() };
+    WrapperType::translate_to(buffer->data(), object);
 }
 
 
@@ -56,8 +56,8 @@ template<typename TranslatorT, typename T>
 template<bool enable, 
     std::enable_if_t<enable, bool>>
 void Slave<ImplementationT>::template Pdo<dir>::Entry::template Reference<TranslatorT, T>::set(ArgType object) {
-    std::scoped_lock guard{ buffer->lock };
-    WrapperType::translate_from(buffer->buffer, object);
+    std::scoped_lock guard{ buffer->lock() };
+    WrapperType::translate_from(buffer->data(), object);
 }
 
 /* ======================================================== Protected ctors ======================================================= */
@@ -51,11 +51,7 @@ Slave<ImplementationT>::template Pdo<dir>::get_entries() const {
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 bool Slave<ImplementationT>::template Pdo<dir>::has_entry(std::string_view name) const {
-    return (entries.end() != 
-        std::find_if(entries.begin(), entries.end(),
-            [&name](const auto &entry){ return (entry.get_name() == name); }
-        )
-    );
+    return (entries.end() != const_cast<Pdo*>(this)->find_entry(name));
 }
 
 
@@ -65,9 +61,7 @@ typename Slave<ImplementationT>::template Pdo<dir>::Entry &
 Slave<ImplementationT>::template Pdo<dir>::get_entry(std::string_view name) {
 
     // Try to find the entry
-    auto entry = std::find_if(entries.begin(), entries.end(),
-        [&name](const auto &entry){ return (entry.get_name() == name); }
-    );
+    auto entry = find_entry(name);
 
     // If not found, throw
     if(entry == entries.end()) {
@@ -96,9 +90,12 @@ template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 Slave<ImplementationT>::template Pdo<dir>::Pdo(
     eni::Slave::Pdo pdo_description,
-    const eni::ProcessImage::VariablesList &pdi_variables
+    const eni::ProcessImage::VariablesList &pdi_variables,
+    common::utilities::StringPool &names,
+    common::pdi::EntryTable &table
 ) :
-    name{ pdo_description.get_name() }
+    names{ &names },
+    name{ names.intern(pdo_description.get_name()) }
 {
     // Reserve memory for entries
     entries.reserve(pdo_description.get_entries().size());
@@ -119,9 +116,65 @@ Slave<ImplementationT>::template Pdo<dir>::Pdo(
         }
 
         // Construct a new Entry
-        entries.emplace_back(Entry{ entry_description, *variable_description });
+        entries.emplace_back(Entry{ entry_description, *variable_description, names, table });
+
+    }
+}
+
+/* ======================================================== Private methods ======================================================= */
+
+template<typename ImplementationT>
+template<typename Slave<ImplementationT>::PdoDirection dir>
+typename std::vector<typename Slave<ImplementationT>::template Pdo<dir>::Entry>::iterator
+Slave<ImplementationT>::template Pdo<dir>::find_entry(std::string_view name) {
+
+    // If name has not been interned, no entry can be named so
+    auto symbol = names->find(name);
+    return symbol.has_value() ? find_entry(*symbol) : entries.end();
+}
+
+
+template<typename ImplementationT>
+template<typename Slave<ImplementationT>::PdoDirection dir>
+typename std::vector<typename Slave<ImplementationT>::template Pdo<dir>::Entry>::iterator
+Slave<ImplementationT>::template Pdo<dir>::find_entry(common::utilities::Symbol name) {
+    return std::find_if(entries.begin(), entries.end(),
+        [name](const auto &entry){ return (entry.name == name); }
+    );
+}
+
+
+template<typename ImplementationT>
+template<typename Slave<ImplementationT>::PdoDirection dir>
+bool Slave<ImplementationT>::template Pdo<dir>::has_layout_of(const Pdo &rpdo) const {
+
+    // Compare names and numbers of entries
+    if(name != rpdo.name or entries.size() != rpdo.entries.size())
+        return false;
+
+    // Compare subsequent entries
+    for(std::size_t i = 0; i < entries.size(); ++i) {
+        if(not entries[i].has_layout_of(rpdo.entries[i]))
+            return false;
+    }
 
+    return true;
+}
+
+
+template<typename ImplementationT>
+template<typename Slave<ImplementationT>::PdoDirection dir>
+std::size_t Slave<ImplementationT>::template Pdo<dir>::remap(const Pdo &rpdo) {
+
+    std::size_t ret = 0;
+
+    // Move subsequent entries
+    for(std::size_t i = 0; i < entries.size(); ++i) {
+        if(entries[i].remap(rpdo.entries[i]))
+            ++ret;
     }
+
+    return ret;
 }
 
 /* ================================================================================================================================ */
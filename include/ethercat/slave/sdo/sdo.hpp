@@ -67,13 +67,15 @@ void Slave<ImplementationT>::template Sdo<dir, TranslatorT, T, enabler>::downloa
         // Translate object into the binary image
         WrapperType::translate_from(buffer, object);
         // Perform I/O
-        slave->download_sdo(
-            address.index,
-            address.subindex,
-            config::types::Span<const uint8_t>{ buffer },
-            timeout,
-            (access_type == AccessType::Complete) ? true : false
-        );
+        static_cast<Slave*>(slave)->access_sdo(address.index, address.subindex, SdoDirection::Download, [&]() {
+            slave->download_sdo(
+                address.index,
+                address.subindex,
+                config::types::Span<const uint8_t>{ buffer },
+                timeout,
+                (access_type == AccessType::Complete) ? true : false
+            );
+        });
 
     // Else, if dynamic-sizing method is available
     } else if constexpr(SizingTranslatorTraits::dynamic_sizing::is_available) {
@@ -83,13 +85,15 @@ void Slave<ImplementationT>::template Sdo<dir, TranslatorT, T, enabler>::downloa
         // Translate object into the binary image
         WrapperType::translate_from(buffer, object);
         // Perform I/O
-        slave->download_sdo(
-            address.index,
-            address.subindex,
-            config::types::Span<const uint8_t>{ buffer },
-            timeout,
-            (access_type == AccessType::Complete) ? true : false
-        );
+        static_cast<Slave*>(slave)->access_sdo(address.index, address.subindex, SdoDirection::Download, [&]() {
+            slave->download_sdo(
+                address.index,
+                address.subindex,
+                config::types::Span<const uint8_t>{ buffer },
+                timeout,
+                (access_type == AccessType::Complete) ? true : false
+            );
+        });
 
     // Else, make compillation stop
     } else
@@ -116,13 +120,15 @@ Slave<ImplementationT>::template Sdo<dir, TranslatorT, T, enabler>::upload(
         // Make buffer for binary image of the object
         auto buffer = WrapperType::make_buffer();
         // Perform I/O
-        slave->upload_sdo(
-            address.index,
-            address.subindex,
-            config::types::Span<uint8_t>{ buffer },
-            timeout,
-            (access_type == AccessType::Complete) ? true : false
-        );
+        static_cast<Slave*>(slave)->access_sdo(address.index, address.subindex, SdoDirection::Upload, [&]() {
+            slave->upload_sdo(
+                address.index,
+                address.subindex,
+                config::types::Span<uint8_t>{ buffer },
+                timeout,
+                (access_type == AccessType::Complete) ? true : false
+            );
+        });
         // Translate object into the binary image
         WrapperType::translate_to(buffer, object);
 
@@ -136,13 +142,15 @@ Slave<ImplementationT>::template Sdo<dir, TranslatorT, T, enabler>::upload(
         // Make buffer for binary image of the object
         auto buffer = WrapperType::make_buffer(object);
         // Perform I/O
-        slave->upload_sdo(
-            address.index,
-            address.subindex,
-            config::types::Span<uint8_t>{ buffer },
-            timeout,
-            (access_type == AccessType::Complete) ? true : false
-        );
+        static_cast<Slave*>(slave)->access_sdo(address.index, address.subindex, SdoDirection::Upload, [&]() {
+            slave->upload_sdo(
+                address.index,
+                address.subindex,
+                config::types::Span<uint8_t>{ buffer },
+                timeout,
+                (access_type == AccessType::Complete) ? true : false
+            );
+        });
         // Translate object into the binary image
         WrapperType::translate_to(buffer, object);
 
@@ -171,13 +179,15 @@ void Slave<ImplementationT>::template Sdo<dir, TranslatorT, T, enabler>::upload(
         // Make buffer for binary image of the object
         auto buffer = WrapperType::make_buffer();
         // Perform I/O
-        slave->upload_sdo(
-            address.index,
-            address.subindex,
-            config::types::Span<uint8_t>{ buffer },
-            timeout,
-            (access_type == AccessType::Complete) ? true : false
-        );
+        static_cast<Slave*>(slave)->access_sdo(address.index, address.subindex, SdoDirection::Upload, [&]() {
+            slave->upload_sdo(
+                address.index,
+                address.subindex,
+                config::types::Span<uint8_t>{ buffer },
+                timeout,
+                (access_type == AccessType::Complete) ? true : false
+            );
+        });
         // Translate object into the binary image
         WrapperType::translate_to(buffer, object);
 
@@ -187,13 +197,15 @@ void Slave<ImplementationT>::template Sdo<dir, TranslatorT, T, enabler>::upload(
         // Make buffer for binary image of the object
         auto buffer = WrapperType::make_buffer(object);
         // Perform I/O
-        slave->upload_sdo(
-            address.index,
-            address.subindex,
-            config::types::Span<uint8_t>{ buffer },
-            timeout,
-            (access_type == AccessType::Complete) ? true : false
-        );
+        static_cast<Slave*>(slave)->access_sdo(address.index, address.subindex, SdoDirection::Upload, [&]() {
+            slave->upload_sdo(
+                address.index,
+                address.subindex,
+                config::types::Span<uint8_t>{ buffer },
+                timeout,
+                (access_type == AccessType::Complete) ? true : false
+            );
+        });
         // Translate object into the binary image
         WrapperType::translate_to(buffer, object);
 
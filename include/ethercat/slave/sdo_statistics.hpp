@@ -0,0 +1,224 @@
+/* ============================================================================================================================ *//**
+ * @file       sdo_statistics.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:44:44 am
+ * @modified   Sunday, 18th October 2026 11:44:44 am
+ * @project    ethercat-lib
+ * @brief      Definition of the SdoStatistics nested class of the Slave interface
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_SLAVE_SDO_STATISTICS_H__
+#define __ETHERCAT_SLAVE_SDO_STATISTICS_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <map>
+// Private includes
+#include "ethercat/slave.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat {
+
+/* ======================================================== SDO statistics ======================================================== */
+
+/**
+ * @brief Auxiliary class collecting latency and error statistics of SDO accesses performed
+ *    on the slave
+ * @details Statistics are collected per object (index, subindex) and can be read at runtime.
+ *    Latency of each access is stored in a histogram with logarithmic buckets: bucket @c 0 
+ *    counts accesses shorter than 1us and bucket @c i counts accesses that took [2^(i-1), 2^i) us 
+ *    (the last bucket collects all longer accesses).
+ * 
+ * @note Collection of statistics can be disabled at compile time with 
+ *    @ref config::sdo::CollectStatistics
+ */
+template<typename ImplementationT>
+class Slave<ImplementationT>::SdoStatistics {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Number of buckets of the latency histogram
+    static constexpr std::size_t HistogramBucketsNum = config::sdo::StatisticsHistogramBucketsNum;
+
+    /**
+     * @brief Outcome of the SDO access
+     */
+    enum class Outcome {
+
+        // Access succeeded
+        Success,
+        // Access timed out
+        Timeout,
+        // Access has been aborted (failed for reason other than timeout)
+        Abort
+
+    };
+
+    /**
+     * @brief Statistics of accesses to a single object
+     */
+    struct Record {
+
+        /// Number of succesfull uploads
+        std::size_t uploads { 0 };
+        /// Number of succesfull downloads
+        std::size_t downloads { 0 };
+        /// Number of timed-out accesses
+        std::size_t timeouts { 0 };
+        /// Number of aborted accesses
+        std::size_t aborts { 0 };
+        /// Number of retries reported by the implementation
+        std::size_t retries { 0 };
+
+        /// Summary latency of all accesses
+        std::chrono::microseconds total_latency { 0 };
+        /// Maximal latency of the access
+        std::chrono::microseconds max_latency { 0 };
+        /// Latency histogram
+        std::array<std::size_t, HistogramBucketsNum> histogram { };
+
+        /**
+         * @returns 
+         *    total number of accesses
+         */
+        inline std::size_t get_accesses_num() const;
+
+        /**
+         * @returns 
+         *    mean latency of accesses (zero if no accesses has been recorded)
+         */
+        inline std::chrono::microseconds get_mean_latency() const;
+
+        /**
+         * @param quantile 
+         *    quantile to be estimated (in range [0, 1])
+         * @returns 
+         *    upper bound of the histogram bucket containing given @p quantile of latencies
+         */
+        inline std::chrono::microseconds get_latency_quantile(double quantile) const;
+
+        /**
+         * @brief Accumulates statistics of the @p record into @p this one
+         */
+        inline Record &operator+=(const Record &record);
+
+    };
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Default constructor
+    inline SdoStatistics() = default;
+
+    /// Enable copy-construction
+    inline SdoStatistics(const SdoStatistics &rstats);
+    /// Enable copy-asignment
+    inline SdoStatistics &operator=(const SdoStatistics &rstats);
+
+    /// Enable move-construction
+    inline SdoStatistics(SdoStatistics &&rstats);
+    /// Enable move-asignment
+    inline SdoStatistics &operator=(SdoStatistics &&rstats);
+
+public: /* ---------------------------------------------------- Public methods ---------------------------------------------------- */
+
+    /**
+     * @brief Records a single SDO access
+     * 
+     * @param index 
+     *    index of the object
+     * @param subindex 
+     *    subindex of the object
+     * @param dir 
+     *    direction of the access ( Upload or Download )
+     * @param latency 
+     *    latency of the access
+     * @param outcome 
+     *    outcome of the access
+     */
+    inline void record(
+        uint16_t index,
+        uint16_t subindex,
+        SdoDirection dir,
+        std::chrono::microseconds latency,
+        Outcome outcome
+    );
+
+    /**
+     * @brief Records retry of the SDO access (intended to be called by the implementation
+     *    performing retries on its own)
+     * 
+     * @param index 
+     *    index of the object
+     * @param subindex 
+     *    subindex of the object
+     */
+    inline void record_retry(uint16_t index, uint16_t subindex);
+
+    /**
+     * @brief Clears all collected statistics
+     */
+    inline void reset();
+
+public: /* ---------------------------------------------------- Public getters ---------------------------------------------------- */
+
+    /**
+     * @returns 
+     *    list of (index, subindex) pairs of objects that statistics has been collected for
+     */
+    inline std::vector<std::pair<uint16_t, uint16_t>> list_objects() const;
+
+    /**
+     * @param index 
+     *    index of the object
+     * @param subindex 
+     *    subindex of the object
+     * @returns 
+     *    copy of statistics collected for the given object
+     * 
+     * @throws std::out_of_range
+     *    if no statistics has been collected for the object
+     */
+    inline Record get(uint16_t index, uint16_t subindex) const;
+
+    /**
+     * @returns 
+     *    statistics accumulated over all objects
+     */
+    inline Record get_total() const;
+
+private: /* --------------------------------------------------- Private methods --------------------------------------------------- */
+
+    /**
+     * @returns 
+     *    key of the object in the records map
+     */
+    static constexpr uint32_t make_key(uint16_t index, uint16_t subindex);
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Synchronisation lock (critical sections are short - record's update or copy)
+    mutable config::types::QuickLock lock;
+
+    /// Statistics of subsequent objects
+    std::map<uint32_t, Record> records;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/slave/sdo_statistics/sdo_statistics.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
@@ -0,0 +1,229 @@
+/* ============================================================================================================================ *//**
+ * @file       sdo_statistics.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:44:44 am
+ * @modified   Sunday, 18th October 2026 11:44:44 am
+ * @project    ethercat-lib
+ * @brief      Definition of methods of the SdoStatistics nested class of the Slave interface
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_SLAVE_SDO_STATISTICS_SDO_STATISTICS_H__
+#define __ETHERCAT_SLAVE_SDO_STATISTICS_SDO_STATISTICS_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <bit>
+#include <mutex>
+#include <stdexcept>
+// Private includes
+#include "ethercat/slave/sdo_statistics.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat {
+
+/* ============================================================ Record ============================================================ */
+
+template<typename ImplementationT>
+std::size_t Slave<ImplementationT>::SdoStatistics::Record::get_accesses_num() const {
+    return uploads + downloads + timeouts + aborts;
+}
+
+
+template<typename ImplementationT>
+std::chrono::microseconds Slave<ImplementationT>::SdoStatistics::Record::get_mean_latency() const {
+    auto accesses_num = get_accesses_num();
+    return (accesses_num == 0) ? std::chrono::microseconds{ 0 } : (total_latency / accesses_num);
+}
+
+
+template<typename ImplementationT>
+std::chrono::microseconds Slave<ImplementationT>::SdoStatistics::Record::get_latency_quantile(double quantile) const {
+
+    auto accesses_num = get_accesses_num();
+
+    // Number of accesses that the quantile covers
+    auto threshold = static_cast<std::size_t>(quantile * accesses_num);
+
+    // Find bucket containing the quantile
+    std::size_t accumulated = 0;
+    for(std::size_t i = 0; i < HistogramBucketsNum; ++i) {
+        accumulated += histogram[i];
+        if(accumulated > threshold or accumulated == accesses_num)
+            return std::chrono::microseconds{ std::size_t(1) << i };
+    }
+
+    return std::chrono::microseconds{ 0 };
+}
+
+
+template<typename ImplementationT>
+typename Slave<ImplementationT>::SdoStatistics::Record &
+Slave<ImplementationT>::SdoStatistics::Record::operator+=(const Record &record) {
+
+    uploads       += record.uploads;
+    downloads     += record.downloads;
+    timeouts      += record.timeouts;
+    aborts        += record.aborts;
+    retries       += record.retries;
+    total_latency += record.total_latency;
+    max_latency    = std::max(max_latency, record.max_latency);
+    for(std::size_t i = 0; i < HistogramBucketsNum; ++i)
+        histogram[i] += record.histogram[i];
+
+    return *this;
+}
+
+/* ========================================================= Public ctors ========================================================= */
+
+template<typename ImplementationT>
+Slave<ImplementationT>::SdoStatistics::SdoStatistics(const SdoStatistics &rstats) {
+    std::lock_guard guard{ rstats.lock };
+    records = rstats.records;
+}
+
+
+template<typename ImplementationT>
+typename Slave<ImplementationT>::SdoStatistics &
+Slave<ImplementationT>::SdoStatistics::operator=(const SdoStatistics &rstats) {
+    if(this != &rstats) {
+        std::scoped_lock guard{ lock, rstats.lock };
+        records = rstats.records;
+    }
+    return *this;
+}
+
+
+template<typename ImplementationT>
+Slave<ImplementationT>::SdoStatistics::SdoStatistics(SdoStatistics &&rstats) {
+    std::lock_guard guard{ rstats.lock };
+    records = std::move(rstats.records);
+}
+
+
+template<typename ImplementationT>
+typename Slave<ImplementationT>::SdoStatistics &
+Slave<ImplementationT>::SdoStatistics::operator=(SdoStatistics &&rstats) {
+    if(this != &rstats) {
+        std::scoped_lock guard{ lock, rstats.lock };
+        records = std::move(rstats.records);
+    }
+    return *this;
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename ImplementationT>
+void Slave<ImplementationT>::SdoStatistics::record(
+    uint16_t index,
+    uint16_t subindex,
+    SdoDirection dir,
+    std::chrono::microseconds latency,
+    Outcome outcome
+) {
+    // Calculate histogram's bucket (bit width of the latency in microseconds)
+    auto bucket = std::min<std::size_t>(
+        std::bit_width(static_cast<uint64_t>(std::max<std::chrono::microseconds::rep>(latency.count(), 0))),
+        HistogramBucketsNum - 1
+    );
+
+    std::lock_guard guard{ lock };
+
+    auto &record = records[make_key(index, subindex)];
+
+    // Update counters
+    switch(outcome) {
+        case Outcome::Success: ((dir == SdoDirection::Upload) ? record.uploads : record.downloads) += 1; break;
+        case Outcome::Timeout: record.timeouts += 1;                                                     break;
+        case Outcome::Abort:   record.aborts   += 1;                                                     break;
+    }
+
+    // Update latency statistics
+    record.total_latency += latency;
+    record.max_latency    = std::max(record.max_latency, latency);
+    record.histogram[bucket] += 1;
+}
+
+
+template<typename ImplementationT>
+void Slave<ImplementationT>::SdoStatistics::record_retry(uint16_t index, uint16_t subindex) {
+    std::lock_guard guard{ lock };
+    records[make_key(index, subindex)].retries += 1;
+}
+
+
+template<typename ImplementationT>
+void Slave<ImplementationT>::SdoStatistics::reset() {
+    std::lock_guard guard{ lock };
+    records.clear();
+}
+
+/* ======================================================== Public getters ======================================================== */
+
+template<typename ImplementationT>
+std::vector<std::pair<uint16_t, uint16_t>> Slave<ImplementationT>::SdoStatistics::list_objects() const {
+
+    std::vector<std::pair<uint16_t, uint16_t>> ret;
+
+    std::lock_guard guard{ lock };
+
+    // Decode addresses of recorded objects
+    ret.reserve(records.size());
+    for(auto &[key, record] : records)
+        ret.emplace_back(static_cast<uint16_t>(key >> 16), static_cast<uint16_t>(key & 0xFFFF));
+
+    return ret;
+}
+
+
+template<typename ImplementationT>
+typename Slave<ImplementationT>::SdoStatistics::Record 
+Slave<ImplementationT>::SdoStatistics::get(uint16_t index, uint16_t subindex) const {
+
+    std::lock_guard guard{ lock };
+
+    // Find the record
+    auto it = records.find(make_key(index, subindex));
+    if(it == records.end()) {
+        throw std::out_of_range{ 
+            "[ethercat::Slave::SdoStatistics::get] No statistics collected for object " 
+            + std::to_string(index) + ":" + std::to_string(subindex) 
+        };
+    }
+
+    return it->second;
+}
+
+
+template<typename ImplementationT>
+typename Slave<ImplementationT>::SdoStatistics::Record 
+Slave<ImplementationT>::SdoStatistics::get_total() const {
+
+    Record ret;
+
+    std::lock_guard guard{ lock };
+
+    // Accumulate all records
+    for(auto &[key, record] : records)
+        ret += record;
+
+    return ret;
+}
+
+/* ======================================================== Private methods ======================================================= */
+
+template<typename ImplementationT>
+constexpr uint32_t Slave<ImplementationT>::SdoStatistics::make_key(uint16_t index, uint16_t subindex) {
+    return (static_cast<uint32_t>(index) << 16) | subindex;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat
+
+#endif
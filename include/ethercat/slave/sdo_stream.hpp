@@ -0,0 +1,249 @@
+/* ============================================================================================================================ *//**
+ * @file       sdo_stream.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:34:21 am
+ * @modified   Sunday, 18th October 2026 11:34:21 am
+ * @project    ethercat-lib
+ * @brief      Definition of the SdoStream nested class of the Slave interface
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_SLAVE_SDO_STREAM_H__
+#define __ETHERCAT_SLAVE_SDO_STREAM_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <istream>
+#include <ostream>
+#include <type_traits>
+// Private includes
+#include "ethercat/slave.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat {
+
+/* ========================================================== SDO stream ========================================================== */
+
+/**
+ * @brief A proxy class providing an interface for streaming (segmented) upload and download 
+ *    of large Service Data Objects (SDO) from/to memory of the slave device
+ * @details Unlike @ref Sdo , the SdoStream does not translate objects into app-domain entities
+ *    and never stores the whole binary image of the object in memory. Data is passed to/from
+ *    the user code in chunks of at most @a chunk_size bytes as they are transferred over the 
+ *    mailbox. Buffers used to store segments are owned by the implementation so that it is 
+ *    free to pipeline mailbox exchanges (e.g. request the next segment while the user code 
+ *    processes the current one).
+ * 
+ * @tparam ImplementationT 
+ *    type implementing hardware-specific part of the Slave driver
+ * 
+ * @note SdoStream class must have access to implementation of segmented SDO communication 
+ *    methods ( @a upload_sdo_segmented(...) and @a download_sdo_segmented(...) ). For this reason
+ *    class deriving from @ref Slave shall make SdoStream class a friend. These methods are 
+ *    required only if the streaming interface is actually used.
+ */
+template<typename ImplementationT>
+class Slave<ImplementationT>::SdoStream {
+
+public: /* ---------------------------------------------------- Public types ------------------------------------------------------ */
+
+    /// Type of the associated slave
+    using SlaveT = ImplementationT;
+
+    /**
+     * @brief Structure describing address of the object in the Objects Dictionary of the
+     *    slave device
+     */
+    struct Address {
+
+        /// Index of the object
+        uint16_t index;
+        /// Subindex of the object
+        uint16_t subindex { 0 };
+
+    };
+
+    /**
+     * @brief Type of the CoE access to be performed
+     */
+    enum class AccessType { 
+
+        // Complete access (access all subitems with indeces starting from the given one)
+        Complete,
+        // Limited access (access only a subitem with the given subindex)
+        Limited
+        
+    };
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    /// Enable copy-construction
+    inline SdoStream(const SdoStream &rsdo) = default;
+    /// Enable copy-asignment
+    inline SdoStream &operator=(const SdoStream &rsdo) = default;
+
+    /// Enable move-construction
+    inline SdoStream(SdoStream &&rsdo) = default;
+    /// Enable move-asignment
+    inline SdoStream &operator=(SdoStream &&rsdo) = default;
+
+public: /* --------------------------------------------------- Public methods ----------------------------------------------------- */
+
+    /**
+     * @returns 
+     *    address of the SDO
+     */
+    inline Address get_address() const;
+
+    /**
+     * @returns 
+     *    maximal size of the chunk passed to/from the user code at once
+     */
+    inline std::size_t get_chunk_size() const;
+
+public: /* ------------------------------------------------- Public I/O methods --------------------------------------------------- */
+
+    /**
+     * @brief Uploads the object from the slave's memory passing subsequent chunks of data
+     *    to the @p consumer as they arrive
+     * 
+     * @param consumer 
+     *    functor consuming subsequent chunks of data (see @ref SdoChunkConsumer )
+     * @param timeout 
+     *    I/O timeout of a single segment's exchange
+     * @param access_type 
+     *    type of the access
+     * @returns 
+     *    number of bytes passed to the @p consumer
+     * 
+     * @throws error 
+     *    whatever error thrown by implementation or by the @p consumer
+     * 
+     * @note This overload is enabled only if @p ConsumerT is compatible with @ref SdoChunkConsumer
+     */
+    template<typename ConsumerT,
+        std::enable_if_t<std::is_invocable_r_v<bool, ConsumerT, config::types::Span<const uint8_t>, std::size_t>, bool> = true>
+    std::size_t upload(
+        ConsumerT &&consumer,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds{ 1000 },
+        AccessType access_type = AccessType::Limited
+    );
+
+    /**
+     * @brief Uploads the object from the slave's memory into the given @p stream
+     * 
+     * @param stream 
+     *    stream that the data is written to
+     * @param timeout 
+     *    I/O timeout of a single segment's exchange
+     * @param access_type 
+     *    type of the access
+     * @returns 
+     *    number of bytes written into the @p stream
+     * 
+     * @throws std::ios_base::failure
+     *    if writing to the @p stream fails
+     * @throws error 
+     *    whatever error thrown by implementation
+     */
+    inline std::size_t upload(
+        std::ostream &stream,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds{ 1000 },
+        AccessType access_type = AccessType::Limited
+    );
+
+    /**
+     * @brief Downloads the object of the given @p size to the slave's memory requesting 
+     *    subsequent chunks of data from the @p producer as they are sent
+     * 
+     * @param size 
+     *    total size of the object
+     * @param producer 
+     *    functor producing subsequent chunks of data (see @ref SdoChunkProducer )
+     * @param timeout 
+     *    I/O timeout of a single segment's exchange
+     * @param access_type 
+     *    type of the access
+     * 
+     * @throws error 
+     *    whatever error thrown by implementation or by the @p producer
+     * 
+     * @note This overload is enabled only if @p ProducerT is compatible with @ref SdoChunkProducer
+     */
+    template<typename ProducerT,
+        std::enable_if_t<std::is_invocable_r_v<bool, ProducerT, config::types::Span<uint8_t>>, bool> = true>
+    void download(
+        std::size_t size,
+        ProducerT &&producer,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds{ 1000 },
+        AccessType access_type = AccessType::Limited
+    );
+
+    /**
+     * @brief Downloads @p size bytes read from the @p stream to the slave's memory
+     * 
+     * @param stream 
+     *    stream that the data is read from
+     * @param size 
+     *    total size of the object
+     * @param timeout 
+     *    I/O timeout of a single segment's exchange
+     * @param access_type 
+     *    type of the access
+     * 
+     * @throws std::ios_base::failure
+     *    if less than @p size bytes could be read from the @p stream 
+     * @throws error 
+     *    whatever error thrown by implementation
+     */
+    inline void download(
+        std::istream &stream,
+        std::size_t size,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds{ 1000 },
+        AccessType access_type = AccessType::Limited
+    );
+
+protected: /* --------------------------------------------- Protected ctors & dtors ----------------------------------------------- */
+    
+    /// Make Slave a friend to let it access constructor
+    friend class Slave<SlaveT>;
+
+    /**
+     * @brief Construct a new SDO stream object
+     * 
+     * @param slave 
+     *    pointer to the associated slave interface
+     * @param address
+     *    address of the SDO
+     * @param chunk_size
+     *    maximal size of the chunk passed to/from the user code at once
+     */
+    inline SdoStream(SlaveT *slave, Address address, std::size_t chunk_size);
+    
+private: /* --------------------------------------------------- Private data ------------------------------------------------------ */
+
+    /// Reference to the Slave interface
+    SlaveT *slave;
+    /// Address of the SDO
+    Address address;
+    /// Maximal size of the chunk
+    std::size_t chunk_size;
+    
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/slave/sdo_stream/sdo_stream.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
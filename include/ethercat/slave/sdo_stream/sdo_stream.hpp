@@ -0,0 +1,158 @@
+/* ============================================================================================================================ *//**
+ * @file       sdo_stream.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:34:21 am
+ * @modified   Sunday, 18th October 2026 11:44:44 am
+ * @project    ethercat-lib
+ * @brief      Definition of methods of the SdoStream nested class of the Slave interface
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_SLAVE_SDO_STREAM_SDO_STREAM_H__
+#define __ETHERCAT_SLAVE_SDO_STREAM_SDO_STREAM_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Private includes
+#include "ethercat/slave/sdo_stream.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat {
+
+/* ======================================================== Public methods ======================================================== */
+
+template<typename ImplementationT>
+typename Slave<ImplementationT>::SdoStream::Address 
+Slave<ImplementationT>::SdoStream::get_address() const {
+    return address;
+}
+
+
+template<typename ImplementationT>
+std::size_t Slave<ImplementationT>::SdoStream::get_chunk_size() const {
+    return chunk_size;
+}
+
+/* ====================================================== Public I/O methods ====================================================== */
+
+template<typename ImplementationT>
+template<typename ConsumerT,
+    std::enable_if_t<std::is_invocable_r_v<bool, ConsumerT, config::types::Span<const uint8_t>, std::size_t>, bool>>
+std::size_t Slave<ImplementationT>::SdoStream::upload(
+    ConsumerT &&consumer,
+    std::chrono::milliseconds timeout,
+    AccessType access_type
+) {
+    std::size_t transferred = 0;
+
+    // Perform I/O counting transferred bytes
+    static_cast<Slave*>(slave)->access_sdo(address.index, address.subindex, SdoDirection::Upload, [&]() {
+        slave->upload_sdo_segmented(
+            address.index,
+            address.subindex,
+            chunk_size,
+            SdoChunkConsumer{ [&consumer, &transferred](config::types::Span<const uint8_t> chunk, std::size_t total_size) {
+                transferred += chunk.size();
+                return consumer(chunk, total_size);
+            } },
+            timeout,
+            (access_type == AccessType::Complete) ? true : false
+        );
+    });
+
+    return transferred;
+}
+
+
+template<typename ImplementationT>
+std::size_t Slave<ImplementationT>::SdoStream::upload(
+    std::ostream &stream,
+    std::chrono::milliseconds timeout,
+    AccessType access_type
+) {
+    return upload(
+        [&stream](config::types::Span<const uint8_t> chunk, std::size_t) {
+
+            // Write chunk to the stream
+            stream.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+            // On failure, throw
+            if(not stream.good())
+                throw std::ios_base::failure{ "[ethercat::Slave::SdoStream::upload] Failed to write data to the stream" };
+
+            return true;
+        },
+        timeout,
+        access_type
+    );
+}
+
+
+template<typename ImplementationT>
+template<typename ProducerT,
+    std::enable_if_t<std::is_invocable_r_v<bool, ProducerT, config::types::Span<uint8_t>>, bool>>
+void Slave<ImplementationT>::SdoStream::download(
+    std::size_t size,
+    ProducerT &&producer,
+    std::chrono::milliseconds timeout,
+    AccessType access_type
+) {
+    static_cast<Slave*>(slave)->access_sdo(address.index, address.subindex, SdoDirection::Download, [&]() {
+        slave->download_sdo_segmented(
+            address.index,
+            address.subindex,
+            size,
+            chunk_size,
+            SdoChunkProducer{ std::forward<ProducerT>(producer) },
+            timeout,
+            (access_type == AccessType::Complete) ? true : false
+        );
+    });
+}
+
+
+template<typename ImplementationT>
+void Slave<ImplementationT>::SdoStream::download(
+    std::istream &stream,
+    std::size_t size,
+    std::chrono::milliseconds timeout,
+    AccessType access_type
+) {
+    download(
+        size,
+        [&stream](config::types::Span<uint8_t> chunk) {
+
+            // Read chunk from the stream
+            stream.read(reinterpret_cast<char*>(chunk.data()), chunk.size());
+            // On failure, throw
+            if(static_cast<std::size_t>(stream.gcount()) != chunk.size())
+                throw std::ios_base::failure{ "[ethercat::Slave::SdoStream::download] Failed to read data from the stream" };
+
+            return true;
+        },
+        timeout,
+        access_type
+    );
+}
+
+/* ==================================================== Protected ctors & dtors =================================================== */
+
+template<typename ImplementationT>
+Slave<ImplementationT>::SdoStream::SdoStream(
+    SlaveT *slave,
+    Address address,
+    std::size_t chunk_size
+) :
+    slave{ slave },
+    address{ address },
+    chunk_size{ chunk_size }
+{ }
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat
+
+#endif
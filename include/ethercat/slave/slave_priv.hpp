@@ -16,7 +16,17 @@
 
 /* =========================================================== Includes =========================================================== */
 
+// Standard includes
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
 // Private includes
+#include "ethercat/common/utilities/enum.hpp"
 #include "ethercat/slave.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
@@ -32,6 +42,11 @@ namespace details {
         static_assert(flag, "[ethercat::Slave::notify][BUG] Invalid PDO direction given"); 
     }
 
+    template<bool flag = false>
+    constexpr inline void find_pdo_dir_no_match() {
+        static_assert(flag, "[ethercat::Slave::find_pdo][BUG] Invalid PDO direction given"); 
+    }
+
 }
 
 template<typename ImplementationT>
@@ -45,6 +60,382 @@ void Slave<ImplementationT>::notify() {
         details::notify_dir_no_match();
 }
 
+
+template<typename ImplementationT>
+template<typename Slave<ImplementationT>::PdoDirection dir>
+typename Slave<ImplementationT>::template Pdo<dir> *Slave<ImplementationT>::find_pdo(std::string_view name) {
+
+    // If name has not been interned, no PDO can be named so
+    auto symbol = (names != nullptr) ? names->find(name) : std::optional<common::utilities::Symbol>{};
+    if(not symbol.has_value())
+        return nullptr;
+
+    // Auxiliary function looking for the PDO in the given list
+    auto find = [&symbol](auto &pdos) -> Pdo<dir>* {
+        auto it = std::find_if(pdos.begin(), pdos.end(), [&symbol](const auto &pdo){ return (pdo.name == *symbol); });
+        return (it != pdos.end()) ? &*it : nullptr;
+    };
+
+    if constexpr(dir == PdoDirection::Input) {
+        return find(inputs);
+    } else if constexpr(dir == PdoDirection::Output) {
+        return find(outputs);
+    } else
+        details::find_pdo_dir_no_match();
+}
+
+
+template<typename ImplementationT>
+void Slave<ImplementationT>::bind_names(common::utilities::StringPool &names) {
+    this->names = &names;
+    this->name  = names.intern(name);
+}
+
+/* ===================================================== Private methods (SDO) ==================================================== */
+
+template<typename ImplementationT>
+template<typename AccessT>
+void Slave<ImplementationT>::access_sdo(uint16_t index, uint16_t subindex, SdoDirection dir, AccessT &&access) {
+
+    // If statistics are disabled, simply perform access
+    if constexpr(not config::sdo::CollectStatistics) {
+        access();
+
+    // Otherwise, measure the access
+    } else {
+
+        auto start = std::chrono::steady_clock::now();
+
+        // Helper recording the access
+        auto record = [&](typename SdoStatistics::Outcome outcome) {
+            sdo_statistics.record(index, subindex, dir, 
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start),
+                outcome
+            );
+        };
+
+        // Perform access classifying its outcome
+        try {
+            access();
+        } catch(const std::system_error &err) {
+            record((err.code() == std::errc::timed_out) ? SdoStatistics::Outcome::Timeout : SdoStatistics::Outcome::Abort);
+            throw;
+        } catch(...) {
+            record(SdoStatistics::Outcome::Abort);
+            throw;
+        }
+
+        record(SdoStatistics::Outcome::Success);
+    }
+}
+
+
+template<typename ImplementationT>
+constexpr bool Slave<ImplementationT>::supports_segmented_upload() {
+    return requires(
+        ImplementationT &impl,
+        uint16_t index,
+        uint16_t subindex,
+        std::size_t chunk_size,
+        const SdoChunkConsumer &consumer,
+        std::chrono::milliseconds timeout,
+        bool complete_access
+    ) {
+        impl.upload_sdo_segmented(index, subindex, chunk_size, consumer, timeout, complete_access);
+    };
+}
+
+/* ===================================================== Private methods (ENI) ==================================================== */
+
+template<typename ImplementationT>
+std::function<eni::Slave()> Slave<ImplementationT>::make_eni_loader(eni::Slave slave_eni) {
+
+    // If slave is described by the ENI file, reload the description from the file on the first request
+    if(auto path = slave_eni.get_source_path(); not path.empty()) {
+
+        /**
+         * @brief Description of the slave shared by copies of the loader
+         */
+        struct LoadedEni {
+
+            /// Flag guarding loading of the description
+            std::once_flag loaded;
+            /// Autonomized subtree of the slave's description
+            std::optional<eni::Slave> slave;
+
+        };
+
+        return [
+            path = std::filesystem::path{ path },
+            source_hash = slave_eni.get_source_hash(),
+            name = std::string{ slave_eni.get_name() },
+            loaded = std::make_shared<LoadedEni>()
+        ]() {
+
+            // Load the description once (if loading fails, it is retried on the next call)
+            std::call_once(loaded->loaded, [&]() {
+
+                auto eni = config::eni::UseCompiledCache ?
+                    eni::configruation_from_file_cached(path) :
+                    eni::configruation_from_file(path);
+
+                // Make sure that the file still describes the slave as it has been configured
+                if(eni.get_source_hash() != source_hash) {
+                    throw eni::Error{ "[ethercat::Slave::get_eni] ENI file '" + path.string() + "' has been modified "
+                        "since the '" + name + "' slave has been configured" };
+                }
+
+                auto slave = eni.get_slave(name);
+                if(not slave.has_value())
+                    throw std::out_of_range{ "[ethercat::Slave::get_eni] Slave '" + name + "' is no longer described in the ENI file" };
+
+                // Keep only the slave's subtree of the ENI
+                slave->autonomize();
+                loaded->slave = std::move(slave);
+            });
+
+            return *(loaded->slave);
+        };
+    }
+
+    // Otherwise, keep only the slave's subtree of the ENI
+    slave_eni.autonomize();
+
+    return [slave_eni = std::move(slave_eni)]() {
+        return slave_eni;
+    };
+}
+
+/* ================================================ Private methods (init commands) =============================================== */
+
+template<typename ImplementationT>
+constexpr std::size_t Slave<ImplementationT>::transition_id(State from, State to) {
+    return common::utilities::to_underlying(from) * StatesNum + common::utilities::to_underlying(to);
+}
+
+
+template<typename ImplementationT>
+constexpr typename Slave<ImplementationT>::State
+Slave<ImplementationT>::next_state(State current, State target) {
+
+    // Transitions to/from the BOOT state are always direct
+    if(current == State::Boot or target == State::Boot)
+        return target;
+
+    // Auxiliary ordering of the 'main' ESM states
+    auto rank = [](State state) {
+        switch(state) {
+            case State::Init:   return 0;
+            case State::Preop:  return 1;
+            case State::Safeop: return 2;
+            default:            return 3;
+        }
+    };
+
+    // Downward transitions are performed directly
+    if(rank(target) <= rank(current))
+        return target;
+
+    // Upward transitions are performed step-by-step
+    switch(current) {
+        case State::Init:  return State::Preop;
+        case State::Preop: return State::Safeop;
+        default:           return State::Op;
+    }
+}
+
+
+template<typename ImplementationT>
+typename Slave<ImplementationT>::InitCmds
+Slave<ImplementationT>::compile_init_cmds(const eni::Slave::InitCmdsList &cmds_description) const {
+
+    /**
+     * @brief Auxiliary structure holding parsed description of the command
+     */
+    struct ParsedCmd {
+        uint16_t index;
+        uint8_t subindex;
+        bool download;
+        bool complete_access;
+        std::chrono::milliseconds timeout;
+        std::vector<uint8_t> data;
+        std::array<bool, StatesNum * StatesNum> transitions;
+    };
+
+    // Auxiliary function parsing state identifier used by the ENI
+    auto parse_state = [](char state) -> std::optional<State> {
+        switch(state) {
+            case 'I': return State::Init;
+            case 'P': return State::Preop;
+            case 'B': return State::Boot;
+            case 'S': return State::Safeop;
+            case 'O': return State::Op;
+            default:
+                return std::optional<State>{ };
+        }
+    };
+
+    std::vector<ParsedCmd> parsed;
+    parsed.reserve(cmds_description.size());
+
+    // Parse descriptions of commands (ENI tree is traversed only once)
+    for(const auto &cmd_description : cmds_description) {
+
+        ParsedCmd cmd {
+            .index           = static_cast<uint16_t>(cmd_description.get_index()),
+            .subindex        = static_cast<uint8_t>(cmd_description.get_subindex()),
+            .download        = cmd_description.is_download(),
+            .complete_access = cmd_description.is_complete_access(),
+            .timeout         = cmd_description.get_timeout(),
+            .data            = cmd_description.get_data(),
+            .transitions     = { }
+        };
+
+        // Parse transitions associated with the command
+        for(const auto &transition : cmd_description.get_transitions()) {
+
+            std::optional<State> from, to;
+
+            // Parse transition's states
+            if(transition.size() == 2) {
+                from = parse_state(transition[0]);
+                to   = parse_state(transition[1]);
+            }
+
+            // If invalid transition given, throw error
+            if(not from.has_value() or not to.has_value()) {
+                std::stringstream ss;
+                ss << "[ethercat::Slave::compile_init_cmds] Invalid transition "
+                   << "'" << transition << "' "
+                   << "of the CoE init command found in the description of the '" << name << "' slave";
+                throw eni::Error{ ss.str() };
+            }
+
+            cmd.transitions[transition_id(*from, *to)] = true;
+        }
+
+        parsed.push_back(std::move(cmd));
+    }
+
+    /**
+     * @brief Auxiliary function checking whether sequence of commands starting at the @p begin
+     *    forms a series of downloads into subsequent subindices of a single object (starting 
+     *    from subindex 1) terminated with download of the number of entries into subindex 0
+     *
+     * @returns 
+     *    number of entries written by the sequence if it can be coalesced into a single Complete
+     *    Access download or @c 0 otherwise
+     */
+    auto complete_access_run_length = [](const std::vector<const ParsedCmd*> &cmds, std::size_t begin) -> std::size_t {
+
+        const auto &first = *cmds[begin];
+
+        // Check whether sequence may start at the given command
+        if(not first.download or first.complete_access or first.subindex != 1 or first.data.empty())
+            return 0;
+
+        // Iterate over subsequent commands
+        for(std::size_t n = 1; begin + n < cmds.size(); ++n) {
+
+            const auto &cmd = *cmds[begin + n];
+
+            // All commands of the sequence are required to be plain downloads into the same object
+            if(cmd.index != first.index or not cmd.download or cmd.complete_access)
+                return 0;
+
+            // Sequence is required to be terminated with write of the number of entries
+            if(cmd.subindex == 0)
+                return (cmd.data.size() == 1 and cmd.data[0] == n) ? n : 0;
+
+            // Entries are required to be written in order and have equal sizes
+            if(cmd.subindex != n + 1 or cmd.data.size() != first.data.size())
+                return 0;
+        }
+
+        return 0;
+    };
+
+    // Coalesce commands only for slaves that are known to support Complete Access (i.e. ones whose ENI uses it)
+    bool coalesce = config::init_cmds::CoalesceCompleteAccess and
+        std::any_of(parsed.begin(), parsed.end(), [](const auto &cmd) { return cmd.complete_access; });
+
+    InitCmds ret;
+
+    // Compile commands of subsequent transitions
+    for(std::size_t transition = 0; transition < StatesNum * StatesNum; ++transition) {
+
+        // Mark beginning of the transition's commands
+        ret.offsets[transition] = ret.cmds.size();
+
+        // Select commands associated with the transition
+        std::vector<const ParsedCmd*> cmds;
+        for(const auto &cmd : parsed) {
+            if(cmd.transitions[transition])
+                cmds.push_back(&cmd);
+        }
+
+        // Compile selected commands
+        for(std::size_t i = 0; i < cmds.size();) {
+
+            // Check whether subsequent commands can be coalesced
+            std::size_t run_length = coalesce ? complete_access_run_length(cmds, i) : 0;
+
+            // If so, emit a single Complete Access download
+            if(run_length != 0) {
+
+                InitCmd cmd {
+                    .index           = cmds[i]->index,
+                    .subindex        = 0,
+                    .download        = true,
+                    .complete_access = true,
+                    .timeout         = std::chrono::milliseconds{ 0 },
+                    .data_offset     = ret.data.size(),
+                    .data_size       = 0
+                };
+
+                // Subindex 0 is transferred as UINT8 padded to 16 bits when Complete Access is used
+                ret.data.push_back(static_cast<uint8_t>(run_length));
+                ret.data.push_back(0);
+                // Concatenate data of subsequent entries
+                for(std::size_t n = 0; n < run_length; ++n) {
+                    ret.data.insert(ret.data.end(), cmds[i + n]->data.begin(), cmds[i + n]->data.end());
+                    cmd.timeout = std::max(cmd.timeout, cmds[i + n]->timeout);
+                }
+                cmd.timeout   = std::max(cmd.timeout, cmds[i + run_length]->timeout);
+                cmd.data_size = ret.data.size() - cmd.data_offset;
+                
+                ret.cmds.push_back(cmd);
+                i += run_length + 1;
+
+            // Otherwise, emit the command as is
+            } else {
+
+                ret.cmds.push_back(InitCmd {
+                    .index           = cmds[i]->index,
+                    .subindex        = cmds[i]->subindex,
+                    .download        = cmds[i]->download,
+                    .complete_access = cmds[i]->complete_access,
+                    .timeout         = cmds[i]->timeout,
+                    .data_offset     = ret.data.size(),
+                    .data_size       = cmds[i]->data.size()
+                });
+                ret.data.insert(ret.data.end(), cmds[i]->data.begin(), cmds[i]->data.end());
+
+                i += 1;
+            }
+        }
+    }
+
+    // Mark end of the last transition's commands
+    ret.offsets.back() = ret.cmds.size();
+
+    // Release unused memory
+    ret.cmds.shrink_to_fit();
+    ret.data.shrink_to_fit();
+
+    return ret;
+}
+
 /* ================================================================================================================================ */
 
 } // End namespace ethercat
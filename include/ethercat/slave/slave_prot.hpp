@@ -32,21 +32,27 @@ Slave<ImplementationT>::Slave(
     std::vector<Pdo<PdoDirection::Input>> &&inputs,
     std::vector<Pdo<PdoDirection::Output>> &&outputs
 ) :
-    // Store slave's ENI description as an autonomous object
-    eni_description{ slave_eni },
-    // Initialize slave's configruation
-    name{ slave_eni.get_name() },
-    // Initialize slave's configruation
-    fixed_addr{ eni_description.get_physical_addr() },
-    auto_increment_addr{ eni_description.get_auto_increment_addr() },
-    topological_addr{ 0x1 - eni_description.get_auto_increment_addr() },
+    // Initialize slave's configruation (name is re-interned by the Master, see bind_names())
+    name{ unbound_names.intern(slave_eni.get_name()) },
+    fixed_addr{ slave_eni.get_physical_addr() },
+    auto_increment_addr{ slave_eni.get_auto_increment_addr() },
+    topological_addr{ 0x1 - slave_eni.get_auto_increment_addr() },
+    // Initialize (empty) mirror of the Objects Dictionary
+    object_dictionary{ descriptors::ObjectDictionary::Identity{
+        static_cast<uint32_t>(slave_eni.get_vendor_id()),
+        static_cast<uint32_t>(slave_eni.get_product_code()),
+        static_cast<uint32_t>(slave_eni.get_revision_no())
+    } },
 
     // Initialize PDO lists
     inputs{ std::move(inputs) },
     outputs{ std::move(outputs) }
 {
-    // Autonomize slave's ENI description form the rest of ENI tree
-    eni_description.autonomize();
+    // Compile CoE init commands of the slave
+    init_cmds = compile_init_cmds(slave_eni.get_init_cmds());
+
+    // Keep only the loader of the slave's ENI description (the ENI tree is not referenced anymore)
+    eni_loader = make_eni_loader(std::move(slave_eni));
     
     /**
      * @brief Addressing schemes are described in [1]
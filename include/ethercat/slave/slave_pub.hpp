@@ -99,7 +99,7 @@ void Slave<ImplementationT>::unregister_event_handler(
 
 template<typename ImplementationT>
 eni::Slave Slave<ImplementationT>::get_eni() const {
-    return eni_description;
+    return eni_loader();
 }
 
 
@@ -135,7 +135,194 @@ Slave<ImplementationT>::get_state(std::chrono::milliseconds timeout) const {
 
 template<typename ImplementationT>
 void Slave<ImplementationT>::set_state(State state, std::chrono::milliseconds timeout) {
-    impl().set_state_impl(state, timeout);
+
+    // If init commands are not executed by the library, simply request state change
+    if constexpr(not config::init_cmds::ExecuteAtStateChange) {
+        impl().set_state_impl(state, timeout);
+
+    // Otherwise, go through the ESM step-by-step executing init commands of subsequent transitions
+    } else {
+
+        auto current = get_state(timeout);
+
+        // If slave is already in the target state, simply request state change
+        if(current == state) {
+            impl().set_state_impl(state, timeout);
+            return;
+        }
+
+        // Iterate over subsequent transitions
+        while(current != state) {
+
+            auto next = next_state(current, state);
+
+            // Mailbox communication is not available before the slave leaves INIT/BOOT state
+            if(current == State::Init or current == State::Boot) {
+                impl().set_state_impl(next, timeout);
+                execute_init_cmds(current, next, timeout);
+            } else {
+                execute_init_cmds(current, next, timeout);
+                impl().set_state_impl(next, timeout);
+            }
+
+            current = next;
+        }
+    }
+}
+
+/* ================================================= Public init commands methods ================================================= */
+
+template<typename ImplementationT>
+std::size_t Slave<ImplementationT>::get_init_cmds_num(State from, State to) const {
+    auto transition = transition_id(from, to);
+    return init_cmds.offsets[transition + 1] - init_cmds.offsets[transition];
+}
+
+
+template<typename ImplementationT>
+void Slave<ImplementationT>::execute_init_cmds(State from, State to, std::chrono::milliseconds timeout) {
+
+    auto transition = transition_id(from, to);
+
+    // Iterate over commands associated with the transition
+    for(auto i = init_cmds.offsets[transition]; i != init_cmds.offsets[transition + 1]; ++i) {
+
+        const auto &cmd = init_cmds.cmds[i];
+
+        // Select command's timeout
+        auto cmd_timeout = (cmd.timeout.count() != 0) ? cmd.timeout : timeout;
+
+        // Perform download
+        if(cmd.download) {
+            access_sdo(cmd.index, cmd.subindex, SdoDirection::Download, [&]() {
+                impl().download_sdo(
+                    cmd.index,
+                    cmd.subindex,
+                    config::types::Span<const uint8_t>{ init_cmds.data.data() + cmd.data_offset, cmd.data_size },
+                    cmd_timeout,
+                    cmd.complete_access
+                );
+            });
+        // Perform upload (uploaded data is not used by the library)
+        } else {
+            std::vector<uint8_t> buffer(cmd.data_size);
+            access_sdo(cmd.index, cmd.subindex, SdoDirection::Upload, [&]() {
+                impl().upload_sdo(
+                    cmd.index,
+                    cmd.subindex,
+                    config::types::Span<uint8_t>{ buffer },
+                    cmd_timeout,
+                    cmd.complete_access
+                );
+            });
+        }
+    }
+}
+
+/* =============================================== Public object dictionary methods =============================================== */
+
+template<typename ImplementationT>
+descriptors::ObjectDictionary &Slave<ImplementationT>::get_object_dictionary() {
+    return object_dictionary;
+}
+
+
+template<typename ImplementationT>
+const descriptors::ObjectDictionary &Slave<ImplementationT>::get_object_dictionary() const {
+    return object_dictionary;
+}
+
+
+template<typename ImplementationT>
+void Slave<ImplementationT>::scan_object_entry(
+    uint16_t index,
+    uint8_t subindex,
+    const types::Type &type,
+    std::string_view name,
+    std::chrono::milliseconds timeout
+) {
+    // Size of the entry declared by the type (bit-sized entries occupy a whole byte)
+    auto expected_size = (type.get_bitsize() + 7) / 8;
+
+    // Upload entry to verify its presence in the device and to measure its actual size
+    std::size_t uploaded_size = 0;
+    access_sdo(index, subindex, SdoDirection::Upload, [&]() {
+
+        // Measure size of the entry with the streaming upload, if provided by the implementation
+        if constexpr(supports_segmented_upload()) {
+            impl().upload_sdo_segmented(
+                index,
+                subindex,
+                config::sdo::DefaultStreamChunkSize,
+                SdoChunkConsumer{ [&uploaded_size](config::types::Span<const uint8_t> chunk, std::size_t) {
+                    uploaded_size += chunk.size();
+                    return true;
+                } },
+                timeout,
+                false
+            );
+        // Otherwise, upload the entry into the buffer of the declared size
+        } else {
+            std::vector<uint8_t> buffer(expected_size);
+            impl().upload_sdo(index, subindex, config::types::Span<uint8_t>{ buffer }, timeout, false);
+            uploaded_size = buffer.size();
+        }
+    });
+
+    // Verify that the device's entry matches the declared type
+    if(uploaded_size != expected_size) {
+        std::stringstream ss;
+        ss << "[ethercat::Slave::scan_object_entry] Size of the entry "
+           << "(" << std::hex << index << ":" << std::dec << static_cast<unsigned>(subindex) << ") "
+           << "uploaded from the '" << get_name() << "' slave "
+           << "(" << uploaded_size << " bytes) does not match the declared type "
+           << "'" << type.get_name() << "' (" << expected_size << " bytes)";
+        throw std::runtime_error{ ss.str() };
+    }
+
+    // On success, store description of the entry
+    object_dictionary.add_entry(descriptors::ObjectDictionary::Entry{ index, subindex, std::string{ name }, type });
+
+    // Lay out entries of the object as seen with Complete Access (subindex 0 is padded to 16 bits)
+    constexpr std::size_t CompleteAccessSubindexZeroBitsize = 16;
+    auto entries = std::vector<descriptors::ObjectDictionary::Entry>(
+        object_dictionary.get_object(index).begin(),
+        object_dictionary.get_object(index).end()
+    );
+    std::size_t bitoffset = 0;
+    for(auto &entry : entries) {
+        entry.bitoffset = bitoffset;
+        bitoffset += (entry.subindex == 0) ? 
+            std::max(entry.type.get_bitsize(), CompleteAccessSubindexZeroBitsize) : entry.type.get_bitsize();
+        object_dictionary.add_entry(std::move(entry));
+    }
+}
+
+
+template<typename ImplementationT>
+bool Slave<ImplementationT>::load_object_dictionary(const std::filesystem::path &directory) {
+
+    auto path = directory / descriptors::ObjectDictionary::make_file_name(object_dictionary.get_identity());
+
+    // Check if dictionary has been stored
+    if(not std::filesystem::exists(path))
+        return false;
+
+    auto dictionary = descriptors::ObjectDictionary::load(path);
+
+    // Verify that stored dictionary describes the same device type
+    if(dictionary.get_identity() != object_dictionary.get_identity())
+        return false;
+
+    object_dictionary = std::move(dictionary);
+
+    return true;
+}
+
+
+template<typename ImplementationT>
+void Slave<ImplementationT>::save_object_dictionary(const std::filesystem::path &directory) const {
+    object_dictionary.save(directory / descriptors::ObjectDictionary::make_file_name(object_dictionary.get_identity()));
 }
 
 /* ================================================== Public access methods (SDO) ================================================= */
@@ -264,6 +451,28 @@ const auto Slave<ImplementationT>::get_sdo(
     >(index, subindex);
 }
 
+template<typename ImplementationT>
+typename Slave<ImplementationT>::SdoStream Slave<ImplementationT>::get_sdo_stream(
+    uint16_t index,
+    uint16_t subindex,
+    std::size_t chunk_size
+) {
+    return SdoStream{ &impl(), typename SdoStream::Address{ index, subindex }, chunk_size };
+}
+
+/* ================================================= Public SDO statistics methods ================================================ */
+
+template<typename ImplementationT>
+typename Slave<ImplementationT>::SdoStatistics &Slave<ImplementationT>::get_sdo_statistics() {
+    return sdo_statistics;
+}
+
+
+template<typename ImplementationT>
+const typename Slave<ImplementationT>::SdoStatistics &Slave<ImplementationT>::get_sdo_statistics() const {
+    return sdo_statistics;
+}
+
 /* ================================================== Public access methods (PDO) ================================================= */
 
 namespace details {
@@ -291,81 +500,68 @@ std::vector<typename Slave<ImplementationT>::template Pdo<dir>> &Slave<Implement
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 const std::vector<typename Slave<ImplementationT>::template Pdo<dir>> &Slave<ImplementationT>::get_pdos() const {
-    return const_cast<Slave*>(this)->get_pdos();
+    return const_cast<Slave*>(this)->template get_pdos<dir>();
 }
 
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 bool Slave<ImplementationT>::has_pdo(std::string_view name) const {
-    if constexpr(dir == PdoDirection::Input) {
-        return (std::find_if(inputs.begin(), inputs.end(),   [name](const auto &pdo){ return (pdo.get_name() == name); }) != inputs.end());
-    } else if constexpr(dir == PdoDirection::Output) {
-        return (std::find_if(outputs.begin(), outputs.end(), [name](const auto &pdo){ return (pdo.get_name() == name); }) != outputs.end());
-    } else
-        details::slave_dir_no_match();
+    return (const_cast<Slave*>(this)->template find_pdo<dir>(name) != nullptr);
 }
 
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 typename Slave<ImplementationT>::template Pdo<dir> &Slave<ImplementationT>::get_pdo(std::string_view name) {
-    if constexpr(dir == PdoDirection::Input) {
 
-        auto it = std::find_if(inputs.begin(), inputs.end(), [name](const auto &pdo){ return (pdo.get_name() == name); });
-        if(it == inputs.end())
-            throw std::out_of_range{ "[ethercat::Slave::get_pdo] No input PDO named '" + std::string{ name } + "'" };
-        return *it;
-
-    } else if constexpr(dir == PdoDirection::Output) {
+    // Try to find the PDO
+    auto *pdo = find_pdo<dir>(name);
 
-        auto it = std::find_if(outputs.begin(), outputs.end(), [name](const auto &pdo){ return (pdo.get_name() == name); });
-        if(it == outputs.end())
+    // If not found, throw
+    if(pdo == nullptr) {
+        if constexpr(dir == PdoDirection::Input)
+            throw std::out_of_range{ "[ethercat::Slave::get_pdo] No input PDO named '" + std::string{ name } + "'" };
+        else
             throw std::out_of_range{ "[ethercat::Slave::get_pdo] No output PDO named '" + std::string{ name } + "'" };
-        return *it;
-        
-    } else
-        details::slave_dir_no_match();
+    }
+
+    return *pdo;
 }
 
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 const typename Slave<ImplementationT>::template Pdo<dir> &Slave<ImplementationT>::get_pdo(std::string_view name) const {
-    return const_cast<Slave*>(this)->get_pdo(name);
+    return const_cast<Slave*>(this)->template get_pdo<dir>(name);
 }
 
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 typename Slave<ImplementationT>::template Pdo<dir>::Entry &Slave<ImplementationT>::get_pdo_entry(std::string_view name) {
-    if constexpr(dir == PdoDirection::Input) {
-
-        for(auto &pdo : inputs) {
-            if(pdo.has_entry(name))
-                return pdo.get_entry(name);
-        }
-
-        throw std::out_of_range{ "[ethercat::Slave::get_pdo_entry] No input PDO entry named '" + std::string{ name } + "'" };
 
-    } else if constexpr(dir == PdoDirection::Output) {
+    // Resolve symbol of the name once (if name has not been interned, no entry can be named so)
+    auto symbol = (names != nullptr) ? names->find(name) : std::optional<common::utilities::Symbol>{};
 
-        for(auto &pdo : outputs) {
-            if(pdo.has_entry(name))
-                return pdo.get_entry(name);
+    if(symbol.has_value()) {
+        for(auto &pdo : get_pdos<dir>()) {
+            if(auto entry = pdo.find_entry(*symbol); entry != pdo.entries.end())
+                return *entry;
         }
+    }
 
+    if constexpr(dir == PdoDirection::Input)
+        throw std::out_of_range{ "[ethercat::Slave::get_pdo_entry] No input PDO entry named '" + std::string{ name } + "'" };
+    else
         throw std::out_of_range{ "[ethercat::Slave::get_pdo_entry] No output PDO entry named '" + std::string{ name } + "'" };
-        
-    } else
-        details::slave_dir_no_match();
 }
 
 
 template<typename ImplementationT>
 template<typename Slave<ImplementationT>::PdoDirection dir>
 const typename Slave<ImplementationT>::template Pdo<dir>::Entry &Slave<ImplementationT>::get_pdo_entry(std::string_view name) const {
-    return const_cast<Slave*>(this)->get_pdo(name);
+    return const_cast<Slave*>(this)->template get_pdo_entry<dir>(name);
 }
 
 /* ================================================================================================================================ */
@@ -21,6 +21,7 @@
 #include "ethercat/types/structural.hpp"
 #include "ethercat/types/type.hpp"
 #include "ethercat/types/type_error.hpp"
+#include "ethercat/types/type_registry.hpp"
 
 /* ================================================================================================================================ */
 
@@ -0,0 +1,145 @@
+/* ============================================================================================================================ *//**
+ * @file       type_registry.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:53:49 pm
+ * @modified   Sunday, 18th October 2026 12:53:49 pm
+ * @project    ethercat-lib
+ * @brief      Declarations of the process-wide registry of interned type descriptors
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_TYPES_TYPE_REGISTRY_H__
+#define __ETHERCAT_TYPES_TYPE_REGISTRY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <atomic>
+#include <cstdint>
+// Private includes
+#include "ethercat/types/type.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::types {
+
+/* ========================================================== TypeHandle ========================================================== */
+
+/**
+ * @brief Compact (32-bit) handle of the type descriptor interned in the TypeRegistry
+ * @details As each distinct type is interned only once, handles referring to equal types
+ *    are equal themselves. Comparing handles costs therefore a single integer comparison
+ *    instead of the deep comparison of (possibly structural) type descriptors.
+ */
+class TypeHandle {
+
+public: /* ----------------------------------------------------- Public types ----------------------------------------------------- */
+
+    /// Underlying type of the handle
+    using IndexType = uint32_t;
+
+public: /* --------------------------------------------------- Public operators --------------------------------------------------- */
+
+    /// @returns reference to the interned type descriptor
+    inline const Type &operator*() const;
+    /// @returns pointer to the interned type descriptor
+    inline const Type *operator->() const;
+
+    /// @retval true if both handles refer to the same type @retval false otherwise
+    constexpr bool operator==(const TypeHandle &rhandle) const;
+    /// @retval true if handles refer to different types @retval false otherwise
+    constexpr bool operator!=(const TypeHandle &rhandle) const;
+
+public: /* ---------------------------------------------------- Public getters ---------------------------------------------------- */
+
+    /// @returns reference to the interned type descriptor
+    inline const Type &get() const;
+    /// @returns index of the type in the registry
+    constexpr IndexType get_index() const;
+
+private: /* ---------------------------------------------------- Private ctors ---------------------------------------------------- */
+
+    /// Constructs handle of the type interned at the given @p index
+    constexpr explicit TypeHandle(IndexType index);
+
+private: /* --------------------------------------------------- Private friends --------------------------------------------------- */
+
+    /// Make registry a friend to let it create handles
+    friend class TypeRegistry;
+
+private: /* ---------------------------------------------------- Private data ----------------------------------------------------- */
+
+    /// Index of the type in the registry
+    IndexType index;
+
+};
+
+/* ========================================================= TypeRegistry ========================================================= */
+
+/**
+ * @brief Process-wide registry of interned type descriptors
+ * @details Typical bus consists of thousands of PDO entries sharing only a few dozen distinct
+ *    types. Registry stores a single copy of each distinct type so that entries can refer to
+ *    it with a compact TypeHandle. Interned descriptors are never released and never moved,
+ *    so references obtained from handles stay valid for the lifetime of the process.
+ *
+ * @note Interning is synchronized with the internal mutex. Resolving handles is lock-free.
+ */
+class TypeRegistry {
+
+public: /* --------------------------------------------------- Public constants --------------------------------------------------- */
+
+    /// Number of descriptors stored in a single chunk of the registry
+    static constexpr std::size_t ChunkSize = 64;
+    /// Maximal number of chunks of the registry
+    static constexpr std::size_t MaxChunksNum = 1024;
+
+public: /* ------------------------------------------------ Public static methods ------------------------------------------------- */
+
+    /**
+     * @brief Interns the @p type in the registry
+     *
+     * @param type
+     *    type to be interned
+     * @returns
+     *    handle of the interned type (handle of the already registered descriptor if the equal
+     *    type has been interned before)
+     *
+     * @throws std::runtime_error
+     *    if registry is full
+     */
+    static TypeHandle intern(const Type &type);
+
+    /**
+     * @param handle
+     *    handle of the type
+     * @returns
+     *    reference to the descriptor of the interned type
+     */
+    static inline const Type &get(TypeHandle handle);
+
+    /// @returns number of types interned in the registry
+    static std::size_t size();
+
+private: /* ------------------------------------------------- Private static data ------------------------------------------------- */
+
+    /// Published chunks of the registry (chunks are allocated on demand and never reallocated)
+    static std::array<std::atomic<const Type*>, MaxChunksNum> chunks;
+
+};
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::types
+
+/* ==================================================== Implementation includes =================================================== */
+
+#include "ethercat/types/type_registry/type_registry.hpp"
+
+/* ================================================================================================================================ */
+
+#endif
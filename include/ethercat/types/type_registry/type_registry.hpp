@@ -0,0 +1,73 @@
+/* ============================================================================================================================ *//**
+ * @file       type_registry.hpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:53:49 pm
+ * @modified   Sunday, 18th October 2026 12:53:49 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of inline methods of the TypeHandle and TypeRegistry classes
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+#ifndef __ETHERCAT_TYPES_TYPE_REGISTRY_TYPE_REGISTRY_H__
+#define __ETHERCAT_TYPES_TYPE_REGISTRY_TYPE_REGISTRY_H__
+
+/* =========================================================== Includes =========================================================== */
+
+// Private includes
+#include "ethercat/types/type_registry.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::types {
+
+/* ========================================================== TypeHandle ========================================================== */
+
+const Type &TypeHandle::operator*() const {
+    return get();
+}
+
+
+const Type *TypeHandle::operator->() const {
+    return &get();
+}
+
+
+constexpr bool TypeHandle::operator==(const TypeHandle &rhandle) const {
+    return (index == rhandle.index);
+}
+
+
+constexpr bool TypeHandle::operator!=(const TypeHandle &rhandle) const {
+    return (index != rhandle.index);
+}
+
+
+const Type &TypeHandle::get() const {
+    return TypeRegistry::get(*this);
+}
+
+
+constexpr TypeHandle::IndexType TypeHandle::get_index() const {
+    return index;
+}
+
+
+constexpr TypeHandle::TypeHandle(IndexType index) :
+    index{ index }
+{ }
+
+/* ========================================================= TypeRegistry ========================================================= */
+
+const Type &TypeRegistry::get(TypeHandle handle) {
+    // Handle can be obtained only after the chunk has been published, so that acquire ordering suffices
+    return chunks[handle.index / ChunkSize].load(std::memory_order_acquire)[handle.index % ChunkSize];
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::types
+
+#endif
@@ -0,0 +1,143 @@
+/* ============================================================================================================================ *//**
+ * @file       image_buffer.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 1:14:13 pm
+ * @modified   Sunday, 18th October 2026 1:14:13 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of methods of the page-backed buffer storing the Process Data Image
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+#include <utility>
+// System includes
+#include <sys/mman.h>
+#include <unistd.h>
+// Private includes
+#include "ethercat/common/pdi/image_buffer.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::common::pdi {
+
+/* ============================================================ Helpers =========================================================== */
+
+namespace {
+
+    /// @returns @p size rounded up to the multiple of @p unit
+    constexpr std::size_t round_up(std::size_t size, std::size_t unit) {
+        return ((size + unit - 1) / unit) * unit;
+    }
+
+    /// @returns anonymous, prefaulted mapping of the given @p length (or MAP_FAILED)
+    void *map(std::size_t length, int flags) {
+        return ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE | flags, -1, 0);
+    }
+
+}
+
+/* ========================================================= Public ctors ========================================================= */
+
+ImageBuffer::ImageBuffer(std::size_t size) {
+    reset(size);
+}
+
+
+ImageBuffer::ImageBuffer(ImageBuffer &&rbuffer) noexcept :
+    buffer{ std::exchange(rbuffer.buffer, nullptr) },
+    bytes{ std::exchange(rbuffer.bytes, 0) },
+    length{ std::exchange(rbuffer.length, 0) },
+    locked{ std::exchange(rbuffer.locked, false) },
+    huge{ std::exchange(rbuffer.huge, false) }
+{ }
+
+
+ImageBuffer &ImageBuffer::operator=(ImageBuffer &&rbuffer) noexcept {
+
+    if(this != &rbuffer) {
+        release();
+        buffer = std::exchange(rbuffer.buffer, nullptr);
+        bytes  = std::exchange(rbuffer.bytes, 0);
+        length = std::exchange(rbuffer.length, 0);
+        locked = std::exchange(rbuffer.locked, false);
+        huge   = std::exchange(rbuffer.huge, false);
+    }
+
+    return *this;
+}
+
+
+ImageBuffer::~ImageBuffer() {
+    release();
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+void ImageBuffer::reset(std::size_t size) {
+
+    release();
+
+    // Empty buffer requires no mapping
+    if(size == 0)
+        return;
+
+    void *mapping = MAP_FAILED;
+
+    // Try to map the buffer with huge pages (if requested)
+    if constexpr(config::pdi::UseHugePages) {
+        length  = round_up(size, config::pdi::HugePageSize);
+        mapping = map(length, MAP_HUGETLB);
+        huge    = (mapping != MAP_FAILED);
+    }
+
+    // Otherwise, map the buffer with regular pages
+    if(mapping == MAP_FAILED) {
+        length  = round_up(size, static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)));
+        mapping = map(length, 0);
+    }
+
+    if(mapping == MAP_FAILED) {
+        length = 0;
+        throw std::system_error{ errno, std::generic_category(),
+            "[ethercat::common::pdi::ImageBuffer::reset] Failed to map the buffer" };
+    }
+
+    buffer = static_cast<uint8_t*>(mapping);
+    bytes  = size;
+
+    // Lock pages of the buffer in the memory (if requested; failure is not fatal)
+    if constexpr(config::pdi::LockMemory)
+        locked = (::mlock(buffer, length) == 0);
+
+    // Touch all pages of the mapping, so that none of them is faulted in by the bus I/O
+    std::memset(buffer, 0, length);
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+void ImageBuffer::release() noexcept {
+
+    if(buffer != nullptr) {
+        if(locked)
+            ::munlock(buffer, length);
+        ::munmap(buffer, length);
+    }
+
+    buffer = nullptr;
+    bytes  = 0;
+    length = 0;
+    locked = false;
+    huge   = false;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::common::pdi
@@ -0,0 +1,302 @@
+/* ============================================================================================================================ *//**
+ * @file       object_dictionary.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:39:17 am
+ * @modified   Sunday, 18th October 2026 1:35:53 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of methods of the ObjectDictionary class
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <fstream>
+#include <limits>
+// Private includes
+#include "ethercat/descriptors/object_dictionary.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::descriptors {
+
+/* ============================================================ Helpers =========================================================== */
+
+namespace details {
+
+    /// Magic number opening binary image of the dictionary
+    static constexpr std::string_view MAGIC { "ECOD" };
+    /// Version of the binary image format
+    static constexpr uint16_t VERSION { 1 };
+
+    /// Kinds of types stored in the binary image
+    enum class TypeKind : uint8_t { Builtin = 0, Structural = 1 };
+
+    /* --------------------------------------------------------- Writers --------------------------------------------------------- */
+
+    template<typename T>
+    static void write(std::ostream &stream, T value) {
+        uint8_t bytes[sizeof(T)];
+        for(std::size_t i = 0; i < sizeof(T); ++i)
+            bytes[i] = static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i));
+        stream.write(reinterpret_cast<const char*>(bytes), sizeof(T));
+    }
+
+    static void write_string(std::ostream &stream, std::string_view str) {
+        if(str.size() > std::numeric_limits<uint16_t>::max())
+            throw std::ios_base::failure{ "[ethercat::descriptors::ObjectDictionary::save] String too long to be stored" };
+        write<uint16_t>(stream, static_cast<uint16_t>(str.size()));
+        stream.write(str.data(), str.size());
+    }
+
+    static void write_builtin(std::ostream &stream, const ::ethercat::types::BuiltinType &type) {
+        write<uint8_t>(stream, static_cast<uint8_t>(common::utilities::to_underlying(type.get_id())));
+        write<uint32_t>(stream, static_cast<uint32_t>(type.arity));
+        write<uint32_t>(stream, static_cast<uint32_t>(type.is_string() ? type.get_string().size : 0));
+        write<uint8_t>(stream, type.name.has_value() ? 1 : 0);
+        if(type.name.has_value())
+            write_string(stream, *type.name);
+    }
+
+    static void write_type(std::ostream &stream, const ::ethercat::types::Type &type) {
+
+        // Write builtin type
+        if(type.is_builtin()) {
+            write<uint8_t>(stream, common::utilities::to_underlying(TypeKind::Builtin));
+            write_builtin(stream, type.get_builtin());
+        // Write structural type
+        } else {
+            auto &structural = type.get_structural();
+            write<uint8_t>(stream, common::utilities::to_underlying(TypeKind::Structural));
+            write_string(stream, structural.name);
+            write<uint32_t>(stream, static_cast<uint32_t>(structural.bitsize));
+            write<uint16_t>(stream, static_cast<uint16_t>(structural.subitems.size()));
+            for(auto &subitem : structural.subitems) {
+                write<uint8_t>(stream, static_cast<uint8_t>(subitem.subindex));
+                write_string(stream, subitem.name);
+                write<uint32_t>(stream, static_cast<uint32_t>(subitem.bitoffset));
+                write_builtin(stream, subitem.type);
+            }
+        }
+    }
+
+    /* --------------------------------------------------------- Readers --------------------------------------------------------- */
+
+    [[noreturn]] static void throw_format_error(std::string_view msg) {
+        throw std::runtime_error{ std::string{ "[ethercat::descriptors::ObjectDictionary::load] " } + std::string{ msg } };
+    }
+
+    template<typename T>
+    static T read(std::istream &stream) {
+        uint8_t bytes[sizeof(T)] { };
+        if(not stream.read(reinterpret_cast<char*>(bytes), sizeof(T)))
+            throw_format_error("Unexpected end of the image");
+        uint64_t value = 0;
+        for(std::size_t i = 0; i < sizeof(T); ++i)
+            value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        return static_cast<T>(value);
+    }
+
+    static std::string read_string(std::istream &stream) {
+        std::string str(read<uint16_t>(stream), '\0');
+        if(not stream.read(str.data(), str.size()))
+            throw_format_error("Unexpected end of the image");
+        return str;
+    }
+
+    static ::ethercat::types::BuiltinType read_builtin(std::istream &stream) {
+
+        using BuiltinType = ::ethercat::types::BuiltinType;
+        using NumericType = ::ethercat::types::NumericType;
+        using StringType  = ::ethercat::types::StringType;
+
+        auto id    = read<uint8_t>(stream);
+        auto arity = read<uint32_t>(stream);
+        auto size  = read<uint32_t>(stream);
+
+        // Validate type's ID
+        if(id >= BuiltinType::TYPES_NUM)
+            throw_format_error("Invalid builtin type ID");
+
+        // Construct the type
+        BuiltinType type = (id == common::utilities::to_underlying(BuiltinType::ID::String)) ?
+            BuiltinType{ StringType{ size }, arity } :
+            BuiltinType{ NumericType{ common::utilities::to_enum<NumericType::ID>(id) }, arity };
+
+        // Read optional custom name
+        if(read<uint8_t>(stream) != 0)
+            type.name = read_string(stream);
+
+        return type;
+    }
+
+    static ::ethercat::types::Type read_type(std::istream &stream) {
+
+        switch(static_cast<TypeKind>(read<uint8_t>(stream))) {
+
+            // Read builtin type
+            case TypeKind::Builtin:
+                return ::ethercat::types::Type{ read_builtin(stream) };
+
+            // Read structural type
+            case TypeKind::Structural: {
+
+                ::ethercat::types::StructuralType structural;
+
+                structural.name    = read_string(stream);
+                structural.bitsize = read<uint32_t>(stream);
+                auto subitems_num = read<uint16_t>(stream);
+                for(std::size_t i = 0; (i < subitems_num) and stream; ++i) {
+                    auto subindex  = read<uint8_t>(stream);
+                    auto name      = read_string(stream);
+                    auto bitoffset = read<uint32_t>(stream);
+                    auto type      = read_builtin(stream);
+                    structural.subitems.push_back({ subindex, std::move(name), std::move(type), bitoffset });
+                }
+
+                return ::ethercat::types::Type{ structural };
+            }
+
+            default:
+                throw_format_error("Invalid type kind");
+        }
+    }
+
+}
+
+/* ======================================================== Public getters ======================================================== */
+
+std::vector<uint16_t> ObjectDictionary::list_objects() const {
+
+    std::vector<uint16_t> ret;
+
+    // Entries are sorted, so it's enough to skip repeating indices
+    for(auto &entry : entries) {
+        if(ret.empty() or ret.back() != entry.index)
+            ret.push_back(entry.index);
+    }
+
+    return ret;
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+void ObjectDictionary::add_entry(Entry entry) {
+
+    auto it = lower_bound(entry.index, entry.subindex);
+
+    // Replace existing entry
+    if((it != entries.end()) and (it->index == entry.index) and (it->subindex == entry.subindex))
+        entries[std::distance(entries.cbegin(), it)] = std::move(entry);
+    // Else insert entry at the sorted position
+    else
+        entries.insert(it, std::move(entry));
+}
+
+/* ====================================================== Public I/O methods ====================================================== */
+
+void ObjectDictionary::save(std::ostream &stream) const {
+
+    // Write header
+    stream.write(details::MAGIC.data(), details::MAGIC.size());
+    details::write<uint16_t>(stream, details::VERSION);
+    details::write<uint32_t>(stream, identity.vendor_id);
+    details::write<uint32_t>(stream, identity.product_code);
+    details::write<uint32_t>(stream, identity.revision_no);
+    details::write<uint32_t>(stream, static_cast<uint32_t>(entries.size()));
+
+    // Write entries
+    for(auto &entry : entries) {
+        details::write<uint16_t>(stream, entry.index);
+        details::write<uint8_t>(stream, entry.subindex);
+        details::write<uint32_t>(stream, static_cast<uint32_t>(entry.bitoffset));
+        details::write_string(stream, entry.name);
+        details::write_type(stream, entry.type);
+    }
+
+    // Check stream's state
+    if(not stream)
+        throw std::ios_base::failure{ "[ethercat::descriptors::ObjectDictionary::save] Failed to write the dictionary" };
+}
+
+
+void ObjectDictionary::save(const std::filesystem::path &path) const {
+
+    std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+
+    // Check if file has been opened
+    if(not file.is_open())
+        throw std::ios_base::failure{ "[ethercat::descriptors::ObjectDictionary::save] Failed to open '" + path.string() + "' file" };
+
+    save(file);
+}
+
+
+ObjectDictionary ObjectDictionary::load(std::istream &stream) {
+
+    // Read and verify header
+    char magic[details::MAGIC.size()];
+    stream.read(magic, sizeof(magic));
+    if(not stream or std::string_view{ magic, sizeof(magic) } != details::MAGIC)
+        details::throw_format_error("Invalid magic number");
+    if(details::read<uint16_t>(stream) != details::VERSION)
+        details::throw_format_error("Unsupported format version");
+
+    // Read identity
+    Identity identity;
+    identity.vendor_id    = details::read<uint32_t>(stream);
+    identity.product_code = details::read<uint32_t>(stream);
+    identity.revision_no  = details::read<uint32_t>(stream);
+
+    ObjectDictionary ret{ identity };
+
+    // Read entries (stored in sorted order)
+    auto entries_num = details::read<uint32_t>(stream);
+    for(std::size_t i = 0; (i < entries_num) and stream; ++i) {
+
+        auto index     = details::read<uint16_t>(stream);
+        auto subindex  = details::read<uint8_t>(stream);
+        auto bitoffset = details::read<uint32_t>(stream);
+        auto name      = details::read_string(stream);
+        auto type      = details::read_type(stream);
+
+        ret.add_entry(Entry{ index, subindex, std::move(name), std::move(type), bitoffset });
+    }
+
+    // Check stream's state
+    if(not stream)
+        throw std::ios_base::failure{ "[ethercat::descriptors::ObjectDictionary::load] Failed to read the dictionary" };
+
+    return ret;
+}
+
+
+ObjectDictionary ObjectDictionary::load(const std::filesystem::path &path) {
+
+    std::ifstream file{ path, std::ios::binary };
+
+    // Check if file has been opened
+    if(not file.is_open())
+        throw std::ios_base::failure{ "[ethercat::descriptors::ObjectDictionary::load] Failed to open '" + path.string() + "' file" };
+
+    return load(file);
+}
+
+
+std::string ObjectDictionary::make_file_name(Identity identity) {
+
+    std::stringstream ss;
+
+    ss << std::hex << std::setfill('0')
+       << std::setw(8) << identity.vendor_id    << "_"
+       << std::setw(8) << identity.product_code << "_"
+       << std::setw(8) << identity.revision_no  << ".od";
+
+    return ss.str();
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::descriptors
@@ -0,0 +1,904 @@
+/* ============================================================================================================================ *//**
+ * @file       document.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:51:46 am
+ * @modified   Sunday, 18th October 2026 1:40:45 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of methods of the Document class implementing XML parser of ENI files
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+// System includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// Private includes
+#include "ethercat/config.hpp"
+#include "ethercat/eni/common/document.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni::details {
+
+/* ============================================================ Helpers =========================================================== */
+
+namespace {
+
+    /// @returns @c true if @p c is an XML whitespace
+    constexpr bool is_whitespace(char c) {
+        return (c == ' ') or (c == '\t') or (c == '\n') or (c == '\r');
+    }
+
+    /// @returns @c true if @p c terminates XML name
+    constexpr bool is_name_end(char c) {
+        return is_whitespace(c) or (c == '/') or (c == '>') or (c == '=') or (c == '\0');
+    }
+
+    /// @returns @c true if @p str consists of whitespaces only
+    constexpr bool is_whitespace(std::string_view str) {
+        return std::all_of(str.begin(), str.end(), [](char c) { return is_whitespace(c); });
+    }
+
+    /**
+     * @brief Appends UTF-8 representation of the @p code point to the buffer at @p out
+     * @returns
+     *    pointer past the last written character
+     */
+    char *write_utf8(char *out, unsigned long code) {
+        if(code < 0x80) {
+            *out++ = static_cast<char>(code);
+        } else if(code < 0x800) {
+            *out++ = static_cast<char>(0xC0 | (code >> 6));
+            *out++ = static_cast<char>(0x80 | (code & 0x3F));
+        } else if(code < 0x10000) {
+            *out++ = static_cast<char>(0xE0 | (code >> 12));
+            *out++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            *out++ = static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            *out++ = static_cast<char>(0xF0 | (code >> 18));
+            *out++ = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            *out++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            *out++ = static_cast<char>(0x80 | (code & 0x3F));
+        }
+        return out;
+    }
+
+    /**
+     * @brief Decodes XML entities in the [ @p begin, @p end ) range in place (decoded text is
+     *    never longer than the source)
+     * @returns
+     *    view of the decoded text
+     */
+    std::string_view decode_entities(char *begin, char *end) {
+
+        // Find the first entity (fast path for texts with no entities)
+        auto *in = std::find(begin, end, '&');
+        if(in == end)
+            return std::string_view{ begin, static_cast<std::size_t>(end - begin) };
+
+        auto *out = in;
+
+        while(in != end) {
+
+            // Copy regular characters
+            if(*in != '&') {
+                *out++ = *in++;
+                continue;
+            }
+
+            // Find end of the entity
+            auto *semicolon = std::find(in, std::min(in + 12, end), ';');
+            if(semicolon == std::min(in + 12, end)) {
+                *out++ = *in++;
+                continue;
+            }
+
+            std::string_view entity{ in + 1, static_cast<std::size_t>(semicolon - in - 1) };
+
+            // Decode named entities
+            if(entity == "lt")        *out++ = '<';
+            else if(entity == "gt")   *out++ = '>';
+            else if(entity == "amp")  *out++ = '&';
+            else if(entity == "quot") *out++ = '"';
+            else if(entity == "apos") *out++ = '\'';
+            // Decode character references
+            else if(entity.size() > 1 and entity[0] == '#') {
+                auto digits = (entity[1] == 'x') ? entity.substr(2) : entity.substr(1);
+                unsigned long code = 0;
+                std::from_chars(digits.data(), digits.data() + digits.size(), code, (entity[1] == 'x') ? 16 : 10);
+                out = write_utf8(out, code);
+            // Leave unknown entities untouched
+            } else {
+                out = std::copy(in, semicolon + 1, out);
+            }
+
+            in = semicolon + 1;
+        }
+
+        return std::string_view{ begin, static_cast<std::size_t>(out - begin) };
+    }
+
+    /// Magic number identifying binary image of the document
+    constexpr char IMAGE_MAGIC[4] { 'E', 'N', 'I', 'C' };
+
+    /**
+     * @brief Header of the binary image of the document
+     * @details Image consists of the header, table of nodes (stored exactly as they are used by
+     *    the Document) and the text blob of (deduplicated) strings referred by the nodes. Image 
+     *    is stored in the native byte order (image written on the machine with different byte 
+     *    order is rejected as its version does not match)
+     */
+    struct ImageHeader {
+
+        /// Magic number
+        char magic[4];
+        /// Version of the image format
+        std::uint32_t version;
+        /// Hash of the XML source
+        std::uint64_t source_hash;
+        /// Number of nodes
+        std::uint64_t nodes_num;
+        /// Size of the text blob [B]
+        std::uint64_t text_size;
+
+    };
+
+    /// Flag marking offsets of strings stored in the auxiliary buffer during parsing
+    constexpr Document::index_type AUXILIARY_FLAG = 0x80000000U;
+
+    /// Reads the whole file at @p path into the string
+    std::string read_file(const std::filesystem::path &path) {
+
+        std::ifstream file{ path, std::ios::binary };
+
+        // Check if file has been opened
+        if(not file.is_open())
+            throw std::runtime_error{ "Failed to open '" + path.string() + "' file" };
+
+        // Read the whole file at once
+        std::string source(std::filesystem::file_size(path), '\0');
+        if(not file.read(source.data(), source.size()))
+            throw std::runtime_error{ "Failed to read '" + path.string() + "' file" };
+
+        return source;
+    }
+
+    /**
+     * @brief Maps the whole file at @p path into the memory (privately, i.e. modifications of the
+     *    mapping are not written back to the file)
+     * 
+     * @param path
+     *    path to the file
+     * @param[out] size
+     *    size of the mapped file
+     * @returns
+     *    mapping (unmapped when the last reference is released) or @c nullptr if file could
+     *    not be mapped
+     */
+    std::shared_ptr<char> map_file(const std::filesystem::path &path, std::size_t &size) {
+
+        // Open the file
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if(fd < 0)
+            return nullptr;
+
+        // Get size of the file
+        struct stat info;
+        if(::fstat(fd, &info) != 0 or info.st_size == 0) {
+            ::close(fd);
+            return nullptr;
+        }
+        size = static_cast<std::size_t>(info.st_size);
+
+        // Map the file (mapping stays valid after closing the descriptor)
+        void *mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if(mapping == MAP_FAILED)
+            return nullptr;
+
+        return std::shared_ptr<char>{ static_cast<char*>(mapping), [size](char *ptr) { ::munmap(ptr, size); } };
+    }
+
+    /**
+     * @brief Auxiliary class implementing sequential reading of the XML source
+     */
+    class Reader {
+
+    public:
+
+        /// Constructs reader of the source of the given @p size placed at @p source
+        Reader(char *source, std::size_t size) :
+            begin{ source },
+            pos{ source },
+            end{ source + size }
+        { }
+
+        /// @returns @c true if whole source has been read
+        bool eof() const { return pos >= end; }
+        /// @returns current character
+        char peek() const { return (pos < end) ? *pos : '\0'; }
+        /// @returns @c true if source at the current position starts with @p str
+        bool starts_with(std::string_view str) const {
+            return (static_cast<std::size_t>(end - pos) >= str.size()) and (std::memcmp(pos, str.data(), str.size()) == 0);
+        }
+
+        /// Skips @p n characters
+        void skip(std::size_t n = 1) { pos += n; }
+        /// Skips whitespaces
+        void skip_whitespaces() { while(pos < end and is_whitespace(*pos)) ++pos; }
+
+        /// Moves position past the next occurrence of the @p str (returns pointer to the occurrence)
+        char *skip_past(std::string_view str) {
+            auto *found = std::search(pos, end, str.begin(), str.end());
+            if(found == end)
+                error("unexpected end of file (expected '" + std::string{ str } + "')");
+            pos = found + str.size();
+            return found;
+        }
+
+        /// Moves position to the next occurrence of @p c
+        char *find(char c) {
+            auto *found = static_cast<char*>(std::memchr(pos, c, end - pos));
+            return (found == nullptr) ? end : found;
+        }
+
+        /// Reads XML name at the current position
+        std::string_view read_name() {
+            auto *name_begin = pos;
+            while(pos < end and not is_name_end(*pos))
+                ++pos;
+            if(pos == name_begin)
+                error("expected name");
+            return std::string_view{ name_begin, static_cast<std::size_t>(pos - name_begin) };
+        }
+
+        /// Expects @p c at the current position and skips it
+        void expect(char c) {
+            if(peek() != c)
+                error(std::string{ "expected '" } + c + "'");
+            ++pos;
+        }
+
+        /// Throws parsing error with the @p msg at the current position
+        [[noreturn]] void error(const std::string &msg) const {
+            auto line = std::count(begin, std::min(pos, end), '\n') + 1;
+            throw std::runtime_error{ "XML parsing error at line " + std::to_string(line) + ": " + msg };
+        }
+
+    public:
+
+        /// Beginning of the source
+        char *begin;
+        /// Current position
+        char *pos;
+        /// End of the source
+        char *end;
+
+    };
+
+}
+
+/* ===================================================== Public ctors & dtors ===================================================== */
+
+Document::Document() {
+    storage.emplace_back();
+    update_views();
+}
+
+/* ===================================================== Public static methods ==================================================== */
+
+std::shared_ptr<Document> Document::parse(std::string source) {
+
+    auto ret = std::make_shared<Document>();
+
+    // Take over the source and parse it
+    ret->source = std::move(source);
+    ret->parse_source(ret->source.data(), ret->source.size());
+
+    return ret;
+}
+
+
+std::shared_ptr<Document> Document::parse_file(const std::filesystem::path &path) {
+
+    // Parse file in place, if it can be mapped. Otherwise read it into the memory
+    auto ret = config::eni::MapSourceFiles ? parse_mapped_file(path) : nullptr;
+    if(ret == nullptr) {
+        auto source      = read_file(path);
+        auto source_hash = hash(source);
+        ret = parse(std::move(source));
+        ret->source_hash = source_hash;
+    }
+
+    // Keep track of the source file
+    ret->source_path = path;
+
+    return ret;
+}
+
+
+std::shared_ptr<Document> Document::parse_stream(std::istream &stream) {
+
+    // Read the whole stream
+    std::string source{ std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{ } };
+    if(stream.bad())
+        throw std::runtime_error{ "Failed to read XML stream" };
+
+    return parse(std::move(source));
+}
+
+
+std::shared_ptr<Document> Document::copy_subtree(const Document &doc, const Node &node) {
+
+    auto ret = std::make_shared<Document>();
+
+    // Helper copying string into the text of the new document
+    auto copy_string = [&ret](std::string_view str) {
+        auto offset = static_cast<index_type>(ret->source.size());
+        ret->source.append(str);
+        return offset;
+    };
+
+    // Offsets of keys already copied into the text of the new document (keys stay interned)
+    std::unordered_map<std::string_view, index_type> keys;
+
+    // Copy root's value
+    auto value = doc.get_value(node);
+    ret->storage[0].value_offset = copy_string(value);
+    ret->storage[0].value_size   = static_cast<index_type>(value.size());
+
+    // Helper copying children of the node
+    auto copy_children = [&](index_type dst, const Node &src, auto &self) -> void {
+        for(auto child = src.first_child; child != NO_NODE; child = doc.nodes[child].next_sibling) {
+
+            auto &child_node = doc.nodes[child];
+            auto child_key   = doc.get_key(child_node);
+            auto child_value = doc.get_value(child_node);
+
+            auto key          = keys.find(child_key);
+            auto key_offset   = (key != keys.end()) ? key->second : keys.emplace(child_key, copy_string(child_key)).first->second;
+            auto value_offset = copy_string(child_value);
+
+            auto index = ret->append_child(dst, 
+                key_offset,   static_cast<index_type>(child_key.size()), 
+                value_offset, static_cast<index_type>(child_value.size()));
+
+            self(index, child_node, self);
+        }
+    };
+    copy_children(0, node, copy_children);
+
+    ret->update_views();
+
+    return ret;
+}
+
+
+std::uint64_t Document::hash(std::string_view source) {
+
+    constexpr std::uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+    constexpr std::uint64_t FNV_PRIME  = 0x100000001b3ULL;
+
+    std::uint64_t ret = FNV_OFFSET ^ source.size();
+    std::size_t i = 0;
+
+    // Hash 8-byte words (FNV-1a over words with additional mixing of high bits)
+    for(; i + sizeof(std::uint64_t) <= source.size(); i += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, source.data() + i, sizeof(word));
+        ret  = (ret ^ word) * FNV_PRIME;
+        ret ^= (ret >> 29);
+    }
+
+    // Hash remaining bytes
+    for(; i < source.size(); ++i)
+        ret = (ret ^ static_cast<unsigned char>(source[i])) * FNV_PRIME;
+
+    return ret;
+}
+
+
+std::shared_ptr<Document> Document::map_image(const std::filesystem::path &path, std::uint64_t source_hash) {
+
+    // Map the image
+    std::size_t size;
+    auto mapping = map_file(path, size);
+    if(mapping == nullptr or size < sizeof(ImageHeader))
+        return nullptr;
+
+    auto ret = std::make_shared<Document>();
+    ret->mapping = mapping;
+
+    auto *data = mapping.get();
+
+    // Verify the header
+    ImageHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if(std::memcmp(header.magic, IMAGE_MAGIC, sizeof(IMAGE_MAGIC)) != 0 or
+       header.version     != IMAGE_VERSION                                or
+       header.source_hash != source_hash                                  or
+       header.nodes_num   == 0                                            or
+       header.nodes_num   >  (size - sizeof(ImageHeader)) / sizeof(Node))
+        return nullptr;
+
+    std::size_t text_offset = sizeof(ImageHeader) + header.nodes_num * sizeof(Node);
+    if(size - text_offset != header.text_size)
+        return nullptr;
+
+    auto *nodes = reinterpret_cast<Node*>(const_cast<char*>(data + sizeof(ImageHeader)));
+
+    // Helper verifying that the link points forward (backward) to the existing node
+    auto links_forward = [&header](std::size_t i, index_type link) {
+        return (link == NO_NODE) or (link > i and link < header.nodes_num);
+    };
+    auto links_backward = [](std::size_t i, index_type link) {
+        return (link == NO_NODE) or (link < i);
+    };
+
+    // Verify nodes (pre-order of nodes guarantees that traversing the tree terminates)
+    for(std::size_t i = 0; i < header.nodes_num; ++i) {
+
+        auto &node = nodes[i];
+
+        if(std::uint64_t{ node.key_offset }   + node.key_size   > header.text_size or
+           std::uint64_t{ node.value_offset } + node.value_size > header.text_size or
+           not links_forward(i, node.first_child)                                   or
+           not links_forward(i, node.last_child)                                    or
+           not links_forward(i, node.next_sibling)                                  or
+           not links_backward(i, node.prev_sibling)                                 or
+           not links_backward(i, node.parent)                                       or
+           (i != 0 and node.parent == NO_NODE))
+            return nullptr;
+    }
+
+    // Refer to the image
+    ret->storage.clear();
+    ret->text      = data + text_offset;
+    ret->nodes     = nodes;
+    ret->nodes_num = header.nodes_num;
+    ret->from_image = true;
+
+    return ret;
+}
+
+
+std::shared_ptr<Document> Document::parse_file_cached(
+    const std::filesystem::path &path,
+    const std::filesystem::path &image_path
+) {
+
+    std::shared_ptr<Document> ret;
+    std::uint64_t source_hash;
+
+    // Calculate hash of the source (mapping the source avoids copying it if image is up-to-date)
+    std::size_t source_size;
+    if(auto mapping = map_file(path, source_size); mapping != nullptr) {
+
+        source_hash = hash(std::string_view{ mapping.get(), source_size });
+
+        // Use the image, if up-to-date
+        if(ret = map_image(image_path, source_hash); ret != nullptr) {
+            ret->source_path = path;
+            ret->source_hash = source_hash;
+            return ret;
+        }
+
+        // Otherwise, parse the source in place
+        if constexpr(config::eni::MapSourceFiles) {
+            ret = std::make_shared<Document>();
+            ret->mapping = mapping;
+            ret->parse_source(mapping.get(), source_size);
+        } else
+            ret = parse(std::string{ mapping.get(), source_size });
+
+    // Read the source, if it could not be mapped
+    } else {
+
+        auto source = read_file(path);
+        source_hash = hash(source);
+
+        // Use the image, if up-to-date
+        if(ret = map_image(image_path, source_hash); ret != nullptr) {
+            ret->source_path = path;
+            ret->source_hash = source_hash;
+            return ret;
+        }
+
+        // Otherwise, parse the source
+        ret = parse(std::move(source));
+    }
+
+    ret->source_path = path;
+    ret->source_hash = source_hash;
+
+    // Update the image
+    try { ret->save_image(image_path, source_hash); }
+    catch(std::exception &) { }
+
+    return ret;
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+Document::ResolvedPath Document::resolve_path_slow(const Path &path, std::size_t first_slot) const {
+
+    ResolvedPath ret;
+
+    // Resolve subsequent keys of the path
+    ret.valid = true;
+    for(auto key : path) {
+        ret.symbols[ret.depth] = find_symbol(key);
+        ret.valid = ret.valid and ret.symbols[ret.depth].is_valid();
+        ++ret.depth;
+    }
+
+    // Cache the path in the first free entry (entries are never released, so readers need no locking)
+    for(std::size_t i = 0; i < RESOLVED_PATHS_CACHE_PROBES; ++i) {
+
+        auto &entry = resolved_paths[(first_slot + i) % RESOLVED_PATHS_CACHE_SIZE];
+
+        std::uint8_t expected = 0;
+        if(entry.state.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+            entry.hash     = path.hash();
+            entry.path     = path.str();
+            entry.resolved = ret;
+            entry.state.store(2, std::memory_order_release);
+            break;
+        }
+
+        // Stop if the path has been cached by another thread in the meantime
+        if(expected == 2 and entry.hash == path.hash() and entry.path == path.str())
+            break;
+    }
+
+    return ret;
+}
+
+
+Document::Symbol Document::find_symbol(std::string_view key) const {
+
+    // Build table of symbols on the first call
+    std::call_once(symbols_built, [this]{ build_symbols(); });
+
+    if(auto symbol = symbols.find(key); symbol != symbols.end())
+        return Symbol{ symbol->second, static_cast<index_type>(key.size()) };
+    else
+        return Symbol{ };
+}
+
+
+void Document::save_image(const std::filesystem::path &path, std::uint64_t source_hash) const {
+
+    // Copy of the nodes table referring to the compacted text
+    std::vector<Node> image_nodes(nodes, nodes + nodes_num);
+    // Compacted text
+    std::string image_text;
+
+    // Offsets of strings already stored in the compacted text
+    std::unordered_map<std::string_view, index_type> offsets;
+
+    // Helper storing (deduplicated) string in the compacted text
+    auto store_string = [&](std::string_view str) -> index_type {
+        if(auto it = offsets.find(str); it != offsets.end())
+            return it->second;
+        auto offset = static_cast<index_type>(image_text.size());
+        image_text.append(str);
+        offsets.emplace(str, offset);
+        return offset;
+    };
+
+    // Rewrite offsets of strings
+    for(auto &node : image_nodes) {
+        node.key_offset   = store_string(get_key(node));
+        node.value_offset = store_string(get_value(node));
+    }
+
+    // Prepare the header
+    ImageHeader header;
+    std::memcpy(header.magic, IMAGE_MAGIC, sizeof(IMAGE_MAGIC));
+    header.version     = IMAGE_VERSION;
+    header.source_hash = source_hash;
+    header.nodes_num   = image_nodes.size();
+    header.text_size   = image_text.size();
+
+    // Write the image to the temporary file
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+    {
+        std::ofstream file{ tmp_path, std::ios::binary | std::ios::trunc };
+        if(not file.is_open())
+            throw std::runtime_error{ "Failed to open '" + tmp_path.string() + "' file" };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(image_nodes.data()), image_nodes.size() * sizeof(Node));
+        file.write(image_text.data(), image_text.size());
+
+        if(not file.flush())
+            throw std::runtime_error{ "Failed to write '" + tmp_path.string() + "' file" };
+    }
+
+    // Replace the image
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if(ec) {
+        std::filesystem::remove(tmp_path, ec);
+        throw std::runtime_error{ "Failed to replace '" + path.string() + "' file" };
+    }
+}
+
+/* ======================================================= Private methods ======================================================== */
+
+std::shared_ptr<Document> Document::parse_mapped_file(const std::filesystem::path &path) {
+
+    // Map the file
+    std::size_t size;
+    auto mapping = map_file(path, size);
+    if(mapping == nullptr)
+        return nullptr;
+
+    auto ret = std::make_shared<Document>();
+
+    // Parse the mapping in place (document holds the mapping for its whole lifetime; source is
+    // hashed before parsing modifies it)
+    ret->mapping     = mapping;
+    ret->source_hash = hash(std::string_view{ mapping.get(), size });
+    ret->parse_source(mapping.get(), size);
+
+    return ret;
+}
+
+
+void Document::parse_source(char *begin, std::size_t size) {
+
+    // Verify that offsets of strings fit into the index type
+    if(size >= AUXILIARY_FLAG)
+        throw std::runtime_error{ "XML source is too large" };
+
+    Reader reader{ begin, size };
+
+    // Reserve space for nodes (upper estimate based on number of tags and attributes)
+    storage.reserve(1 + std::count_if(begin, begin + size, [](char c) { return (c == '<') or (c == '='); }));
+
+    // Helper calculating offset of the string placed in the source
+    auto offset_of = [begin](std::string_view str) {
+        return str.empty() ? index_type{ 0 } : static_cast<index_type>(str.data() - begin);
+    };
+
+    // Offset of the attributes key in the auxiliary buffer (appended on the first use)
+    auto attributes_key_offset = NO_NODE;
+
+    // Helper appending child with the given key and value (keys are interned)
+    auto append = [&](index_type parent, std::string_view key, std::string_view value = { }) {
+        return append_child(parent,
+            symbols.try_emplace(key, offset_of(key)).first->second, static_cast<index_type>(key.size()), 
+            offset_of(value),                                       static_cast<index_type>(value.size()));
+    };
+
+    // Helper appending text segment to the node's value
+    auto append_text = [&](index_type index, std::string_view text) {
+
+        // Skip whitespace-only segments (formatting of the XML file)
+        if(is_whitespace(text))
+            return;
+
+        auto &node = storage[index];
+
+        // If node has no value yet, refer directly to the text
+        if(node.value_size == 0) {
+            node.value_offset = offset_of(text);
+            node.value_size   = static_cast<index_type>(text.size());
+        // Otherwise concatenate segments in the auxiliary buffer
+        } else {
+
+            auto value = (node.value_offset & AUXILIARY_FLAG) ?
+                std::string{ auxiliary, node.value_offset & ~AUXILIARY_FLAG, node.value_size } :
+                std::string{ begin + node.value_offset, node.value_size };
+
+            node.value_offset = static_cast<index_type>(auxiliary.size()) | AUXILIARY_FLAG;
+            node.value_size   = static_cast<index_type>(value.size() + text.size());
+            auxiliary.append(value).append(text);
+        }
+    };
+
+    // Node currently being parsed
+    index_type current = 0;
+
+    while(not reader.eof()) {
+
+        // Parse markup
+        if(reader.peek() == '<') {
+
+            // Skip processing instructions (including XML declaration)
+            if(reader.starts_with("<?")) {
+                reader.skip_past("?>");
+
+            // Skip comments
+            } else if(reader.starts_with("<!--")) {
+                reader.skip_past("-->");
+
+            // Parse CDATA sections
+            } else if(reader.starts_with("<![CDATA[")) {
+                reader.skip(9);
+                auto *text_begin = reader.pos;
+                auto *text_end   = reader.skip_past("]]>");
+                if(current != 0)
+                    append_text(current, std::string_view{ text_begin, static_cast<std::size_t>(text_end - text_begin) });
+
+            // Skip DOCTYPE (with optional internal subset)
+            } else if(reader.starts_with("<!")) {
+                auto *bracket = reader.find('[');
+                auto *closing = reader.find('>');
+                if(bracket < closing) {
+                    reader.pos = bracket;
+                    reader.skip_past("]");
+                }
+                reader.skip_past(">");
+
+            // Parse closing tag
+            } else if(reader.starts_with("</")) {
+                reader.skip(2);
+                auto name = reader.read_name();
+                if(current == 0 or name != std::string_view{ begin + storage[current].key_offset, storage[current].key_size })
+                    reader.error("unexpected closing tag '" + std::string{ name } + "'");
+                reader.skip_whitespaces();
+                reader.expect('>');
+                current = storage[current].parent;
+
+            // Parse opening tag
+            } else {
+
+                reader.skip();
+                auto node       = append(current, reader.read_name());
+                auto attributes = NO_NODE;
+
+                // Parse attributes
+                while(true) {
+
+                    reader.skip_whitespaces();
+
+                    // Parse end of the empty element
+                    if(reader.starts_with("/>")) {
+                        reader.skip(2);
+                        break;
+                    // Parse end of the opening tag
+                    } else if(reader.peek() == '>') {
+                        reader.skip();
+                        current = node;
+                        break;
+                    } else if(reader.eof()) {
+                        reader.error("unexpected end of file");
+                    }
+
+                    // Parse attribute's name
+                    auto name = reader.read_name();
+                    reader.skip_whitespaces();
+                    reader.expect('=');
+                    reader.skip_whitespaces();
+
+                    // Parse attribute's value
+                    auto quote = reader.peek();
+                    if(quote != '"' and quote != '\'')
+                        reader.error("expected quoted attribute value");
+                    reader.skip();
+                    auto *value_begin = reader.pos;
+                    auto *value_end   = reader.skip_past(std::string_view{ &quote, 1 });
+
+                    // Create attributes node, if needed (its key is stored in the auxiliary buffer)
+                    if(attributes == NO_NODE) {
+                        if(attributes_key_offset == NO_NODE) {
+                            attributes_key_offset = static_cast<index_type>(auxiliary.size()) | AUXILIARY_FLAG;
+                            auxiliary.append(ATTRIBUTES_KEY);
+                        }
+                        attributes = append_child(node, attributes_key_offset, static_cast<index_type>(ATTRIBUTES_KEY.size()));
+                    }
+
+                    append(attributes, name, decode_entities(value_begin, value_end));
+                }
+            }
+
+        // Parse text
+        } else {
+
+            auto *text_begin = reader.pos;
+            auto *text_end   = reader.find('<');
+            reader.pos = text_end;
+
+            // Text outside of the root element is ignored
+            if(current != 0)
+                append_text(current, decode_entities(text_begin, text_end));
+        }
+    }
+
+    // Verify that all elements have been closed
+    if(current != 0)
+        reader.error("unexpected end of file (unclosed element '" + 
+            std::string{ begin + storage[current].key_offset, storage[current].key_size } + "')");
+
+    // Place auxiliary strings right after the source (in the space of offsets)
+    if(size + auxiliary.size() >= AUXILIARY_FLAG)
+        throw std::runtime_error{ "XML source is too large" };
+    auxiliary_base = static_cast<index_type>(size);
+
+    // Relocate offsets of auxiliary strings
+    if(not auxiliary.empty()) {
+        for(auto &node : storage) {
+            if(node.key_offset & AUXILIARY_FLAG)
+                node.key_offset = (node.key_offset & ~AUXILIARY_FLAG) + auxiliary_base;
+            if(node.value_offset & AUXILIARY_FLAG)
+                node.value_offset = (node.value_offset & ~AUXILIARY_FLAG) + auxiliary_base;
+        }
+    }
+
+    // Intern key of attributes nodes (table of symbols is complete now)
+    if(attributes_key_offset != NO_NODE)
+        symbols.emplace(ATTRIBUTES_KEY, (attributes_key_offset & ~AUXILIARY_FLAG) + auxiliary_base);
+    std::call_once(symbols_built, []{ });
+
+    // Refer to the parsed source
+    text      = begin;
+    nodes     = storage.data();
+    nodes_num = storage.size();
+}
+
+
+Document::index_type Document::append_child(
+    index_type parent,
+    index_type key_offset,
+    index_type key_size,
+    index_type value_offset,
+    index_type value_size
+) {
+
+    auto index = static_cast<index_type>(storage.size());
+    auto &node = storage.emplace_back();
+
+    // Initialize node
+    node.key_offset   = key_offset;
+    node.key_size     = key_size;
+    node.value_offset = value_offset;
+    node.value_size   = value_size;
+    node.parent       = parent;
+    node.prev_sibling = storage[parent].last_child;
+
+    // Link node to the parent
+    if(storage[parent].last_child != NO_NODE)
+        storage[storage[parent].last_child].next_sibling = index;
+    else
+        storage[parent].first_child = index;
+    storage[parent].last_child    = index;
+    storage[parent].children_num += 1;
+
+    return index;
+}
+
+
+void Document::build_symbols() const {
+
+    // Keys of nodes are interned, so it is enough to note offset of the first occurrence of each key
+    for(std::size_t i = 1; i < nodes_num; ++i)
+        symbols.try_emplace(get_key(nodes[i]), nodes[i].key_offset);
+}
+
+
+void Document::update_views() {
+    text      = source.data();
+    nodes     = storage.data();
+    nodes_num = storage.size();
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni::details
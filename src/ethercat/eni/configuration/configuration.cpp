@@ -14,7 +14,14 @@
 
 /* =========================================================== Includes =========================================================== */
 
+// Standard includes
+#include <algorithm>
+#include <array>
+#include <unordered_map>
 // Private includes
+#include "ethercat/config.hpp"
+#include "ethercat/common/utilities/bit.hpp"
+#include "ethercat/common/utilities/enum.hpp"
 #include "ethercat/eni/configuration.hpp"
 
 /* ========================================================== Namespaces ========================================================== */
@@ -24,46 +31,56 @@ namespace ethercat::eni {
 /* ============================================================ Helpers =========================================================== */
 
 namespace details {
-    
+
     /**
-     * @brief Helper STL-like algorithm checking whether range whose elements has been transformed with 
-     *    @p transformation stores only unique values (i.e. is a set) and returning iterator to the first
-     *    non-unique element, if found
-     * 
-     * @tparam InputIt 
-     *    type of range's iterators
-     * @tparam TransformationT 
-     *    type of the @p transformation
-     * @param begin 
-     *    begin of the range
-     * @param end
-     *    end of the range
-     * @param transformation
-     *    target transformation
+     * @brief Helper class detecting non-unique keys of the list's elements in a single pass 
+     *    with use of the hash map
      * 
-     * @retval it 
-     *    iterator to the first non-unique element, if found
-     * @retval end 
-     *    if no non-unique element found
+     * @tparam KeyT 
+     *    type of the key
      */
-    template<typename InputIt, typename TransformationT>
-    static constexpr InputIt find_first_non_unique_transformed(InputIt begin, InputIt end, TransformationT transformation) {
-
-        // Iterate over range
-        for(auto it = begin; it != end; ++it) {
-            
-            // Transform current element
-            auto it_transformed = transformation(*it);
-            // Iterate over left elements (@note copy of it is made to limti requirements on InputIt to being a forward iterator)
-            for(auto it_copy = it, rit = ++it_copy; rit != end; ++rit) {
-                // If transformations are equal, return element
-                if(it_transformed == transformation(*rit))
-                    return it;
-            }
+    template<typename KeyT>
+    class UniquenessChecker {
+    public:
+
+        /**
+         * @param key 
+         *    key of the element at the @p index position
+         * @param index 
+         *    position of the element in the list
+         * @returns 
+         *    position of the first element with the same @p key or @c std::nullopt if 
+         *    @p key has not been seen before
+         */
+        std::optional<std::size_t> check(KeyT key, std::size_t index) {
+
+            // Remember the first occurrence of the key
+            auto [it, inserted] = positions.try_emplace(std::move(key), index);
+            if(inserted)
+                return std::optional<std::size_t>{ };
+
+            // Track the first element with a non-unique key
+            first_non_unique = std::min(first_non_unique.value_or(it->second), it->second);
+
+            return it->second;
         }
-        
-        // If no equality found, return end
-        return end;
+
+        /// Position of the first element whose key is non-unique (if found)
+        std::optional<std::size_t> first_non_unique;
+
+    private:
+
+        /// Positions of first elements with the given keys
+        std::unordered_map<KeyT, std::size_t> positions;
+
+    };
+
+    /**
+     * @brief Mapping of the slave's PDO direction into the corresponding direction of the PDI
+     */
+    constexpr ProcessImage::Direction pdi_direction(Slave::Pdo::Direction dir) {
+        return (dir == Slave::Pdo::Direction::Inputs) ?
+            ProcessImage::Direction::Inputs : ProcessImage::Direction::Outputs;
     }
 
 }
@@ -71,22 +88,23 @@ namespace details {
 /* ======================================================== Public methods ======================================================== */
 
 std::optional<Slave> Configuration::get_slave(std::string_view name) const {
-    
-    using namespace std::literals::string_literals;
 
-    // Iterate over configruation nodes
-    for (const auto &elem : *this) {
+    // Build index of slaves on the first call
+    if(not slaves_index) {
 
-        // Check if <Slave> tag retrived
-        if (elem.first != "Slave")
-            continue;
+        auto index = std::make_shared<common::utilities::StringMap<Slave>>();
+
+        // Index slaves by names (the first slave of the given name takes precedence)
+        for(auto &slave : get_slaves())
+            index->try_emplace(slave.get_name(), slave);
 
-        // Check whether slave found
-        if (elem.second.get_child_value<std::string>("Info.Name") == name)
-            return static_cast<Slave>(elem.second);
-            
+        slaves_index = std::move(index);
     }
 
+    // Find the slave
+    if(auto slave = slaves_index->find(name); slave != slaves_index->end())
+        return slave->second;
+
     // If slave not found, return empty optional
     return std::optional<Slave>{};
 }
@@ -97,15 +115,35 @@ std::vector<Slave> Configuration::get_slaves() const {
     // Preapre return vector
     std::vector<Slave> ret;
 
-    // Iterate over configruation nodes
-    for (const auto &elem : *this) {
+    // Iterate over configruation nodes (with borrowed views)
+    for (const auto elem : view()) {
 
         // Check if <Slave> tag retrived
-        if (elem.first != "Slave")
+        if (elem.get_key() != "Slave")
             continue;
 
         // Add slave's description to the output
-        ret.push_back(elem.second);
+        ret.push_back(make_element(elem));
+    }
+
+    return ret;
+}
+
+
+std::vector<Cyclic> Configuration::get_cyclics() const {
+
+    // Preapre return vector
+    std::vector<Cyclic> ret;
+
+    // Iterate over configruation nodes (with borrowed views)
+    for (const auto elem : view()) {
+
+        // Check if <Cyclic> tag retrived
+        if (elem.get_key() != "Cyclic")
+            continue;
+
+        // Add cyclic description to the output
+        ret.push_back(make_element(elem));
     }
 
     return ret;
@@ -119,15 +157,15 @@ std::vector<std::string> Configuration::list_slaves() const {
     // Preapre return vector
     std::vector<std::string> ret;
 
-    // Iterate over configruation nodes
-    for (const auto &elem : *this) {
+    // Iterate over configruation nodes (with borrowed views)
+    for (const auto elem : view()) {
 
         // Check if <Slave> tag retrived
-        if (elem.first != "Slave")
+        if (elem.get_key() != "Slave")
             continue;
 
         // Parse slave's name
-        auto name = elem.second.get_child_value<std::string>("Info.Name");
+        auto name = elem.get_child_value<std::string>(details::paths::INFO_NAME);
         //  Add slave's name to the result list
         ret.push_back(name);
         
@@ -142,27 +180,155 @@ std::optional<Slave> Configuration::are_slaves_unique() const {
     // Get list of slaves on the bus
     auto slave_eni_list = get_slaves();
 
-    // Check if slaves have unique names
-    if(auto elem = details::find_first_non_unique_transformed(slave_eni_list.begin(), slave_eni_list.end(), 
-        [](const auto &slave_config) { return slave_config.get_name(); }
-    ); elem != slave_eni_list.end())
-        return *elem;
+    details::UniquenessChecker<std::string> names;
+    details::UniquenessChecker<std::size_t> physical_addrs;
+    details::UniquenessChecker<std::size_t> auto_increment_addrs;
 
-    // Check if slaves have unique physical adresses
-    if(auto elem = details::find_first_non_unique_transformed(slave_eni_list.begin(), slave_eni_list.end(), 
-        [](const auto &slave_config) { return slave_config.get_physical_addr(); }
-    ); elem != slave_eni_list.end())
-        return *elem;
+    // Check uniqueness of all slaves' identifiers in a single pass
+    for(std::size_t i = 0; i < slave_eni_list.size(); ++i) {
+        names.check(slave_eni_list[i].get_name(), i);
+        physical_addrs.check(slave_eni_list[i].get_physical_addr(), i);
+        auto_increment_addrs.check(slave_eni_list[i].get_auto_increment_addr(), i);
+    }
 
-    // Check if slaves have unique auto-increment adresses
-    if(auto elem = details::find_first_non_unique_transformed(slave_eni_list.begin(), slave_eni_list.end(), 
-        [](const auto &slave_config) { return slave_config.get_auto_increment_addr(); }
-    ); elem != slave_eni_list.end())
-        return *elem;
+    // Report the first non-unique slave (names are verified first, then physical and auto-increment addresses)
+    for(const auto &first_non_unique : { names.first_non_unique, physical_addrs.first_non_unique, auto_increment_addrs.first_non_unique }) {
+        if(first_non_unique.has_value())
+            return slave_eni_list[*first_non_unique];
+    }
 
     return std::optional<Slave>{ };
 }
 
+
+ValidationReport Configuration::validate() const {
+
+    using IssueType = ValidationReport::IssueType;
+    using namespace common::utilities::bit;
+
+    ValidationReport report;
+
+    // Get list of slaves on the bus
+    auto slave_eni_list = get_slaves();
+    // Build index of the PDI variables
+    auto process_image = get_process_image();
+    const auto &pdi_index = process_image.get_index();
+
+    details::UniquenessChecker<std::string> names;
+    details::UniquenessChecker<std::size_t> physical_addrs;
+    details::UniquenessChecker<std::size_t> auto_increment_addrs;
+
+    // Bit range of the PDI variable mapped by the PDO entry
+    struct MappedRange {
+        std::size_t begin;
+        std::size_t end;
+        const ProcessImage::Variable *variable;
+    };
+
+    // Bit ranges of mapped variables (for subsequent PDI directions)
+    std::array<std::vector<MappedRange>, 2> mapped_ranges;
+
+    for(std::size_t i = 0; i < slave_eni_list.size(); ++i) {
+
+        const auto &slave = slave_eni_list[i];
+        auto slave_name    = slave.get_name();
+
+        // Check uniqueness of the slave's identifiers
+        if(auto first = names.check(slave_name, i); first.has_value()) {
+            report.add_issue(IssueType::NonUniqueName, slave_name, { }, { },
+                "name is shared with the slave #" + std::to_string(*first));
+        }
+        if(auto first = physical_addrs.check(slave.get_physical_addr(), i); first.has_value()) {
+            report.add_issue(IssueType::NonUniquePhysicalAddr, slave_name, { }, { },
+                "physical address (" + std::to_string(slave.get_physical_addr()) + ") is shared with the slave '" 
+                + slave_eni_list[*first].get_name() + "'");
+        }
+        if(auto first = auto_increment_addrs.check(slave.get_auto_increment_addr(), i); first.has_value()) {
+            report.add_issue(IssueType::NonUniqueAutoIncrementAddr, slave_name, { }, { },
+                "auto-increment address (" + std::to_string(slave.get_auto_increment_addr()) + ") is shared with the slave '" 
+                + slave_eni_list[*first].get_name() + "'");
+        }
+
+        auto pdos = slave.get_pdos();
+
+        // Cross-check entries of assigned PDOs against the PDI
+        for(const auto *pdos_list : { &pdos.inputs, &pdos.outputs }) {
+            for(const auto &pdo : pdos_list->get_assigned()) {
+
+                auto pdo_name = pdo.get_name();
+                auto dir      = details::pdi_direction(pdo.get_direction());
+
+                for(const auto &entry : pdo.get_entries()) {
+
+                    auto entry_name = entry.get_name();
+                    
+                    // Find description of corresponding PDI variable
+                    const auto *variable = pdi_index.get_entry(dir, slave_name, pdo_name, entry_name);
+                    if(variable == nullptr) {
+                        report.add_issue(IssueType::MissingVariable, slave_name, pdo_name, entry_name,
+                            "no matching variable in the PDI description");
+                        continue;
+                    }
+
+                    // Keep track of the mapped bit range
+                    if(variable->bit_size != 0) {
+                        mapped_ranges[common::utilities::to_underlying(dir)].push_back(MappedRange{ 
+                            variable->bit_offset, variable->bit_offset + variable->bit_size, &variable->variable });
+                    }
+
+                    // Check if data types match
+                    if(auto type = entry.get_data_type(); type != variable->type) {
+                        report.add_issue(IssueType::TypeMismatch, slave_name, pdo_name, entry_name,
+                            "type in <Slave> description (" + std::string{ type.get_name() } + ") differs from "
+                            "type in <ProcessImage> description (" + std::string{ variable->type.get_name() } + ")");
+                    }
+
+                    // Check if bit sizes match
+                    if(auto bit_len = entry.get_bit_len(); bit_len != variable->bit_size) {
+                        report.add_issue(IssueType::BitSizeMismatch, slave_name, pdo_name, entry_name,
+                            "bitsize in <Slave> description (" + std::to_string(bit_len) + ") differs from "
+                            "bitsize in <ProcessImage> description (" + std::to_string(variable->bit_size) + ")");
+                    }
+
+                    // Check if data is byte-aligned in PDI (if bit-aligned data support is disabled)
+                    if constexpr(not config::BitAlignedPdoSupport) {
+                        if(variable->bit_size % BITS_IN_BYTE != 0 or variable->bit_offset % BITS_IN_BYTE != 0) {
+                            report.add_issue(IssueType::UnalignedVariable, slave_name, pdo_name, entry_name,
+                                "variable is not byte-aligned in the PDI (bitoffset: " + std::to_string(variable->bit_offset) 
+                                + ", bitsize: " + std::to_string(variable->bit_size) + ") although bit-aligned data support "
+                                "is disabled");
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Check that bit ranges of mapped entries do not overlap in the PDI
+    for(auto &ranges : mapped_ranges) {
+
+        // Sort ranges by offset, so that only the range reaching the furthest so far needs to be checked
+        std::stable_sort(ranges.begin(), ranges.end(),
+            [](const auto &lhs, const auto &rhs) { return lhs.begin < rhs.begin; });
+
+        const MappedRange *furthest = nullptr;
+        for(const auto &range : ranges) {
+
+            if(furthest != nullptr and range.begin < furthest->end) {
+                report.add_issue(IssueType::OverlappingVariables, range.variable->get_slave_name(), 
+                    range.variable->get_pdo_name(), range.variable->get_name(),
+                    "bit range [" + std::to_string(range.begin) + ", " + std::to_string(range.end) + ") overlaps with "
+                    "variable '" + furthest->variable->get_fq_name() + "'");
+            }
+
+            if(furthest == nullptr or range.end > furthest->end)
+                furthest = &range;
+        }
+    }
+
+    return report;
+}
+
 /* ================================================================================================================================ */
 
 } // End namespace ethercat::eni
@@ -0,0 +1,126 @@
+/* ============================================================================================================================ *//**
+ * @file       cyclic.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:46:26 pm
+ * @modified   Sunday, 18th October 2026 12:46:26 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of methods of the Cyclic class implementing parsing interface of the <Cyclic> tag of the ENI
+ *             (EtherCAT Network Informations) tag
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <stdexcept>
+// Private includes
+#include "ethercat/eni/cyclic.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* =========================================================== Helpers ============================================================ */
+
+namespace {
+
+    /**
+     * @param state 
+     *    name of the ESM state in the ENI notation (e.g. 'PREOP')
+     * @returns 
+     *    flag corresponding to the @p state
+     * 
+     * @throws std::runtime_error
+     *    if @p state is not a valid name of the ESM state
+     */
+    uint8_t parse_state(std::string_view state) {
+        if(state == "INIT")
+            return static_cast<uint8_t>(Cyclic::State::Init);
+        else if(state == "PREOP")
+            return static_cast<uint8_t>(Cyclic::State::Preop);
+        else if(state == "BOOT")
+            return static_cast<uint8_t>(Cyclic::State::Bootstrap);
+        else if(state == "SAFEOP")
+            return static_cast<uint8_t>(Cyclic::State::Safeop);
+        else if(state == "OP")
+            return static_cast<uint8_t>(Cyclic::State::Op);
+        else
+            throw std::runtime_error{ "Invalid ESM state (" + std::string{ state } + ")" };
+    }
+
+    /**
+     * @param elem 
+     *    <Cmd> element of the cyclic frame
+     * @returns 
+     *    parsed description of the command
+     */
+    Cyclic::Command parse_command(const ElementView &elem) {
+
+        Cyclic::Command ret;
+
+        // Parse type of the datagram
+        auto type = elem.get_child_value<unsigned>(details::paths::CMD);
+        if(type > static_cast<unsigned>(Cyclic::CommandType::FRMW))
+            throw std::runtime_error{ "Invalid command type (" + std::to_string(type) + ")" };
+        ret.type = static_cast<Cyclic::CommandType>(type);
+
+        // Parse address of the datagram (logical address or ADP/ADO pair)
+        if(auto addr = elem.get_child_value_or_empty<uint32_t>(details::paths::ADDR); addr.has_value()) {
+            ret.address = *addr;
+        } else {
+            ret.address = 
+                (static_cast<uint32_t>(elem.get_child_value_or<uint16_t>(details::paths::ADP, 0))      ) |
+                (static_cast<uint32_t>(elem.get_child_value_or<uint16_t>(details::paths::ADO, 0)) << 16);
+        }
+
+        // Parse data layout of the datagram
+        ret.data_length   = elem.get_child_value<std::size_t>(details::paths::DATA_LENGTH);
+        ret.input_offset  = elem.get_child_value_or<std::size_t>(details::paths::INPUT_OFFS, 0);
+        ret.output_offset = elem.get_child_value_or<std::size_t>(details::paths::OUTPUT_OFFS, 0);
+        ret.expected_wkc  = elem.get_child_value_or<uint16_t>(details::paths::CNT, 0);
+
+        // Parse states that the command is sent in
+        ret.states = 0;
+        for(const auto child : elem) {
+            if(child.get_key() == "State")
+                ret.states |= parse_state(child.get_value<std::string_view>());
+        }
+
+        return ret;
+    }
+
+}
+
+/* ======================================================== Public methods ======================================================== */
+
+std::vector<Cyclic::Frame> Cyclic::get_frames() const {
+    return wrap_error([&]{
+
+        std::vector<Frame> ret;
+
+        // Iterate over <Frame> subelements of the <Cyclic> element
+        for(const auto frame : view()) {
+
+            if(frame.get_key() != "Frame")
+                continue;
+
+            auto &parsed_frame = ret.emplace_back();
+
+            // Parse <Cmd> subelements of the frame
+            for(const auto cmd : frame) {
+                if(cmd.get_key() == "Cmd")
+                    parsed_frame.commands.push_back(parse_command(cmd));
+            }
+        }
+
+        return ret;
+
+    }, "ethercat::eni::Cyclic::get_frames()");
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
@@ -30,18 +30,52 @@ ProcessImage::VariablesList ProcessImage::get_variables(Direction direction) con
     VariablesList ret;
 
     // Select target PDI
-    auto pdi_element = (direction == Direction::Inputs) ? "Inputs" : "Outputs";
+    const auto &pdi_element = (direction == Direction::Inputs) ? details::paths::INPUTS : details::paths::OUTPUTS;
 
     // Iterate over child elements
-    for(const auto &element : get_child(pdi_element)) {
+    for(const auto element : view().get_child(pdi_element)) {
         // If mapping element given, add entry to the return value
-        if(element.first == "Variable")
-            ret.emplace_back(static_cast<Variable>(element.second));
+        if(element.get_key() == "Variable")
+            ret.emplace_back(static_cast<Variable>(make_element(element)));
     }
 
     return ret;
 }
 
+/* ================================================= Index: Private ctors & dtors ================================================= */
+
+ProcessImage::Index::Index(const ProcessImage &process_image) :
+    variables{ process_image.get_variables() }
+{
+    // Helper indexing variables of the given direction
+    auto index_variables = [this](Direction direction, const VariablesList &direction_variables) {
+        for(const auto &variable : direction_variables) {
+
+            // Index only slave variables
+            if(not variable.is_slave_variable())
+                continue;
+
+            auto &slave = slaves[variable.names.slave_name];
+            auto &pdo   = slave.pdos[common::utilities::to_underlying(direction)][variable.names.pdo_name];
+
+            // Add variable to slave's and PDO's lists
+            (direction == Direction::Inputs ? slave.variables.inputs : slave.variables.outputs).push_back(variable);
+            pdo.variables.push_back(variable);
+
+            // Parse description of the variable (first variable of the given name takes precedence)
+            pdo.entries.try_emplace(variable.names.name, Entry{
+                .variable   = variable,
+                .bit_offset = variable.get_bit_offset(),
+                .bit_size   = variable.get_bit_size(),
+                .type       = variable.get_data_type()
+            });
+        }
+    };
+
+    index_variables(Direction::Inputs,  variables.inputs);
+    index_variables(Direction::Outputs, variables.outputs);
+}
+
 /* ================================================================================================================================ */
 
 } // End namespace ethercat::eni
@@ -29,7 +29,7 @@ ProcessImage::Variable::Variable(const Element &elem) :
     Element{ elem }
 { 
     // Get name string
-    auto name_str = get_child_value<std::string>("Name");
+    auto name_str = get_child_value<std::string>(details::paths::NAME);
     // Count dot-delimiters in the string
     auto delimiters_num = std::count(name_str.begin(), name_str.end(), '.');
 
@@ -54,6 +54,23 @@ ProcessImage::Variable::Variable(const Element &elem) :
         default: type = Type::Other; break;
 
     }
+
+    // Split the name into fields once
+    auto fields = details::split_variable_name(name_str);
+    // Helper returning field of the given index (empty if name has not enough fields)
+    auto field = [&fields](std::size_t idx) {
+        return (idx < fields.size()) ? fields[idx] : std::string{ };
+    };
+
+    if(type == Type::Slave)
+        names.slave_name = field(details::SlaveVariableNamingScheme::SLAVE_NAME_FIELD_IDX);
+    names.pdo_name = field((type == Type::Master) ? 
+        details::MasterVariableNamingScheme::PDO_NAME_FIELD_IDX : 
+        details::SlaveVariableNamingScheme::PDO_NAME_FIELD_IDX);
+    names.name = field((type == Type::Master) ? 
+        details::MasterVariableNamingScheme::VARIABLE_NAME_FIELD_IDX : 
+        details::SlaveVariableNamingScheme::VARIABLE_NAME_FIELD_IDX);
+    names.fq_name = std::move(name_str);
 }
 
 /* ================================================================================================================================ */
@@ -0,0 +1,126 @@
+/* ============================================================================================================================ *//**
+ * @file       init_cmd.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:31:40 am
+ * @modified   Sunday, 18th October 2026 12:33:44 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of methods of the InitCmd class implementing parsing interface of the <InitCmd> tag of the ENI
+ *             (EtherCAT Network Informations) tag
+ * 
+ * 
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <charconv>
+#include <sstream>
+// Private includes
+#include "ethercat/eni/common/helpers.hpp"
+#include "ethercat/eni/slave.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* ==================================================== InitCmd: Public methods =================================================== */
+
+std::vector<std::string> Slave::InitCmd::get_transitions() const {
+        
+    std::vector<std::string> ret;
+    
+    // Iterate over <Transition> subelements of the command
+    for(const auto elem : view()) {
+        if(elem.get_key() == "Transition")
+            ret.push_back(elem.get_value<std::string>());
+    }
+
+    return ret;
+}
+
+
+bool Slave::InitCmd::has_transition(std::string_view transition) const {
+    
+    // Iterate over <Transition> subelements of the command
+    for(const auto elem : view()) {
+        if(elem.get_key() == "Transition" and elem.get_value<std::string_view>() == transition)
+            return true;
+    }
+
+    return false;
+}
+
+
+bool Slave::InitCmd::is_fixed() const {
+
+    // If element has <Fixed> attribute (determining whether command id fixed), return parsed value
+    if(auto attribute = get_child_or_empty(details::paths::FIXED_ATTRIBUTE); attribute.has_value())
+        return (attribute->get_value<std::string>() == "true");
+
+    // Otherwise return false
+    return false;
+}
+
+
+bool Slave::InitCmd::is_complete_access() const {
+
+    // If element has <CompleteAccess> attribute (determining whether command uses Complete Access), return parsed value
+    if(auto attribute = get_child_or_empty(details::paths::COMPLETE_ACCESS_ATTRIBUTE); attribute.has_value())
+        return (attribute->get_value<std::string>() == "true");
+
+    // Otherwise return false
+    return false;
+}
+
+
+std::size_t Slave::InitCmd::get_index() const {
+
+    auto index = get_child_value<std::string>(details::paths::INDEX);
+
+    // Index of the CoE init command is usually given as a decimal number, but hex notation is accepted as well
+    if(index.starts_with("#x"))
+        return parse_index(index);
+    else
+        return get_child_value<std::size_t>(details::paths::INDEX);
+}
+
+
+std::vector<uint8_t> Slave::InitCmd::get_data() const {
+
+    auto data = get_child_value_or<std::string>(details::paths::DATA, std::string{ });
+
+    // Data is expected to be given as a string of hex digits pairs
+    if(data.size() % 2 != 0) {
+        std::stringstream ss;
+        ss << "[ethercat::eni::Slave::InitCmd::get_data] Invalid data of the CoE init command "
+           << "(odd number of hex digits in '" << data << "')";
+        throw Error{ ss.str() };
+    }
+
+    std::vector<uint8_t> ret(data.size() / 2);
+
+    // Parse subsequent bytes
+    for(std::size_t i = 0; i < ret.size(); ++i) {
+
+        auto begin = data.data() + 2 * i;
+        auto end   = begin + 2;
+
+        // Parse byte
+        auto [ptr, ec] = std::from_chars(begin, end, ret[i], 16);
+        // On failure, throw error
+        if(ec != std::errc{ } or ptr != end) {
+            std::stringstream ss;
+            ss << "[ethercat::eni::Slave::InitCmd::get_data] Invalid data of the CoE init command "
+               << "(non-hex digits in '" << data << "')";
+            throw Error{ ss.str() };
+        }
+    }
+
+    return ret;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
@@ -29,22 +29,9 @@ namespace ethercat::eni {
 
 std::optional<std::size_t> Slave::Pdo::get_sync_manager() const {
     
-    /// Check if PDO element has XML attributes
-    if(has_child(ATTRIBUTES_CHILD)) {
-
-        // Get reference to the XML attributes node
-        auto &attributes = get_child(ATTRIBUTES_CHILD);
-        
-        // Name of the XML attribute of the <TxPdo/RxPdo> determining index of the SyncManager PDO is assigned to
-        constexpr auto SYNC_MANAGER_ATTRIBUTE_NAME = "Sm";
-
-        // If element has <Sm> attribute, return parsed value
-        if(attributes.has_child(SYNC_MANAGER_ATTRIBUTE_NAME)) {
-            return std::optional<std::size_t>{ 
-                attributes.get_child_value<std::size_t>(SYNC_MANAGER_ATTRIBUTE_NAME)
-            };
-        }
-    }
+    // If element has <Sm> attribute (determining index of the SyncManager PDO is assigned to), return parsed value
+    if(auto attribute = get_child_or_empty(details::paths::SM_ATTRIBUTE); attribute.has_value())
+        return std::optional<std::size_t>{ attribute->get_value<std::size_t>() };
 
     // Otherwise return empty result
     return std::optional<std::size_t>{ };
@@ -53,20 +40,9 @@ std::optional<std::size_t> Slave::Pdo::get_sync_manager() const {
 
 bool Slave::Pdo::is_fixed() const {
 
-    /// Check if PDO element has XML attributes
-    if(has_child(ATTRIBUTES_CHILD)) {
-
-        // Get reference to the XML attributes node
-        auto &attributes = get_child(ATTRIBUTES_CHILD);
-
-        // Name of the XML attribute of the <TxPdo/RxPdo> determining whether PDO id fixed
-        constexpr auto FIXED_ATTRIBUTE_NAME = "Fixed";
-
-        // If element has <Fixed> attribute, return parsed value
-        if(attributes.has_child(FIXED_ATTRIBUTE_NAME))
-            return (attributes.get_child_value<std::string>(FIXED_ATTRIBUTE_NAME) == "true");
-
-    }
+    // If element has <Fixed> attribute (determining whether PDO id fixed), return parsed value
+    if(auto attribute = get_child_or_empty(details::paths::FIXED_ATTRIBUTE); attribute.has_value())
+        return (attribute->get_value<std::string>() == "true");
 
     // Otherwise return false
     return false;
@@ -78,10 +54,10 @@ std::vector<std::size_t> Slave::Pdo::get_excludes() const {
     std::vector<std::size_t> ret;
     
     // Iterate over <Exclude> subelements of the PDO
-    for(const auto &elem : *this) {
+    for(const auto elem : view()) {
         // If <Exclude> element found, parse it
-        if(elem.first == "Exclude")
-            ret.push_back(parse_index(elem.second.get_value<std::string>()));
+        if(elem.get_key() == "Exclude")
+            ret.push_back(parse_index(elem.get_value<std::string>()));
     }
 
     // Return result
@@ -94,10 +70,10 @@ std::vector<Slave::Pdo::Entry> Slave::Pdo::get_entries() const {
     std::vector<Entry> ret;
     
     // Iterate over subelements of the PDO
-    for(const auto &elem : *this) {
+    for(const auto elem : view()) {
         // If <Entry> element found, parse it
-        if(elem.first == "Entry")
-            ret.emplace_back(elem.second);
+        if(elem.get_key() == "Entry")
+            ret.emplace_back(make_element(elem));
     }
 
     return ret;
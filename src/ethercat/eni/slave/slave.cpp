@@ -28,7 +28,7 @@ namespace ethercat::eni {
 Slave::PdosList Slave::get_pdos(Pdo::Direction direction) const {
 
     // Get <ProcessData> element
-    auto process_data_elem = get_child("ProcessData");
+    auto process_data_elem = view().get_child(details::paths::PROCESS_DATA);
 
     // Select target element based on the requested direction
     auto target_element_name = (direction == Pdo::Direction::Inputs) ? "TxPdo" : "RxPdo";
@@ -36,10 +36,31 @@ Slave::PdosList Slave::get_pdos(Pdo::Direction direction) const {
     PdosList ret;
     
     // Iterate over elements of <ProcessData> tag
-    for(const auto &elem : process_data_elem) {
+    for(const auto elem : process_data_elem) {
         // If target element met, add it to the resulting vector
-        if(elem.first == target_element_name)
-            ret.emplace_back(Pdo{ direction, elem.second });
+        if(elem.get_key() == target_element_name)
+            ret.emplace_back(Pdo{ direction, make_element(elem) });
+    }
+
+    return ret;
+}
+
+
+Slave::InitCmdsList Slave::get_init_cmds() const {
+
+    InitCmdsList ret;
+
+    // Get <InitCmds> element of the CoE mailbox (if present)
+    auto init_cmds_elem = view().get_child_or_empty(details::paths::COE_INIT_CMDS);
+    // If slave does not define CoE init commands, return empty list
+    if(not init_cmds_elem.has_value())
+        return ret;
+
+    // Iterate over elements of <InitCmds> tag
+    for(const auto elem : *init_cmds_elem) {
+        // If <InitCmd> element met, add it to the resulting vector
+        if(elem.get_key() == "InitCmd")
+            ret.emplace_back(make_element(elem));
     }
 
     return ret;
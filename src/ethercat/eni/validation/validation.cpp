@@ -0,0 +1,50 @@
+/* ============================================================================================================================ *//**
+ * @file       validation.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:13:11 pm
+ * @modified   Sunday, 18th October 2026 12:13:11 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of methods of the ValidationReport class describing consistency of the ENI (EtherCAT Network
+ *             Informations) file
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <sstream>
+// Private includes
+#include "ethercat/eni/validation.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::eni {
+
+/* ======================================================== Public methods ======================================================== */
+
+std::string ValidationReport::to_string() const {
+
+    std::stringstream ss;
+
+    for(const auto &issue : issues) {
+
+        ss << "[" << issue_type_to_str(issue.type) << "] Slave '" << issue.slave << "'";
+
+        // Print PDO-level context of the issue
+        if(not issue.pdo.empty())
+            ss << ", PDO '" << issue.pdo << "'";
+        if(not issue.entry.empty())
+            ss << ", entry '" << issue.entry << "'";
+
+        ss << ": " << issue.description << "\n";
+    }
+
+    return ss.str();
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::eni
@@ -0,0 +1,82 @@
+/* ============================================================================================================================ *//**
+ * @file       layout.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:21:24 pm
+ * @modified   Sunday, 18th October 2026 12:21:24 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of free functions related to compile-time descriptors of the Process Data Image layout
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <sstream>
+// Private includes
+#include "ethercat/common/utilities/enum.hpp"
+#include "ethercat/layout.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::layout {
+
+/* ======================================================== Free functions ======================================================== */
+
+void verify(const eni::Configuration &eni, config::types::Span<const EntryDescriptor * const> descriptors) {
+
+    using namespace common::utilities::bit;
+
+    // Build index of the PDI variables
+    auto process_image = eni.get_process_image();
+    const auto &pdi_index = process_image.get_index();
+
+    // Sizes of PDIs in bits
+    const std::size_t pdi_sizes[] {
+        process_image.get_size(eni::ProcessImage::Direction::Inputs)  * BITS_IN_BYTE,
+        process_image.get_size(eni::ProcessImage::Direction::Outputs) * BITS_IN_BYTE
+    };
+
+    std::stringstream ss;
+    std::size_t mismatches_num = 0;
+
+    // Auxiliary function reporting mismatch of the descriptor
+    auto report = [&](const EntryDescriptor &descriptor) -> std::ostream& {
+        ++mismatches_num;
+        return ss << "\n  '" << descriptor.slave << "." << descriptor.pdo << "." << descriptor.name << "': ";
+    };
+
+    for(const auto *descriptor : descriptors) {
+
+        // Find description of corresponding PDI variable
+        const auto *entry = pdi_index.get_entry(descriptor->direction, descriptor->slave, descriptor->pdo, descriptor->name);
+        if(entry == nullptr) {
+            report(*descriptor) << "no matching variable in the PDI description";
+            continue;
+        }
+
+        // Compare layout of the entry
+        if(entry->bit_offset != descriptor->bit_offset)
+            report(*descriptor) << "bitoffset differs (" << descriptor->bit_offset << " vs " << entry->bit_offset << ")";
+        if(entry->bit_size != descriptor->bit_size)
+            report(*descriptor) << "bitsize differs (" << descriptor->bit_size << " vs " << entry->bit_size << ")";
+        if(entry->type.get_name() != descriptor->type)
+            report(*descriptor) << "type differs (" << descriptor->type << " vs " << entry->type.get_name() << ")";
+
+        // Check if entry fits into the PDI
+        if(descriptor->bit_offset + descriptor->bit_size > pdi_sizes[common::utilities::to_underlying(descriptor->direction)])
+            report(*descriptor) << "entry exceeds the PDI";
+    }
+
+    // Throw error, if any mismatch found
+    if(mismatches_num != 0) {
+        throw eni::Error{ "[ethercat::layout::verify] Layout of the PDI does not match the ENI ("
+            + std::to_string(mismatches_num) + " mismatch(es)):" + ss.str() };
+    }
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::layout
@@ -1,5 +1,5 @@
 /* ============================================================================================================================ *//**
- * @file       type.hpp
+ * @file       builtin.cpp
  * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
  * @date       Monday, 9th May 2022 6:02:53 pm
@@ -13,8 +13,7 @@
 /* =========================================================== Includes =========================================================== */
 
 // Standard includes
-#include <sstream>
-#include <regex>
+#include <array>
 #include <charconv>
 // Private includes
 #include "ethercat/types/builtin.hpp"
@@ -31,111 +30,221 @@ namespace details {
         return (str.size() >= key.size()) and (str.substr(0, key.size()) == key);
     }
 
-}
+    /// Auxiliary alias for the builtin types' IDs
+    using ID = BuiltinType::ID;
 
-/* ========================================================== BuiltinType ========================================================= */
+    /**
+     * @brief Entry of the table of CoE names of builtin types
+     */
+    struct Name {
 
-std::optional<BuiltinType> BuiltinType::parse(std::string_view type_string) {
+        /// CoE name of the type
+        std::string_view name;
+        /// Index of the type
+        std::size_t index;
+
+    };
+
+    /// @returns number of CoE names of builtin non-string types
+    static constexpr std::size_t count_names() {
+
+        std::size_t ret = 0;
+
+        for(std::size_t i = 0; i < BuiltinType::TYPES_NUM; ++i) {
+            if(i != common::utilities::to_underlying(ID::String))
+                ret += common::types::traits::coe_names(common::utilities::to_enum<ID>(i)).size();
+        }
 
-    /// Helper function parsing base type identifier
-    auto parse_base = [](std::string_view type_string) -> std::optional<BuiltinType> {
+        return ret;
+    }
 
-        // Iterate over possible types
-        for(std::size_t i = 0; i < TYPES_NUM; ++i) {
+    /// CoE names of builtin non-string types
+    static constexpr auto Names = []() {
 
-            // Get possible names of the type
-            auto possible_name = common::types::traits::coe_names(common::utilities::to_enum<ID>(i));
+        std::array<Name, count_names()> ret { };
 
-            // If non-string type is matched, check if whole string matches
+        std::size_t n = 0;
+        for(std::size_t i = 0; i < BuiltinType::TYPES_NUM; ++i) {
             if(i != common::utilities::to_underlying(ID::String)) {
+                for(std::string_view name : common::types::traits::coe_names(common::utilities::to_enum<ID>(i)))
+                    ret[n++] = Name{ name, i };
+            }
+        }
 
-                // Iterate over possible types
-                for(const auto &name : possible_name) {
-                    // If name matches, return
-                    if(type_string == name) {
-                        return BuiltinType { NumericType{ common::utilities::to_enum<NumericType::ID>(i) } };
-                    }
-                }
+        return ret;
+    }();
 
-            // If non-string type is matched, check if whole string matches
-            } else {
+    /// Size of the perfect-hash table of CoE names (power of two)
+    static constexpr std::size_t NamesTableSize = 64;
 
-                // Iterate over possible types
-                for(std::string_view name : possible_name)
-                    // If name matches, return
-                    if(details::starts_with(type_string, name)) {
+    static_assert(Names.size() < NamesTableSize, 
+        "[ethercat::types::BuiltinType::parse] Perfect-hash table of types' names is too small");
 
-                        // Get size substring
-                        auto size_spec_string = type_string.substr(name.size());
+    /// @returns FNV-1a hash of the @p str mixed with the @p seed
+    static constexpr uint32_t hash(std::string_view str, uint32_t seed) {
 
-                        // Check if size string has ([0-9]+) format
-                        if(size_spec_string.front() != '(' or size_spec_string.back() != ')')
-                            return std::optional<BuiltinType>{ };
+        uint32_t ret = 2166136261U ^ seed;
 
-                        std::size_t size { };
+        for(char c : str) {
+            ret ^= static_cast<uint8_t>(c);
+            ret *= 16777619U;
+        }
+
+        return ret ^ (ret >> 16);
+    }
 
-                        // Parse number substring
-                        auto size_string = size_spec_string.substr(1, size_spec_string.size() - 1);
+    /// @returns slot of the @p str in the perfect-hash table of CoE names hashed with the @p seed
+    static constexpr std::size_t slot(std::string_view str, uint32_t seed) {
+        return hash(str, seed) & (NamesTableSize - 1);
+    }
 
-                        // If so, try to parse size
-                        try { std::from_chars(
-                            size_string.data(), size_string.data() + size_string.size(), size
-                        ); }
-                        /// On error, return
-                        catch(...) { return std::optional<BuiltinType>{ }; }
+    /// Seed making hash function perfect for the set of CoE names (found at compile time)
+    static constexpr uint32_t NamesSeed = []() {
+        for(uint32_t seed = 0;; ++seed) {
 
-                        // On success, return specifier
-                        return BuiltinType { StringType { size } };
+            std::array<bool, NamesTableSize> taken { };
 
-                    }
+            bool collision = false;
+            for(const auto &name : Names) {
+                auto i = slot(name.name, seed);
+                collision = collision or taken[i];
+                taken[i] = true;
             }
-        };
 
-        // If no match found, return empty
-        return std::optional<BuiltinType>{ };
-    };
+            if(not collision)
+                return seed;
+        }
+    }();
 
-    // Cast input to std::string, as std::regex does not support std::string_view
-    std::string type_str{ type_string };
+    /// Perfect-hash table of CoE names (holds index of the name in @ref Names increased by 1, or 0 for empty slots)
+    static constexpr auto NamesTable = []() {
 
-    // Regex pattern that matches standard name of the array of base types
-    const std::regex array_pattern("^ARRAY \\[[0-9]+\\.\\.([0-9])+\\] (of|OF) ([0-9a-zA-Z\\(\\)]+)$", std::regex_constants::ECMAScript);
-    // Amount of keys that would be matched in the array string
-    constexpr std::size_t ARRAY_PATTERN_MATCH_KEYS = 3;
+        std::array<uint8_t, NamesTableSize> ret { };
 
-    std::smatch match;
+        for(std::size_t i = 0; i < Names.size(); ++i)
+            ret[slot(Names[i].name, NamesSeed)] = static_cast<uint8_t>(i + 1);
 
-    // Check if content matches array format (pattern matches and subelement is found)
-    if(auto matches = std::regex_match(type_str, match, array_pattern); matches && match.size() == ARRAY_PATTERN_MATCH_KEYS + 1) {
+        return ret;
+    }();
 
-        std::size_t arity;
+    /**
+     * @brief Parses unsigned decimal number at the beginning of the @p str
+     * 
+     * @param str 
+     *    string to be parsed (parsed digits are removed from the string)
+     * @returns 
+     *    parsed number on success, empty optional if @p str does not start with a number
+     */
+    static std::optional<std::size_t> parse_number(std::string_view &str) {
 
-        /// Get type's arity
-        try { arity = static_cast<std::size_t>(std::stoi(match[1])); }
-        /// On error, return
-        catch(...) { return std::optional<BuiltinType>{ }; }
+        std::size_t ret { };
 
-        // Parse type
-        auto base = parse_base(match[3].str());
-        // If parsing failed, return empty
-        if(not base.has_value())
-            return std::optional<BuiltinType>{ };
+        auto [end, error] = std::from_chars(str.data(), str.data() + str.size(), ret);
+        if(error != std::errc{ })
+            return std::optional<std::size_t>{ };
 
-        // Else, add arity to the type descriptor
-        base->arity = arity;
-        // Return result
-        return *base;
+        str.remove_prefix(static_cast<std::size_t>(end - str.data()));
 
+        return ret;
     }
 
-    // Otherwise, try to parse scalar type
-    auto base = parse_base(type_string);
-    // If parsing failed, return empty
-    if(not base.has_value())
+    /**
+     * @brief Removes @p prefix from the @p str
+     * 
+     * @retval true 
+     *    if @p str started with the @p prefix
+     * @retval false 
+     *    otherwise (@p str is not modified)
+     */
+    static constexpr bool consume(std::string_view &str, std::string_view prefix) {
+
+        if(not starts_with(str, prefix))
+            return false;
+
+        str.remove_prefix(prefix.size());
+
+        return true;
+    }
+
+    /**
+     * @brief Parses identifier of the base (scalar) builtin type
+     * 
+     * @param type_string 
+     *    string to be parsed
+     * @retval specifier 
+     *    of the base type on success
+     * @retval empty 
+     *    optional if string does not describe base type 
+     */
+    static std::optional<BuiltinType> parse_base(std::string_view type_string) {
+
+        // Look for the numeric type in the perfect-hash table
+        if(auto entry = NamesTable[slot(type_string, NamesSeed)]; entry != 0 and Names[entry - 1].name == type_string)
+            return BuiltinType { NumericType{ common::utilities::to_enum<NumericType::ID>(Names[entry - 1].index) } };
+
+        // Otherwise, check if string type is given (in the 'STRING(n)' format)
+        for(std::string_view name : common::types::traits::coe_names(ID::String)) {
+            if(auto str = type_string; consume(str, name) and consume(str, "(")) {
+
+                // Parse size of the string
+                auto size = parse_number(str);
+                if(not size.has_value() or str != ")")
+                    return std::optional<BuiltinType>{ };
+
+                return BuiltinType { StringType { *size } };
+            }
+        }
+
+        // If no match found, return empty
         return std::optional<BuiltinType>{ };
+    }
+
+    /**
+     * @brief Parses @p type_string string to corresponding data type
+     * @see BuiltinType::parse()
+     */
+    static std::optional<BuiltinType> parse(std::string_view type_string) {
+
+        // Check if content matches array format ('ARRAY [<n>..<m>] OF <base>')
+        if(auto str = type_string; consume(str, "ARRAY [")) {
+
+            // Parse bounds of the array
+            auto lower = parse_number(str);
+            if(not lower.has_value() or not consume(str, ".."))
+                return std::optional<BuiltinType>{ };
+            auto upper = parse_number(str);
+            if(not upper.has_value() or not consume(str, "] "))
+                return std::optional<BuiltinType>{ };
+            // Bounds are inclusive, so the upper one cannot precede the lower one
+            if(*upper < *lower)
+                return std::optional<BuiltinType>{ };
+
+            // Parse specifier of the base type
+            if(not consume(str, "OF ") and not consume(str, "of "))
+                return std::optional<BuiltinType>{ };
+
+            // Parse type
+            auto base = parse_base(str);
+            // If parsing failed, return empty
+            if(not base.has_value())
+                return std::optional<BuiltinType>{ };
+
+            // Else, add arity to the type descriptor
+            base->arity = *upper - *lower + 1;
+            // Return result
+            return base;
+        }
+
+        // Otherwise, try to parse scalar type
+        return parse_base(type_string);
+    }
+
+}
+
+/* ========================================================== BuiltinType ========================================================= */
 
-    // Else, return result
-    return *base;
+std::optional<BuiltinType> BuiltinType::parse(std::string_view type_string) {
+    return details::parse(type_string);
 }
 
 /* ================================================================================================================================ */
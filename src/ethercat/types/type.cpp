@@ -44,7 +44,7 @@ std::string Type::get_name() const {
         std::stringstream ss;
 
         // Else, append array specifier
-        ss << "ARRAY [0.." << type.arity << "] of " << name;
+        ss << "ARRAY [0.." << (type.arity - 1) << "] of " << name;
 
         return ss.str();
 
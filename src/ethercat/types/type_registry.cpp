@@ -0,0 +1,112 @@
+/* ============================================================================================================================ *//**
+ * @file       type_registry.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:53:49 pm
+ * @modified   Sunday, 18th October 2026 12:53:49 pm
+ * @project    ethercat-lib
+ * @brief      Definitions of methods of the process-wide registry of interned type descriptors
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+// Private includes
+#include "ethercat/types/type_registry.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+namespace ethercat::types {
+
+/* ============================================================ Helpers =========================================================== */
+
+namespace {
+
+    /**
+     * @brief Owning storage of the registry
+     */
+    struct Storage {
+
+        /// Mutex synchronizing interning
+        std::mutex lock;
+        /// Chunks of interned types (capacity of each chunk is reserved up-front)
+        std::vector<std::unique_ptr<std::vector<Type>>> chunks;
+        /// Indices of interned types grouped by names of types
+        std::unordered_map<std::string, std::vector<TypeHandle::IndexType>> index;
+        /// Number of interned types
+        std::size_t size { 0 };
+
+    };
+
+    /// @returns storage of the registry (constructed on first use)
+    Storage &storage() {
+        static Storage storage;
+        return storage;
+    }
+
+}
+
+/* ====================================================== Private static data ===================================================== */
+
+std::array<std::atomic<const Type*>, TypeRegistry::MaxChunksNum> TypeRegistry::chunks { };
+
+/* ===================================================== Public static methods ==================================================== */
+
+TypeHandle TypeRegistry::intern(const Type &type) {
+
+    auto &registry = storage();
+
+    std::lock_guard guard{ registry.lock };
+
+    // Look for the already interned type (types are grouped by names, so deep comparison is rarely needed)
+    auto &candidates = registry.index[type.get_name()];
+    for(auto index : candidates) {
+        if(get(TypeHandle{ index }) == type)
+            return TypeHandle{ index };
+    }
+
+    // Check if registry is full
+    if(registry.size == ChunkSize * MaxChunksNum)
+        throw std::runtime_error{ "[ethercat::types::TypeRegistry::intern] Registry is full" };
+
+    // Allocate new chunk, if needed
+    if(registry.size % ChunkSize == 0) {
+        registry.chunks.push_back(std::make_unique<std::vector<Type>>());
+        registry.chunks.back()->reserve(ChunkSize);
+    }
+
+    // Intern the type (reserved capacity guarantees that already interned types are not moved)
+    auto &chunk = *registry.chunks.back();
+    chunk.push_back(type);
+
+    // Publish the chunk
+    if(chunk.size() == 1)
+        chunks[registry.size / ChunkSize].store(chunk.data(), std::memory_order_release);
+
+    auto index = static_cast<TypeHandle::IndexType>(registry.size++);
+    candidates.push_back(index);
+
+    return TypeHandle{ index };
+}
+
+
+std::size_t TypeRegistry::size() {
+
+    auto &registry = storage();
+
+    std::lock_guard guard{ registry.lock };
+    return registry.size;
+}
+
+/* ================================================================================================================================ */
+
+} // End namespace ethercat::types
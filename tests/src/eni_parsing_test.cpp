@@ -16,10 +16,12 @@
 // System includes
 #include <memory>
 #include <filesystem>
+#include <fstream>
 // Tetsing includes
 #include "gtest/gtest.h"
 // Private includes
 #include "ethercat/eni.hpp"
+#include "ethercat/types/builtin.hpp"
 
 /* ======================================================= Common functions ======================================================= */
 
@@ -135,6 +137,11 @@ TEST_F(CifxEthercatENIParserTest, SlaveParsing) {
     // Check if addresses match
     ASSERT_EQ(slave->get_physical_addr(),       1002U );
     ASSERT_EQ(slave->get_auto_increment_addr(), 65535U);
+    // Check if identity matches
+    ASSERT_EQ(slave->get_vendor_id(),    154U   );
+    ASSERT_EQ(slave->get_product_code(), 198948U);
+    ASSERT_EQ(slave->get_revision_no(),  66592U );
+    ASSERT_EQ(slave->get_serial_no(),    0U     );
 
     auto pdos = slave->get_pdos();
     // Check if PDOs are properly parsed
@@ -230,6 +237,42 @@ TEST_F(CifxEthercatENIParserTest, SlavePdoEntryParsing) {
 }
 
 
+TEST_F(CifxEthercatENIParserTest, SlaveInitCmdsParsing) {
+
+    // Get CoE init commands
+    auto imu_init_cmds   = eni_config->get_slave("Imu")->get_init_cmds();
+    auto wheel_init_cmds = eni_config->get_slave("WheelRearLeft")->get_init_cmds();
+
+    // Assert valid number of commands
+    ASSERT_EQ(imu_init_cmds.size(),   0U);
+    ASSERT_EQ(wheel_init_cmds.size(), 12U);
+    ASSERT_EQ(wheel_init_cmds.get_for_transition("PS").size(), 12U);
+    ASSERT_EQ(wheel_init_cmds.get_for_transition("IP").size(), 0U);
+
+    // Get PDO-assignment command
+    auto assignment_cmd = wheel_init_cmds[6];
+
+    // Assert valid transitions
+    ASSERT_EQ(assignment_cmd.get_transitions(), std::vector<std::string>{ "PS" });
+    ASSERT_TRUE(assignment_cmd.has_transition("PS"));
+    ASSERT_FALSE(assignment_cmd.has_transition("SO"));
+    // Assert valid flags
+    ASSERT_TRUE(assignment_cmd.is_fixed());
+    ASSERT_FALSE(wheel_init_cmds[10].is_fixed());
+    ASSERT_FALSE(assignment_cmd.is_complete_access());
+    // Assert valid command
+    ASSERT_EQ(assignment_cmd.get_ccs(), 1U);
+    ASSERT_TRUE(assignment_cmd.is_download());
+    ASSERT_EQ(assignment_cmd.get_timeout().count(), 0);
+    ASSERT_EQ(assignment_cmd.get_comment(), "download pdo 0x1C12:01 index");
+    // Assert valid address
+    ASSERT_EQ(assignment_cmd.get_index(),    0x1c12U);
+    ASSERT_EQ(assignment_cmd.get_subindex(), 1U);
+    // Assert valid data
+    ASSERT_EQ(assignment_cmd.get_data(), (std::vector<uint8_t>{ 0x01, 0x16 }));
+
+}
+
 TEST_F(CifxEthercatENIParserTest, CyclicParsing) {
 
     // Get assigned PDO
@@ -239,6 +282,40 @@ TEST_F(CifxEthercatENIParserTest, CyclicParsing) {
 
     // Assert valid bus cycle
     ASSERT_EQ(cyclic.get_cycle_time(), 10ms);
+    // Assert valid task parameters
+    ASSERT_EQ(cyclic.get_task_id(), 1);
+    ASSERT_EQ(cyclic.get_priority(), 4);
+    // Assert valid number of cyclic tasks
+    ASSERT_EQ(eni_config->get_cyclics().size(), 1);
+
+    // Get cyclic frames
+    auto frames = cyclic.get_frames();
+
+    // Assert valid frames
+    ASSERT_EQ(frames.size(), 1);
+    ASSERT_EQ(frames[0].commands.size(), 6);
+
+    using State = ethercat::eni::Cyclic::State;
+
+    // Assert valid position-addressed command
+    auto &armw = frames[0].commands[1];
+    ASSERT_EQ(armw.type, ethercat::eni::Cyclic::CommandType::ARMW);
+    ASSERT_EQ(armw.address, 0x0910FFFF);
+    ASSERT_EQ(armw.data_length, 4);
+    ASSERT_TRUE(armw.is_active_in(State::Preop));
+
+    // Assert valid logical command
+    auto &lrw = frames[0].commands[4];
+    ASSERT_EQ(lrw.type, ethercat::eni::Cyclic::CommandType::LRW);
+    ASSERT_EQ(lrw.address, 0x01000800);
+    ASSERT_EQ(lrw.data_length, 56);
+    ASSERT_EQ(lrw.input_offset, 87);
+    ASSERT_EQ(lrw.output_offset, 87);
+    ASSERT_EQ(lrw.expected_wkc, 12);
+    ASSERT_TRUE(lrw.reads_inputs());
+    ASSERT_TRUE(lrw.writes_outputs());
+    ASSERT_TRUE(lrw.is_active_in(State::Op));
+    ASSERT_FALSE(lrw.is_active_in(State::Preop));
 
 }
 
@@ -258,6 +335,190 @@ TEST_F(CifxEthercatENIParserTest, ProcessImageParsing) {
     ASSERT_EQ(process_image.get_slave_variables("WheelRearLeft").inputs.size(),  4U + 1U);
     ASSERT_EQ(process_image.get_slave_variables("WheelRearLeft").outputs.size(), 2U);
 
+    // Assert valid indexing of variables
+    auto &index = process_image.get_index();
+    ASSERT_EQ(index.get_pdo_variables(ethercat::eni::ProcessImage::Direction::Inputs, "WheelRearLeft", "Inputs").size(), 4U);
+    auto *entry = index.get_entry(ethercat::eni::ProcessImage::Direction::Inputs, "WheelRearLeft", "Inputs", "Status word");
+    ASSERT_NE(entry, nullptr);
+    ASSERT_EQ(entry->bit_offset, 872U);
+    ASSERT_EQ(entry->bit_size,   16U);
+    ASSERT_EQ(entry->variable.get_fq_name(), "WheelRearLeft.Inputs.Status word");
+    ASSERT_EQ(index.get_entry(ethercat::eni::ProcessImage::Direction::Outputs, "WheelRearLeft", "Inputs", "Status word"), nullptr);
+
+}
+
+
+TEST_F(CifxEthercatENIParserTest, Validation) {
+
+    // Example ENI should be consistent
+    auto report = eni_config->validate();
+    ASSERT_TRUE(report.is_valid()) << report.to_string();
+
+    // Read the example ENI
+    std::ifstream file{ eni_path };
+    std::string eni{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{ } };
+
+    // Auxiliary function replacing the first occurrence of the string in the ENI
+    auto replace = [&eni](std::string_view from, std::string_view to) {
+        auto pos = eni.find(from);
+        ASSERT_NE(pos, std::string::npos);
+        eni.replace(pos, from.size(), to);
+    };
+
+    // Duplicate physical address of the first slave and change type of one of its entries
+    replace("<PhysAddr>1002</PhysAddr>", "<PhysAddr>1001</PhysAddr>");
+    replace("<BitLen>16</BitLen>\n\t\t\t\t\t\t<Name>Acceleration X</Name>\n\t\t\t\t\t\t<DataType>INT</DataType>",
+            "<BitLen>32</BitLen>\n\t\t\t\t\t\t<Name>Acceleration X</Name>\n\t\t\t\t\t\t<DataType>DINT</DataType>");
+
+    // All issues should be reported at once
+    auto broken_report = ethercat::eni::configruation_from_string(eni).validate();
+    using IssueType = ethercat::eni::ValidationReport::IssueType;
+    ASSERT_EQ(broken_report.count(IssueType::NonUniquePhysicalAddr), 1U);
+    ASSERT_EQ(broken_report.count(IssueType::TypeMismatch), 1U);
+    ASSERT_EQ(broken_report.count(IssueType::BitSizeMismatch), 1U);
+    ASSERT_EQ(broken_report.count(IssueType::NonUniqueName), 0U);
+    ASSERT_EQ(broken_report.get_issues().size(), 3U) << broken_report.to_string();
+}
+
+
+TEST_F(CifxEthercatENIParserTest, CompiledCache) {
+
+    namespace fs = std::filesystem;
+
+    // Prepare copy of the ENI file in the temporary directory
+    auto dir = fs::temp_directory_path() / "ethercat_lib_eni_cache_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    auto eni_copy_path = dir / eni_path.filename();
+    fs::copy_file(eni_path, eni_copy_path);
+
+    auto cache_path = eni_copy_path;
+    cache_path += ethercat::config::eni::CompiledCacheExtension;
+
+    // Load ENI for the first time (parses the file and writes the cache)
+    auto parsed = ethercat::eni::configruation_from_file_cached(eni_copy_path);
+    ASSERT_FALSE(parsed.is_from_cache());
+    ASSERT_TRUE(fs::exists(cache_path));
+    auto cache_time = fs::last_write_time(cache_path);
+
+    // Load ENI for the second time (uses the cache)
+    auto cached = ethercat::eni::configruation_from_file_cached(eni_copy_path);
+    ASSERT_TRUE(cached.is_from_cache());
+    ASSERT_EQ(fs::last_write_time(cache_path), cache_time);
+
+    // Compare both configurations
+    ASSERT_EQ(cached.list_slaves(), eni_config->list_slaves());
+    ASSERT_EQ(cached.get_master().get_name(), "Master");
+    ASSERT_EQ(cached.get_slave("WheelRearLeft")->get_physical_addr(), parsed.get_slave("WheelRearLeft")->get_physical_addr());
+    ASSERT_EQ(cached.get_process_image().get_variables().inputs.size(),  34U);
+    ASSERT_EQ(cached.get_process_image().get_variables().outputs.size(), 11U);
+
+    // Both configurations should keep track of the source file
+    ASSERT_EQ(cached.get_source_path(), eni_copy_path);
+    ASSERT_EQ(parsed.get_slave("WheelRearLeft")->get_source_path(), eni_copy_path);
+
+    // Modify the ENI file (cache should be rebuilt)
+    std::ofstream{ eni_copy_path, std::ios::app } << "<!-- modified -->\n";
+    auto reparsed = ethercat::eni::configruation_from_file_cached(eni_copy_path);
+    ASSERT_FALSE(reparsed.is_from_cache());
+    ASSERT_EQ(reparsed.list_slaves(), eni_config->list_slaves());
+
+    // Verify that rebuilt cache is used
+    auto recached = ethercat::eni::configruation_from_file_cached(eni_copy_path);
+    ASSERT_TRUE(recached.is_from_cache());
+    ASSERT_EQ(recached.get_slaves_num(), eni_config->get_slaves_num());
+
+    fs::remove_all(dir);
+}
+
+
+TEST_F(CifxEthercatENIParserTest, PrecompiledPaths) {
+
+    // Paths are split at compile time
+    constexpr ethercat::eni::Path name_path { "Info.Name" };
+    static_assert(name_path.depth() == 2);
+    static_assert(name_path[0] == "Info" and name_path[1] == "Name");
+
+    namespace fs = std::filesystem;
+
+    // Prepare copy of the ENI file in the temporary directory (with the compiled cache written)
+    auto dir = fs::temp_directory_path() / "ethercat_lib_eni_paths_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    auto eni_copy_path = dir / eni_path.filename();
+    fs::copy_file(eni_path, eni_copy_path);
+    ASSERT_FALSE(ethercat::eni::element_from_file_cached(eni_copy_path).is_from_cache());
+
+    auto mapped = ethercat::eni::element_from_file_cached(eni_copy_path);
+    ASSERT_TRUE(mapped.is_from_cache());
+
+    // Compare resolution of precompiled and string paths (both for parsed and mapped documents)
+    for(auto config : { ethercat::eni::element_from_file(eni_path), mapped }) {
+
+        config = config.get_child(ethercat::eni::Path{ "EtherCATConfig.Config" });
+
+        std::size_t slaves_num = 0;
+        for(const auto &[key, slave] : config) {
+            if(key == "Slave") {
+                ASSERT_EQ(slave.get_child_value<std::string>(name_path), slave.get_child_value<std::string>("Info.Name"));
+                ASSERT_TRUE(slave.has_child(ethercat::eni::Path{ "ProcessData.Sm2" }));
+                ++slaves_num;
+            }
+        }
+        ASSERT_EQ(slaves_num, eni_config->get_slaves_num());
+
+        ASSERT_FALSE(config.get_child_value_or_empty<std::string>(ethercat::eni::Path{ "Master.Info.Unknown" }).has_value());
+    }
+
+    fs::remove_all(dir);
+}
+
+TEST_F(CifxEthercatENIParserTest, ElementViews) {
+
+    auto config = ethercat::eni::element_from_file(eni_path).get_child(ethercat::eni::Path{ "EtherCATConfig.Config" });
+
+    // Views visit the same children as owning iteration
+    auto it = config.begin();
+    for(const auto child : config.view()) {
+        ASSERT_EQ(child.get_key(), it->first);
+        ASSERT_EQ(child.size(), it->second.size());
+        ++it;
+    }
+    ASSERT_EQ(it, config.end());
+
+    // Views can be converted into owning elements of the same tree
+    auto master_view = config.view().get_child(ethercat::eni::Path{ "Master" });
+    auto master = config.make_element(master_view);
+    ASSERT_EQ(master.get_child_value<std::string>("Info.Name"), master_view.get_child_value<std::string>(ethercat::eni::Path{ "Info.Name" }));
+
+    // Views of other trees are rejected
+    auto other = ethercat::eni::element_from_file(eni_path);
+    ASSERT_THROW(config.make_element(other.view()), ethercat::eni::Error);
+}
+
+TEST(BuiltinTypeParsingTest, ArrayBounds) {
+
+    using ethercat::types::BuiltinType;
+
+    // Arity covers all elements between inclusive bounds
+    auto zero_based = BuiltinType::parse("ARRAY [0..7] OF BYTE");
+    ASSERT_TRUE(zero_based.has_value());
+    ASSERT_EQ(zero_based->arity, 8U);
+    ASSERT_EQ(zero_based->get_bitsize(), 64U);
+
+    auto one_based = BuiltinType::parse("ARRAY [1..8] OF BYTE");
+    ASSERT_TRUE(one_based.has_value());
+    ASSERT_EQ(one_based->arity, 8U);
+    ASSERT_EQ(one_based->get_bitsize(), 64U);
+
+    // Single-element arrays are not scalars
+    auto single = BuiltinType::parse("ARRAY [0..0] OF UINT");
+    ASSERT_TRUE(single.has_value());
+    ASSERT_TRUE(single->is_array());
+    ASSERT_EQ(single->get_bitsize(), 16U);
+
+    // Reversed bounds are rejected
+    ASSERT_FALSE(BuiltinType::parse("ARRAY [8..1] OF BYTE").has_value());
 }
 
 /* ================================================================================================================================ */
\ No newline at end of file
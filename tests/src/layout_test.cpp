@@ -0,0 +1,70 @@
+/* ============================================================================================================================ *//**
+ * @file       layout_test.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:21:24 pm
+ * @modified   Sunday, 18th October 2026 12:21:24 pm
+ * @project    ethercat-lib
+ * @brief      Unit tests for the compile-time layout of the PDI generated from the ENI file
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// System includes
+#include <vector>
+// Tetsing includes
+#include "gtest/gtest.h"
+// Private includes
+#include "ethercat/eni.hpp"
+#include "test_eni_layout.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace ethercat;
+
+/* ============================================================ Tests ============================================================= */
+
+TEST(LayoutTest, Verification) {
+
+    auto eni = eni::configruation_from_file(ETHERCAT_LIB_TEST_ENI_PATH);
+
+    // Generated layout should match the ENI it was generated from
+    ASSERT_NO_THROW(test_layout::verify(eni));
+
+    // Modified layout should be rejected
+    constexpr layout::EntryDescriptor shifted {
+        "WheelRearLeft", "Inputs", "Status word", eni::ProcessImage::Direction::Inputs,
+        test_layout::wheel_rear_left::inputs::status_word_descriptor.bit_offset + 8, 16, "UnsignedInt"
+    };
+    const layout::EntryDescriptor *descriptors[] { &shifted };
+    ASSERT_THROW(layout::verify(eni, descriptors), eni::Error);
+}
+
+
+TEST(LayoutTest, Access) {
+
+    using status_word = test_layout::wheel_rear_left::inputs::status_word;
+    using acceleration_x = test_layout::imu::transmit_pdo_mapping::acceleration_x;
+
+    auto eni = eni::configruation_from_file(ETHERCAT_LIB_TEST_ENI_PATH);
+    std::vector<uint8_t> pdi(eni.get_process_image().get_size(eni::ProcessImage::Direction::Inputs), 0);
+
+    // Check representations
+    static_assert(std::is_same_v<status_word::Type, uint16_t>);
+    static_assert(std::is_same_v<acceleration_x::Type, int16_t>);
+
+    // Check round trip
+    status_word::write(pdi, 0xBEEF);
+    acceleration_x::write(pdi, -1234);
+    ASSERT_EQ(status_word::read(pdi), 0xBEEF);
+    ASSERT_EQ(acceleration_x::read(pdi), -1234);
+
+    // Check placement in the PDI
+    ASSERT_EQ(pdi[status_word::Descriptor.bit_offset / 8 + 0], 0xEF);
+    ASSERT_EQ(pdi[status_word::Descriptor.bit_offset / 8 + 1], 0xBE);
+}
+
+/* ================================================================================================================================ */
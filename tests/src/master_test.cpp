@@ -0,0 +1,286 @@
+/* ============================================================================================================================ *//**
+ * @file       master_test.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 2:06:09 pm
+ * @modified   Sunday, 18th October 2026 2:06:09 pm
+ * @project    ethercat-lib
+ * @brief      Unit tests for the Master/Slave interfaces (instantiated with a mock implementation of the bus)
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// System includes
+#include <fstream>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <vector>
+// Tetsing includes
+#include "gtest/gtest.h"
+// Private includes
+#include "ethercat/master.hpp"
+#include "ethercat/slave.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace ethercat;
+
+/* ======================================================= Mock implementation ==================================================== */
+
+/**
+ * @brief Mock implementation of the slave interface (no SDO communication)
+ */
+class MockSlave : public Slave<MockSlave> {
+
+    /// Make interfaces friends to let them access implementation methods
+    friend class Slave<MockSlave>;
+    template<typename, typename> friend class ethercat::Master;
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    MockSlave(
+        eni::Slave slave_eni,
+        std::vector<Pdo<PdoDirection::Input>> &&inputs,
+        std::vector<Pdo<PdoDirection::Output>> &&outputs
+    ) : Slave<MockSlave>(std::move(slave_eni), std::move(inputs), std::move(outputs)) { }
+
+private: /* --------------------------------------------------- Implementation ---------------------------------------------------- */
+
+    State get_state_impl(std::chrono::milliseconds) const { return state; }
+    void set_state_impl(State state, std::chrono::milliseconds) { this->state = state; }
+
+    void download_sdo(uint16_t, uint16_t, std::span<const uint8_t>, std::chrono::milliseconds, bool) { }
+    void upload_sdo(uint16_t, uint16_t, std::span<uint8_t> data, std::chrono::milliseconds, bool) {
+        std::fill(data.begin(), data.end(), 0);
+    }
+
+    State state { State::Init };
+
+};
+
+/**
+ * @brief Mock implementation of the master interface (exchanges whole PDIs with the bus)
+ */
+class MockMaster : public Master<MockMaster, MockSlave> {
+
+    /// Make interface a friend to let it access implementation methods
+    friend class Master<MockMaster, MockSlave>;
+
+public: /* ----------------------------------------------------- Public ctors ----------------------------------------------------- */
+
+    MockMaster(const std::string &eni) :
+        Master<MockMaster, MockSlave>(eni, [](eni::Slave slave_eni, auto &&inputs, auto &&outputs) {
+            return MockSlave(std::move(slave_eni), std::move(inputs), std::move(outputs));
+        })
+    { }
+
+public: /* ---------------------------------------------------- Public data ------------------------------------------------------- */
+
+    /// Output PDI written to the bus by the last write_bus() call
+    std::vector<uint8_t> written;
+
+private: /* --------------------------------------------------- Implementation ---------------------------------------------------- */
+
+    State get_state_impl(std::chrono::milliseconds) const { return state; }
+    void set_state_impl(State state, std::chrono::milliseconds) { this->state = state; }
+
+    void read_bus_impl(std::span<uint8_t> data, std::chrono::milliseconds) { std::fill(data.begin(), data.end(), 0); }
+    void write_bus_impl(std::span<const uint8_t> data, std::chrono::milliseconds) { written.assign(data.begin(), data.end()); }
+
+    void reload_impl(const eni::Configuration &) { }
+
+    State state { State::Init };
+
+};
+
+/* ======================================================= Common functions ======================================================= */
+
+/// @returns content of the test ENI file
+static std::string read_test_eni() {
+    std::ifstream file{ ETHERCAT_LIB_TEST_ENI_PATH };
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+/// Replaces the first occurrence of @p what following subsequent @p markers in @p eni with @p with
+static void replace_after(std::string &eni, std::initializer_list<std::string_view> markers, std::string_view what, std::string_view with) {
+    std::size_t at = 0;
+    for(auto marker : markers) {
+        at = eni.find(marker, at);
+        ASSERT_NE(at, std::string::npos);
+    }
+    at = eni.find(what, at);
+    ASSERT_NE(at, std::string::npos);
+    eni.replace(at, what.size(), with);
+}
+
+
+/// Removes <Slave> element describing slave named @p name from the @p eni
+static void remove_slave(std::string &eni, std::string_view name) {
+    auto at = eni.find("<![CDATA[" + std::string{ name } + "]]>");
+    ASSERT_NE(at, std::string::npos);
+    auto begin = eni.rfind("<Slave>", at);
+    auto end   = eni.find("</Slave>", at);
+    ASSERT_NE(begin, std::string::npos);
+    ASSERT_NE(end, std::string::npos);
+    eni.erase(begin, end + std::string_view{ "</Slave>" }.size() - begin);
+}
+
+/* =========================================================== Fixtures =========================================================== */
+
+class MasterTest : public testing::Test {
+protected:
+
+    using Direction = MockSlave::PdoDirection;
+
+    /// @returns reference to the @p entry of the @p slave
+    template<Direction dir>
+    auto &entry(std::string_view slave, std::string_view entry) {
+        return master.get_slave(slave).template get_pdo_entry<dir>(entry);
+    }
+
+    std::string source { read_test_eni() };
+    MockMaster master { source };
+
+};
+
+/* ============================================================ Tests ============================================================= */
+
+TEST_F(MasterTest, Construction) {
+
+    // Check slaves
+    ASSERT_EQ(master.get_slaves().size(), 5);
+    ASSERT_EQ(master.get_slave("Imu").get_name(), "Imu");
+    ASSERT_EQ(master.get_slave("Imu").get_fixed_addr(), 1001);
+    ASSERT_THROW(master.get_slave("Nope"), std::out_of_range);
+
+    // Check PDIs
+    ASSERT_EQ(master._get_input_buffer().size(), 1536);
+    ASSERT_EQ(master._get_output_buffer().size(), 1536);
+}
+
+
+TEST_F(MasterTest, UnchangedReload) {
+
+    auto *input   = &entry<Direction::Input>("Imu", "Acceleration X");
+    auto *output  = &entry<Direction::Output>("WheelFrontRight", "Control word");
+    auto reference = output->get_reference<types::BuiltinType::ID::UINT>();
+    reference.set(0xBEEF);
+
+    auto summary = master.reload(eni::configruation_from_string(source));
+
+    // All slaves and PDOs should be kept
+    ASSERT_EQ(summary.kept_slaves, 5);
+    ASSERT_EQ(summary.rebuilt_slaves, 0);
+    ASSERT_EQ(summary.removed_slaves, 0);
+    ASSERT_EQ(summary.remapped_entries, 0);
+
+    // Entries (and so references) should be kept along with their data (WheelFrontRight.Outputs.Control word at bit 1144)
+    ASSERT_EQ(input, &entry<Direction::Input>("Imu", "Acceleration X"));
+    ASSERT_EQ(output, &entry<Direction::Output>("WheelFrontRight", "Control word"));
+    master.write_bus(std::chrono::milliseconds{ 1 });
+    ASSERT_EQ(master.written[1144 / 8 + 0], 0xEF);
+    ASSERT_EQ(master.written[1144 / 8 + 1], 0xBE);
+}
+
+
+TEST_F(MasterTest, ChangedAddressReload) {
+
+    auto *input   = &entry<Direction::Input>("Imu", "Acceleration X");
+    auto *output  = &entry<Direction::Output>("WheelFrontRight", "Control word");
+    auto reference = output->get_reference<types::BuiltinType::ID::UINT>();
+    reference.set(0xBEEF);
+
+    // Change physical address of the Imu
+    replace_after(source, { "<![CDATA[Imu]]>" }, "<PhysAddr>1001</PhysAddr>", "<PhysAddr>1099</PhysAddr>");
+
+    auto summary = master.reload(eni::configruation_from_string(source));
+
+    // Imu should be rebuilt with its PDOs carried over
+    ASSERT_EQ(summary.kept_slaves, 4);
+    ASSERT_EQ(summary.rebuilt_slaves, 1);
+    ASSERT_EQ(summary.removed_slaves, 0);
+    ASSERT_EQ(master.get_slave("Imu").get_fixed_addr(), 1099);
+    ASSERT_EQ(input, &entry<Direction::Input>("Imu", "Acceleration X"));
+
+    // Outputs of kept slaves should be written at their offsets (WheelFrontRight.Outputs.Control word at bit 1144)
+    master.write_bus(std::chrono::milliseconds{ 1 });
+    ASSERT_EQ(master.written.size(), 1536);
+    ASSERT_EQ(master.written[1144 / 8 + 0], 0xEF);
+    ASSERT_EQ(master.written[1144 / 8 + 1], 0xBE);
+}
+
+
+TEST_F(MasterTest, ChangedLayoutReload) {
+
+    auto *input  = &entry<Direction::Input>("WheelFrontRight", "Status word");
+    auto *output = &entry<Direction::Output>("WheelFrontRight", "Target Velocity");
+    entry<Direction::Output>("WheelFrontRight", "Control word").get_reference<types::BuiltinType::ID::UINT>().set(0xBEEF);
+
+    // Change type of the WheelFrontRight.Outputs.Target Velocity entry (DINT -> UDINT)
+    replace_after(source, { "<![CDATA[WheelFrontRight]]>", "<RxPdo Fixed=\"true\" Sm=\"2\">", "<Name>Target Velocity</Name>" },
+        "<DataType>DINT</DataType>", "<DataType>UDINT</DataType>");
+    replace_after(source, { "<Name>WheelFrontRight.Outputs.Target Velocity</Name>" },
+        "<DataType>DINT</DataType>", "<DataType>UDINT</DataType>");
+
+    auto summary = master.reload(eni::configruation_from_string(source));
+
+    // WheelFrontRight should be rebuilt
+    ASSERT_EQ(summary.kept_slaves, 4);
+    ASSERT_EQ(summary.rebuilt_slaves, 1);
+    ASSERT_EQ(summary.removed_slaves, 0);
+
+    // Inputs PDO has the same layout and should be carried over
+    ASSERT_EQ(input, &entry<Direction::Input>("WheelFrontRight", "Status word"));
+    // Outputs PDO has a different layout, so that its entries (and their data) should not be carried over
+    ASSERT_NE(output, &entry<Direction::Output>("WheelFrontRight", "Target Velocity"));
+    master.write_bus(std::chrono::milliseconds{ 1 });
+    ASSERT_EQ(master.written[1144 / 8 + 0], 0);
+    ASSERT_EQ(master.written[1144 / 8 + 1], 0);
+}
+
+
+TEST_F(MasterTest, RemovedSlaveReload) {
+
+    auto *input = &entry<Direction::Input>("Imu", "Acceleration X");
+
+    // Remove description of the WheelFrontRight
+    remove_slave(source, "WheelFrontRight");
+
+    auto summary = master.reload(eni::configruation_from_string(source));
+
+    // WheelFrontRight should be removed
+    ASSERT_EQ(summary.kept_slaves, 4);
+    ASSERT_EQ(summary.rebuilt_slaves, 0);
+    ASSERT_EQ(summary.removed_slaves, 1);
+    ASSERT_EQ(master.get_slaves().size(), 4);
+    ASSERT_THROW(master.get_slave("WheelFrontRight"), std::out_of_range);
+
+    // Remaining slaves should be kept
+    ASSERT_EQ(input, &entry<Direction::Input>("Imu", "Acceleration X"));
+    ASSERT_NO_THROW(master.write_bus(std::chrono::milliseconds{ 1 }));
+}
+
+
+
+TEST_F(MasterTest, ObjectScan) {
+
+    auto &slave = master.get_slave("Imu");
+
+    // Mock implementation provides no streaming upload, so entries are uploaded as a whole
+    auto udint = types::Type{ *types::BuiltinType::parse("UDINT") };
+    auto usint = types::Type{ *types::BuiltinType::parse("USINT") };
+    ASSERT_NO_THROW(slave.scan_object_entry(0x1018, 0, usint, "Number of entries", std::chrono::milliseconds{ 1 }));
+    ASSERT_NO_THROW(slave.scan_object_entry(0x1018, 1, udint, "Vendor ID", std::chrono::milliseconds{ 1 }));
+
+    // Offsets of entries should follow Complete Access layout
+    ASSERT_EQ(slave.get_object_dictionary().get_object(0x1018).size(), 2);
+    ASSERT_EQ(slave.get_object_dictionary().get_object(0x1018)[1].bitoffset, 16);
+}
+
+/* ================================================================================================================================ */
@@ -0,0 +1,108 @@
+/* ============================================================================================================================ *//**
+ * @file       object_dictionary_test.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 11:39:17 am
+ * @modified   Sunday, 18th October 2026 11:39:17 am
+ * @project    ethercat-lib
+ * @brief      Unit tests for the run-time ObjectDictionary class
+ *
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// System includes
+#include <sstream>
+// Tetsing includes
+#include "gtest/gtest.h"
+// Private includes
+#include "ethercat/descriptors/object_dictionary.hpp"
+
+/* ========================================================== Namespaces ========================================================== */
+
+using namespace ethercat::descriptors;
+using namespace ethercat::types;
+
+/* ======================================================== Common objects ======================================================== */
+
+/// Builds a test dictionary
+static ObjectDictionary make_dictionary() {
+
+    ObjectDictionary dictionary{ ObjectDictionary::Identity{ 154, 198948, 66592 } };
+
+    // Add entries in the unsorted order
+    dictionary.add_entry({ 0x6041, 0, "Statusword",  Type{ BuiltinType{ NumericType{ NumericType::ID::UnsignedInt } } } });
+    dictionary.add_entry({ 0x1c12, 1, "SubIndex 001", Type{ BuiltinType{ NumericType{ NumericType::ID::UnsignedInt } } } });
+    dictionary.add_entry({ 0x1c12, 0, "SubIndex 000", Type{ BuiltinType{ NumericType{ NumericType::ID::UnsignedShortInt } } } });
+    dictionary.add_entry({ 0x1008, 0, "Device name",  Type{ BuiltinType{ StringType{ 16 } } } });
+    dictionary.add_entry({ 0x1018, 0, "Identity",     Type{ StructuralType{ "DT1018", {
+        StructuralType::Subitem{ 1, "Vendor ID",    BuiltinType{ NumericType{ NumericType::ID::UnsignedDoubleInt } }, 16 },
+        StructuralType::Subitem{ 2, "Product code", BuiltinType{ NumericType{ NumericType::ID::UnsignedDoubleInt } }, 48 },
+    }, 80 } } });
+
+    return dictionary;
+}
+
+/* ============================================================ Tests ============================================================= */
+
+TEST(ObjectDictionaryTest, Lookup) {
+
+    auto dictionary = make_dictionary();
+
+    // Check sizes
+    ASSERT_EQ(dictionary.size(), 5);
+    ASSERT_EQ(dictionary.list_objects(), (std::vector<uint16_t>{ 0x1008, 0x1018, 0x1c12, 0x6041 }));
+
+    // Check objects lookup
+    ASSERT_TRUE(dictionary.has_object(0x1c12));
+    ASSERT_FALSE(dictionary.has_object(0x1c13));
+    ASSERT_EQ(dictionary.get_object(0x1c12).size(), 2);
+    ASSERT_EQ(dictionary.get_object(0x1c12)[0].subindex, 0);
+    ASSERT_TRUE(dictionary.get_object(0x1c13).empty());
+
+    // Check entries lookup
+    ASSERT_TRUE(dictionary.has_entry(0x1c12, 1));
+    ASSERT_FALSE(dictionary.has_entry(0x1c12, 2));
+    ASSERT_EQ(dictionary.get_entry(0x6041, 0).name, "Statusword");
+    ASSERT_EQ(dictionary.get_entry("SubIndex 001").index, 0x1c12);
+    ASSERT_THROW(dictionary.get_entry(0x6040, 0), std::out_of_range);
+    ASSERT_THROW(dictionary.get_entry("Controlword"), std::out_of_range);
+
+    // Check entries replacement
+    dictionary.add_entry({ 0x6041, 0, "Status word", Type{ BuiltinType{ NumericType{ NumericType::ID::Word } } } });
+    ASSERT_EQ(dictionary.size(), 5);
+    ASSERT_EQ(dictionary.get_entry(0x6041, 0).name, "Status word");
+}
+
+
+TEST(ObjectDictionaryTest, Persistence) {
+
+    auto dictionary = make_dictionary();
+
+    // Save and load dictionary
+    std::stringstream ss;
+    dictionary.save(ss);
+    auto loaded = ObjectDictionary::load(ss);
+
+    // Compare dictionaries
+    ASSERT_TRUE(loaded.get_identity() == dictionary.get_identity());
+    ASSERT_EQ(loaded.size(), dictionary.size());
+    for(std::size_t i = 0; i < loaded.size(); ++i) {
+        ASSERT_EQ(loaded.get_entries()[i].index,     dictionary.get_entries()[i].index);
+        ASSERT_EQ(loaded.get_entries()[i].subindex,  dictionary.get_entries()[i].subindex);
+        ASSERT_EQ(loaded.get_entries()[i].name,      dictionary.get_entries()[i].name);
+        ASSERT_EQ(loaded.get_entries()[i].type,      dictionary.get_entries()[i].type);
+        ASSERT_EQ(loaded.get_entries()[i].bitoffset, dictionary.get_entries()[i].bitoffset);
+    }
+
+    // Check file naming
+    ASSERT_EQ(ObjectDictionary::make_file_name(dictionary.get_identity()), "0000009a_00030924_00010420.od");
+
+    // Check invalid image
+    std::stringstream invalid{ "ECAT" };
+    ASSERT_THROW(ObjectDictionary::load(invalid), std::runtime_error);
+}
+
+/* ================================================================================================================================ */
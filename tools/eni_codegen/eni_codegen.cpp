@@ -0,0 +1,358 @@
+/* ============================================================================================================================ *//**
+ * @file       eni_codegen.cpp
+ * @author     Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @maintainer Krzysztof Pierczyk (krzysztof.pierczyk@gmail.com)
+ * @date       Sunday, 18th October 2026 12:21:24 pm
+ * @modified   Sunday, 18th October 2026 1:31:57 pm
+ * @project    ethercat-lib
+ * @brief      Build-time tool generating C++ header with compile-time layout of the Process Data Image described by the
+ *             ENI file
+ *
+ *    Usage: eni_codegen <eni-path> <header-path> [namespace]
+ *
+ * @copyright Krzysztof Pierczyk © 2022
+ */// ============================================================================================================================= */
+
+/* =========================================================== Includes =========================================================== */
+
+// Standard includes
+#include <array>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+// Private includes
+#include "ethercat/eni.hpp"
+
+/* ============================================================ Helpers =========================================================== */
+
+namespace {
+
+    /// Default namespace of the generated header
+    constexpr std::string_view DefaultNamespace { "eni_layout" };
+
+    /// C++ keywords that may collide with identifiers created from ENI names
+    constexpr std::array Keywords {
+        "alignas", "alignof", "and", "auto", "bool", "break", "case", "catch", "char", "class", "const", "continue",
+        "default", "delete", "do", "double", "else", "enum", "explicit", "export", "extern", "false", "float", "for",
+        "friend", "goto", "if", "inline", "int", "long", "namespace", "new", "not", "operator", "or", "private",
+        "protected", "public", "register", "return", "short", "signed", "sizeof", "static", "struct", "switch",
+        "template", "this", "throw", "true", "try", "typedef", "typename", "union", "unsigned", "using", "virtual",
+        "void", "volatile", "while", "xor"
+    };
+
+    /**
+     * @brief Converts ENI @p name into the valid C++ identifier in snake_case (with all non-alphanumeric
+     *    characters replaced with underscores)
+     */
+    std::string make_identifier(std::string_view name) {
+
+        std::string ret;
+
+        // Replace subsequent non-alphanumeric characters with a single underscore (and split CamelCase words)
+        for(std::size_t i = 0; i < name.size(); ++i) {
+            auto c = static_cast<unsigned char>(name[i]);
+            if(std::isalnum(c)) {
+                if(std::isupper(c) and i != 0 and std::islower(static_cast<unsigned char>(name[i - 1])))
+                    ret.push_back('_');
+                ret.push_back(static_cast<char>(std::tolower(c)));
+            } else if(not ret.empty() and ret.back() != '_')
+                ret.push_back('_');
+        }
+        while(not ret.empty() and ret.back() == '_')
+            ret.pop_back();
+
+        // Make sure that identifier is valid
+        if(ret.empty() or std::isdigit(static_cast<unsigned char>(ret.front())))
+            ret.insert(ret.begin(), '_');
+        for(const auto *keyword : Keywords) {
+            if(ret == keyword) {
+                ret.push_back('_');
+                break;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     * @brief Auxiliary class generating unique identifiers within a single C++ scope
+     */
+    class Scope {
+    public:
+
+        /// Constructs scope with the given @p reserved identifiers
+        Scope(std::initializer_list<std::string> reserved = { }) : used{ reserved } { }
+
+        /**
+         * @returns
+         *    unique identifier created from @p name (identifiers with @p suffix appended are
+         *    reserved as well)
+         */
+        std::string add(std::string_view name, std::string_view suffix = { }) {
+
+            auto base = make_identifier(name);
+            auto ret  = base;
+
+            // Append subsequent numbers until identifier is unique
+            for(std::size_t i = 2; used.count(ret) != 0 or used.count(ret + std::string{ suffix }) != 0; ++i)
+                ret = base + "_" + std::to_string(i);
+
+            used.insert(ret);
+            used.insert(ret + std::string{ suffix });
+
+            return ret;
+        }
+
+    private:
+
+        /// Identifiers used in the scope
+        std::set<std::string> used;
+
+    };
+
+    /// @returns @p str as C++ string literal
+    std::string make_literal(std::string_view str) {
+
+        std::string ret{ "\"" };
+        for(char c : str) {
+            if(c == '"' or c == '\\')
+                ret.push_back('\\');
+            ret.push_back(c);
+        }
+        ret.push_back('"');
+
+        return ret;
+    }
+
+    /**
+     * @returns
+     *    C++ representation of the entry of the given @p type and @p bit_size or empty string if
+     *    typed accessor cannot be generated for the entry
+     */
+    std::string make_representation(const ethercat::types::Type &type, std::size_t bit_size) {
+
+        // Accessors are generated only for numeric builtin types
+        if(not type.is_builtin() or not type.get_builtin().is_numeric())
+            return std::string{ };
+
+        const auto &builtin = type.get_builtin();
+        auto id             = builtin.get_numeric().get_coe_name();
+        bool is_boolean     = (id == "BIT" or id == "BOOL" or id == "BOOL8");
+
+        // Scalar booleans are represented as bool
+        if(builtin.is_scalar() and is_boolean)
+            return "bool";
+        // Arrays of booleans are not supported
+        if(is_boolean or builtin.get_bitsize() != bit_size)
+            return std::string{ };
+
+        std::string ret{ "ethercat::layout::Representation<ethercat::types::BuiltinType::ID::" };
+        ret += id;
+        if(builtin.is_array())
+            ret += ", " + std::to_string(builtin.arity);
+        ret += ">";
+
+        return ret;
+    }
+
+    /**
+     * @brief Generates header describing layout of the PDI described by the @p eni
+     *
+     * @param eni
+     *    loaded ENI
+     * @param source
+     *    name of the source ENI file
+     * @param ns
+     *    namespace of the generated header
+     */
+    std::string generate(const ethercat::eni::Configuration &eni, std::string_view source, std::string_view ns) {
+
+        using Direction = ethercat::eni::ProcessImage::Direction;
+
+        std::stringstream ss;
+        std::vector<std::string> descriptors;
+
+        // Build index of the PDI variables
+        auto process_image = eni.get_process_image();
+        const auto &pdi_index = process_image.get_index();
+
+        // Create include guard
+        std::string guard{ "__" };
+        for(char c : make_identifier(ns))
+            guard.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+        guard += "_LAYOUT_H__";
+
+        ss << "/**\n"
+           << " * @file\n"
+           << " * @brief Layout of the Process Data Image generated by eni_codegen from '" << source << "'\n"
+           << " * @note This file is generated automatically. Do not edit\n"
+           << " */\n\n"
+           << "#ifndef " << guard << "\n"
+           << "#define " << guard << "\n\n"
+           << "#include <array>\n"
+           << "#include <string_view>\n"
+           << "#include \"ethercat/layout.hpp\"\n\n"
+           << "namespace " << ns << " {\n";
+
+        Scope slaves_scope{ "entries", "verify" };
+
+        for(const auto &slave : eni.get_slaves()) {
+
+            auto slave_name = slave.get_name();
+            auto slave_id   = slaves_scope.add(slave_name);
+
+            ss << "\n/// Layout of the '" << slave_name << "' slave\n"
+               << "namespace " << slave_id << " {\n\n"
+               << "    /// Name of the slave\n"
+               << "    inline constexpr std::string_view Name { " << make_literal(slave_name) << " };\n";
+
+            Scope pdos_scope{ "Name" };
+            auto pdos = slave.get_pdos();
+
+            for(const auto *pdos_list : { &pdos.inputs, &pdos.outputs }) {
+                for(const auto &pdo : pdos_list->get_assigned()) {
+
+                    auto pdo_name = pdo.get_name();
+                    auto pdo_id   = pdos_scope.add(pdo_name);
+                    auto dir      = (pdo.get_direction() == ethercat::eni::Slave::Pdo::Direction::Inputs) ?
+                        Direction::Inputs : Direction::Outputs;
+
+                    ss << "\n    /// Layout of the '" << pdo_name << "' PDO\n"
+                       << "    namespace " << pdo_id << " {\n";
+
+                    Scope entries_scope{ "Name" };
+
+                    for(const auto &entry : pdo.get_entries()) {
+
+                        auto entry_name = entry.get_name();
+
+                        // Skip entries that are not mapped into the PDI
+                        const auto *variable = pdi_index.get_entry(dir, slave_name, pdo_name, entry_name);
+                        if(variable == nullptr) {
+                            std::cerr << "eni_codegen: skipping entry '" << slave_name << "." << pdo_name << "."
+                                      << entry_name << "' (no matching variable in the PDI description)\n";
+                            continue;
+                        }
+
+                        auto entry_id       = entries_scope.add(entry_name, "_descriptor");
+                        auto descriptor_id  = entry_id + "_descriptor";
+                        auto representation = make_representation(variable->type, variable->bit_size);
+
+                        ss << "\n        /// Descriptor of the '" << entry_name << "' entry\n"
+                           << "        inline constexpr ethercat::layout::EntryDescriptor " << descriptor_id << " {\n"
+                           << "            " << make_literal(slave_name) << ", "
+                                             << make_literal(pdo_name) << ", "
+                                             << make_literal(entry_name) << ",\n"
+                           << "            ethercat::eni::ProcessImage::Direction::"
+                                             << ((dir == Direction::Inputs) ? "Inputs" : "Outputs") << ",\n"
+                           << "            " << variable->bit_offset << ", "
+                                             << variable->bit_size << ", "
+                                             << make_literal(variable->type.get_name()) << "\n"
+                           << "        };\n";
+
+                        // Generate typed accessor, if supported
+                        if(not representation.empty()) {
+                            ss << "        /// Accessor of the '" << entry_name << "' entry\n"
+                               << "        using " << entry_id << " = ethercat::layout::Entry<"
+                                                   << descriptor_id << ", " << representation << ">;\n";
+                        }
+
+                        descriptors.push_back(slave_id + "::" + pdo_id + "::" + descriptor_id);
+                    }
+
+                    ss << "\n    } // End namespace " << pdo_id << "\n";
+                }
+            }
+
+            ss << "\n} // End namespace " << slave_id << "\n";
+        }
+
+        // Generate list of all descriptors
+        ss << "\n/// Descriptors of all entries\n"
+           << "inline constexpr std::array<const ethercat::layout::EntryDescriptor*, " << descriptors.size() << "> entries {";
+        for(std::size_t i = 0; i < descriptors.size(); ++i)
+            ss << ((i == 0) ? "\n    &" : ",\n    &") << descriptors[i];
+        ss << "\n};\n\n";
+
+        // Generate verification function
+        ss << "/**\n"
+           << " * @brief Verifies that the layout matches the PDI described by the loaded @p eni\n"
+           << " * @throws ethercat::eni::Error if layout does not match\n"
+           << " */\n"
+           << "inline void verify(const ethercat::eni::Configuration &eni) {\n"
+           << "    ethercat::layout::verify(eni, entries);\n"
+           << "}\n\n"
+           << "} // End namespace " << ns << "\n\n"
+           << "#endif\n";
+
+        return ss.str();
+    }
+
+}
+
+/* ============================================================= Main ============================================================= */
+
+int main(int argc, char const *argv[]) {
+
+    // Parse arguments
+    if(argc < 3 or argc > 4) {
+        std::cerr << "Usage: " << argv[0] << " <eni-path> <header-path> [namespace]\n";
+        return 1;
+    }
+
+    std::filesystem::path eni_path{ argv[1] };
+    std::filesystem::path header_path{ argv[2] };
+    std::string_view ns = (argc == 4) ? std::string_view{ argv[3] } : DefaultNamespace;
+
+    try {
+
+        // Load and validate the ENI
+        auto eni = ethercat::eni::configruation_from_file(eni_path);
+        if(auto report = eni.validate(); not report.is_valid()) {
+            std::cerr << "eni_codegen: ENI '" << eni_path.string() << "' is incoherent:\n" << report.to_string();
+            return 1;
+        }
+
+        // Generate the header
+        auto header = generate(eni, eni_path.filename().string(), ns);
+
+        // Write the header only if it changed (to avoid needless rebuilds)
+        {
+            std::ifstream current{ header_path };
+            std::string current_content{ std::istreambuf_iterator<char>{ current }, std::istreambuf_iterator<char>{ } };
+            if(current and current_content == header) {
+                // Mark the header as up-to-date, so that the build system does not regenerate it again
+                std::filesystem::last_write_time(header_path, std::filesystem::file_time_type::clock::now());
+                return 0;
+            }
+        }
+
+        if(header_path.has_parent_path())
+            std::filesystem::create_directories(header_path.parent_path());
+
+        // Write the header into a temporary file and move it in place, so that a failed write never leaves a truncated header
+        auto tmp_path = std::filesystem::path{ header_path } += ".tmp";
+        {
+            std::ofstream file{ tmp_path, std::ios::binary | std::ios::trunc };
+            file << header;
+            file.close();
+            if(not file) {
+                std::cerr << "eni_codegen: failed to write header '" << tmp_path.string() << "'\n";
+                std::filesystem::remove(tmp_path);
+                return 1;
+            }
+        }
+        std::filesystem::rename(tmp_path, header_path);
+
+    } catch(std::exception &e) {
+        std::cerr << "eni_codegen: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}